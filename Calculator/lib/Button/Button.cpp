@@ -1,6 +1,6 @@
 #include "Button.h"
 #include "WaveShare.h"
-#include "fonts/fonts.h"
+#include "CalculatorFonts.h"
 
 Button::Button()
     : _type(KeyType::NONE)
@@ -47,7 +47,7 @@ void Button::draw(WaveShare& lcd, bool pressed) const {
     lcd.drawRect(_x, _y, _w, _h, Colors::BLACK);
 
     // Draw label centered in button
-    lcd.drawTextCentered(_x, _y, _w, _h, _label, &Font20, bg, _fgColor);
+    lcd.drawTextCentered(_x, _y, _w, _h, _label, &Keys20, bg, _fgColor);
 }
 
 bool Button::hitTest(int16_t tx, int16_t ty) const {
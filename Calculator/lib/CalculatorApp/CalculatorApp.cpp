@@ -1,6 +1,7 @@
 #include "CalculatorApp.h"
 #include "Button.h"
-#include "fonts/fonts.h"
+#include "CalculatorFonts.h"
+#include "LCDFont.h"
 
 CalculatorApp::CalculatorApp()
     : _lastPressedButton(-1)
@@ -13,16 +14,23 @@ void CalculatorApp::begin() {
     // Initialize LCD and touch
     _lcd.begin();
 
-    // Clear screen with background color
-    _lcd.fillScreen(SCREEN_BG);
-
     // Initialize keyboard layout
     // Top margin = display height + margins
     int16_t topMargin = DISPLAY_HEIGHT + DISPLAY_MARGIN * 2;
     _keyboard.initLayout(_lcd.getWidth(), _lcd.getHeight(), topMargin);
 
-    // Draw the full UI
+    // Text right-aligned 5 px from the display's right edge, centered
+    // vertically in it
+    _readout.begin(_lcd.getLCD(), DISPLAY_MARGIN + 5, DISPLAY_MARGIN,
+                   _lcd.getWidth() - DISPLAY_MARGIN * 2 - 15, DISPLAY_HEIGHT,
+                   &Readout24, DISPLAY_BG, DISPLAY_FG, LCDLabel::Align::RIGHT);
+
+    // Clear screen and draw the full UI in one top-to-bottom pass
+    _lcd.beginScene();
+    _lcd.fillScreen(SCREEN_BG);
     drawUI();
+    _lcd.endScene();
+    _readout.invalidate();
 
     // Reset calculator state
     _logic.clearAll();
@@ -57,28 +65,18 @@ void CalculatorApp::drawDisplay() {
     // Get current display value
     const char* value = _logic.getDisplayValue();
 
-    // Calculate display area
-    int16_t displayX = DISPLAY_MARGIN + 5;
-    int16_t displayY = DISPLAY_MARGIN + 5;
-    int16_t displayW = _lcd.getWidth() - DISPLAY_MARGIN * 2 - 10;
-    int16_t displayH = DISPLAY_HEIGHT - 10;
-
-    // Clear the display area (keep border intact)
-    _lcd.fillRect(displayX, displayY, displayW, displayH, DISPLAY_BG);
-
-    // Choose font based on text length
-    sFONT* font = &Font24;
-    size_t len = strlen(value);
-    if (len > 16) {
-        font = &Font16;
-    } else if (len > 12) {
-        font = &Font20;
+    // The largest font the text fits the display in
+    uint32_t width = _lcd.getWidth() - DISPLAY_MARGIN * 2 - 15;
+    sFONT* font = &Readout24;
+    if (LCDFont::measure(font, value) > width) {
+        font = &Readout20;
+    }
+    if (LCDFont::measure(font, value) > width) {
+        font = &Readout16;
     }
 
-    // Draw text right-aligned with some padding from the right edge
-    int16_t textY = DISPLAY_MARGIN + (DISPLAY_HEIGHT - font->Height) / 2;
-    _lcd.drawTextRightAligned(displayX, textY, displayW - 5, value, font,
-                               DISPLAY_BG, DISPLAY_FG);
+    _readout.setFont(font);
+    _readout.setText(value);
 }
 
 void CalculatorApp::loopStep() {
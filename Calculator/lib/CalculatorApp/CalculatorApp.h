@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "WaveShare.h"
+#include "LCDLabel.h"
 #include "Keyboard.h"
 #include "CalculatorLogic.h"
 
@@ -37,6 +38,10 @@ private:
     Keyboard _keyboard;
     CalculatorLogic _logic;
 
+    // Right-aligned readout in the display area; a new value redraws only
+    // the characters that differ from the one on screen
+    LCDLabel _readout;
+
     // Touch state
     int _lastPressedButton;
     bool _waitingForRelease;
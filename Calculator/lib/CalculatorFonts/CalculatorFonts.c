@@ -0,0 +1,518 @@
+/*****************************************************************************
+ * | File        : CalculatorFonts.c
+ * | Function    : Proportional subsets of Font24/20/16 for the calculator
+ * | Info        : Generated with LCDFontPack::writeSource(); do not edit
+ * |
+ * | Readout*: the characters CalculatorLogic can show (digits, operators,
+ * | exponents and "Error"). Keys20: the key labels.
+ *****************************************************************************/
+
+#include "CalculatorFonts.h"
+
+/* Readout24: 14x24, "*+-./0123456789Eeor", packed by LCDFontPack::writeSource().
+   Proportional, from the 17x24 table font.
+   291 bytes of glyphs and 40 of offsets; the table had 1368.
+   73 bytes of character map and 95 of glyph metrics.
+   12 of 19 glyphs are run-length coded. */
+
+const uint8_t Readout24_Data[] =
+{
+	// @0 '*'
+	0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C,
+	0xC0,
+	// @13 '+' (runs)
+	0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A, 0x25,
+	// @25 '-' (runs)
+	0x0F, 0x50,
+	// @27 '.' (runs)
+	0x0C,
+	// @28 '/' (runs)
+	0x82, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72,
+	0x82, 0x72, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x80,
+	// @49 '0'
+	0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+	0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,
+	// @68 '1' (runs)
+	0x51, 0x64, 0x46, 0x43, 0x12, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x4F, 0x50,
+	// @84 '2' (runs)
+	0x35, 0x49, 0x13, 0x52, 0x12, 0x74, 0x72, 0x92, 0x82, 0x82, 0x73, 0x73,
+	0x72, 0x82, 0x82, 0x8F, 0x70,
+	// @101 '3' (runs)
+	0x34, 0x47, 0x32, 0x33, 0x82, 0x82, 0x72, 0x54, 0x65, 0x83, 0x92, 0x82,
+	0x84, 0x5C, 0x26, 0x30,
+	// @117 '4'
+	0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61,
+	0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8,
+	// @138 '5' (runs)
+	0x19, 0x29, 0x22, 0x92, 0x92, 0x92, 0x14, 0x49, 0x23, 0x42, 0xA2, 0x92,
+	0x92, 0x94, 0x62, 0x1A, 0x36, 0x30,
+	// @156 '6'
+	0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0,
+	0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0,
+	// @175 '7' (runs)
+	0x0F, 0x76, 0x45, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27,
+	0x37, 0x28, 0x24,
+	// @190 '8'
+	0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0,
+	0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,
+	// @209 '9'
+	0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0,
+	0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80,
+	// @228 'E'
+	0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF,
+	// @249 'e' (runs)
+	0x36, 0x4A, 0x22, 0x62, 0x12, 0x8F, 0xDA, 0x2B, 0x27, 0x21, 0xB3, 0x72,
+	// @261 'o' (runs)
+	0x44, 0x68, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x85, 0x63, 0x13, 0x43,
+	0x38, 0x64, 0x40,
+	// @276 'r' (runs)
+	0x05, 0x24, 0x15, 0x16, 0x35, 0x22, 0x33, 0x92, 0xA2, 0xA2, 0xA2, 0xA2,
+	0x7A, 0x2A, 0x20,
+};
+
+const uint16_t Readout24_Offsets[] =
+{
+	0x0000, 0x800D, 0x8019, 0x801B, 0x801C, 0x0031, 0x8044, 0x8054,
+	0x8065, 0x0075, 0x808A, 0x009C, 0x80AF, 0x00BE, 0x00D1, 0x00E4,
+	0x80F9, 0x8105, 0x8114, 0x0123,
+};
+
+const uint8_t Readout24_Map[] =
+{
+	0x00, 0x01, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+	0x0B, 0x0C, 0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF,
+	0x12,
+};
+
+/* Advance, Left, Top, Width, Height */
+const sGLYPH Readout24_Glyphs[] =
+{
+	{ 12,  0,  2, 10, 10 }, // '*'
+	{ 14,  0,  4, 12, 12 }, // '+'
+	{ 12,  0,  9, 10,  2 }, // '-'
+	{  6,  0, 14,  4,  3 }, // '.'
+	{ 12,  0,  0, 10, 20 }, // '/'
+	{ 13,  0,  2, 10, 15 }, // '0'
+	{ 13,  0,  2, 10, 15 }, // '1'
+	{ 13,  0,  2, 11, 15 }, // '2'
+	{ 13,  0,  2, 10, 15 }, // '3'
+	{ 13,  0,  2, 11, 15 }, // '4'
+	{ 13,  0,  2, 11, 15 }, // '5'
+	{ 13,  0,  2, 10, 15 }, // '6'
+	{ 13,  0,  2, 10, 15 }, // '7'
+	{ 13,  0,  2, 10, 15 }, // '8'
+	{ 13,  0,  2, 10, 15 }, // '9'
+	{ 14,  0,  3, 12, 14 }, // 'E'
+	{ 14,  0,  6, 12, 11 }, // 'e'
+	{ 14,  0,  6, 12, 11 }, // 'o'
+	{ 14,  0,  6, 12, 11 }, // 'r'
+};
+
+const sPACKED Readout24_Packed = {
+  Readout24_Data,
+  Readout24_Offsets,
+  42, /* First */
+  114, /* Last */
+  Readout24_Map,
+  Readout24_Glyphs,
+};
+
+sFONT Readout24 = {
+  0,
+  14, /* Width */
+  24, /* Height */
+  &Readout24_Packed,
+};
+
+/* Readout20: 12x20, "*+-./0123456789Eeor", packed by LCDFontPack::writeSource().
+   Proportional, from the 14x20 table font.
+   230 bytes of glyphs and 40 of offsets; the table had 760.
+   73 bytes of character map and 95 of glyph metrics.
+   8 of 19 glyphs are run-length coded. */
+
+const uint8_t Readout20_Data[] =
+{
+	// @0 '*'
+	0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+	// @9 '+' (runs)
+	0x42, 0x82, 0x82, 0x82, 0x4F, 0x54, 0x28, 0x28, 0x28, 0x24,
+	// @19 '-' (runs)
+	0x0F, 0x30,
+	// @21 '.' (runs)
+	0x09,
+	// @22 '/'
+	0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+	0x60, 0x60, 0xC0, 0xC0,
+	// @38 '0'
+	0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+	0xCF, 0xE3, 0xE0,
+	// @53 '1'
+	0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+	// @66 '2' (runs)
+	0x25, 0x37, 0x13, 0x35, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x6F, 0x30,
+	// @80 '3' (runs)
+	0x35, 0x38, 0x22, 0x43, 0x82, 0x73, 0x45, 0x55, 0x83, 0x82, 0x84, 0x5C,
+	0x27, 0x20,
+	// @94 '4'
+	0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+	0xC1, 0xF0, 0xF8,
+	// @109 '5' (runs)
+	0x17, 0x27, 0x22, 0x72, 0x76, 0x37, 0x22, 0x33, 0x72, 0x72, 0x74, 0x4B,
+	0x26, 0x20,
+	// @123 '6'
+	0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+	0xEF, 0xE1, 0xE0,
+	// @138 '7' (runs)
+	0x0F, 0x55, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27,
+	0x23,
+	// @151 '8'
+	0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+	0xEF, 0xE3, 0xE0,
+	// @166 '9'
+	0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+	0xDF, 0xCF, 0x80,
+	// @181 'E'
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFF,
+	// @196 'e' (runs)
+	0x34, 0x48, 0x22, 0x42, 0x1F, 0x79, 0x25, 0x21, 0x93, 0x52,
+	// @206 'o'
+	0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+	// @218 'r'
+	0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,
+};
+
+const uint16_t Readout20_Offsets[] =
+{
+	0x0000, 0x8009, 0x8013, 0x8015, 0x0016, 0x0026, 0x0035, 0x8042,
+	0x8050, 0x005E, 0x806D, 0x007B, 0x808A, 0x0097, 0x00A6, 0x00B5,
+	0x80C4, 0x00CE, 0x00DA, 0x00E6,
+};
+
+const uint8_t Readout20_Map[] =
+{
+	0x00, 0x01, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+	0x0B, 0x0C, 0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF,
+	0x12,
+};
+
+/* Advance, Left, Top, Width, Height */
+const sGLYPH Readout20_Glyphs[] =
+{
+	{ 10,  0,  1,  8,  9 }, // '*'
+	{ 12,  0,  3, 10, 10 }, // '+'
+	{ 11,  0,  7,  9,  2 }, // '-'
+	{  5,  0, 11,  3,  3 }, // '.'
+	{ 10,  0,  0,  8, 16 }, // '/'
+	{ 12,  0,  1,  9, 13 }, // '0'
+	{ 12,  1,  1,  8, 13 }, // '1'
+	{ 12,  0,  1,  9, 13 }, // '2'
+	{ 12,  0,  1, 10, 13 }, // '3'
+	{ 12,  0,  1,  9, 13 }, // '4'
+	{ 12,  0,  1,  9, 13 }, // '5'
+	{ 12,  0,  1,  9, 13 }, // '6'
+	{ 12,  0,  1,  9, 13 }, // '7'
+	{ 12,  0,  1,  9, 13 }, // '8'
+	{ 12,  0,  1,  9, 13 }, // '9'
+	{ 12,  0,  2, 10, 12 }, // 'E'
+	{ 12,  0,  5, 10,  9 }, // 'e'
+	{ 12,  0,  5, 10,  9 }, // 'o'
+	{ 12,  0,  5, 10,  9 }, // 'r'
+};
+
+const sPACKED Readout20_Packed = {
+  Readout20_Data,
+  Readout20_Offsets,
+  42, /* First */
+  114, /* Last */
+  Readout20_Map,
+  Readout20_Glyphs,
+};
+
+sFONT Readout20 = {
+  0,
+  12, /* Width */
+  20, /* Height */
+  &Readout20_Packed,
+};
+
+/* Readout16: 11x16, "*+-./0123456789Eeor", packed by LCDFontPack::writeSource().
+   Proportional, from the 11x16 table font.
+   154 bytes of glyphs and 40 of offsets; the table had 608.
+   73 bytes of character map and 95 of glyph metrics.
+   0 of 19 glyphs are run-length coded. */
+
+const uint8_t Readout16_Data[] =
+{
+	// @0 '*'
+	0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,
+	// @7 '+'
+	0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+	// @14 '-'
+	0xFE,
+	// @15 '.'
+	0xF0,
+	// @16 '/'
+	0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0,
+	0xC0,
+	// @29 '0'
+	0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,
+	// @38 '1'
+	0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	// @48 '2'
+	0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,
+	// @57 '3'
+	0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+	// @67 '4'
+	0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,
+	// @76 '5'
+	0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,
+	// @85 '6'
+	0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,
+	// @94 '7'
+	0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+	// @103 '8'
+	0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,
+	// @112 '9'
+	0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,
+	// @121 'E'
+	0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,
+	// @130 'e'
+	0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,
+	// @138 'o'
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,
+	// @146 'r'
+	0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,
+};
+
+const uint16_t Readout16_Offsets[] =
+{
+	0x0000, 0x0007, 0x000E, 0x000F, 0x0010, 0x001D, 0x0026, 0x0030,
+	0x0039, 0x0043, 0x004C, 0x0055, 0x005E, 0x0067, 0x0070, 0x0079,
+	0x0082, 0x008A, 0x0092, 0x009A,
+};
+
+const uint8_t Readout16_Map[] =
+{
+	0x00, 0x01, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+	0x0B, 0x0C, 0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF,
+	0x12,
+};
+
+/* Advance, Left, Top, Width, Height */
+const sGLYPH Readout16_Glyphs[] =
+{
+	{ 10,  0,  1,  8,  7 }, // '*'
+	{  9,  0,  3,  7,  7 }, // '+'
+	{  9,  0,  6,  7,  1 }, // '-'
+	{  4,  0,  9,  2,  2 }, // '.'
+	{ 10,  0,  0,  8, 13 }, // '/'
+	{ 10,  0,  1,  7, 10 }, // '0'
+	{ 10,  0,  1,  8, 10 }, // '1'
+	{ 10,  0,  1,  7, 10 }, // '2'
+	{ 10,  0,  1,  8, 10 }, // '3'
+	{ 10,  0,  1,  7, 10 }, // '4'
+	{ 10,  0,  1,  7, 10 }, // '5'
+	{ 10,  0,  1,  7, 10 }, // '6'
+	{ 10,  0,  1,  7, 10 }, // '7'
+	{ 10,  0,  1,  7, 10 }, // '8'
+	{ 10,  0,  1,  7, 10 }, // '9'
+	{ 10,  0,  2,  8,  9 }, // 'E'
+	{ 11,  0,  4,  9,  7 }, // 'e'
+	{ 11,  0,  4,  9,  7 }, // 'o'
+	{ 11,  0,  4,  9,  7 }, // 'r'
+};
+
+const sPACKED Readout16_Packed = {
+  Readout16_Data,
+  Readout16_Offsets,
+  42, /* First */
+  114, /* Last */
+  Readout16_Map,
+  Readout16_Glyphs,
+};
+
+sFONT Readout16 = {
+  0,
+  11, /* Width */
+  16, /* Height */
+  &Readout16_Packed,
+};
+
+/* Keys20: 13x20, "!*+-./0123456789=CDELacgilnostx", packed by LCDFontPack::writeSource().
+   Proportional, from the 14x20 table font.
+   374 bytes of glyphs and 64 of offsets; the table had 1240.
+   88 bytes of character map and 155 of glyph metrics.
+   12 of 31 glyphs are run-length coded. */
+
+const uint8_t Keys20_Data[] =
+{
+	// @0 '!'
+	0xFF, 0xFF, 0xFA, 0x40, 0x7E,
+	// @5 '*'
+	0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+	// @14 '+' (runs)
+	0x42, 0x82, 0x82, 0x82, 0x4F, 0x54, 0x28, 0x28, 0x28, 0x24,
+	// @24 '-' (runs)
+	0x0F, 0x30,
+	// @26 '.' (runs)
+	0x09,
+	// @27 '/'
+	0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+	0x60, 0x60, 0xC0, 0xC0,
+	// @43 '0'
+	0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+	0xCF, 0xE3, 0xE0,
+	// @58 '1'
+	0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+	// @71 '2' (runs)
+	0x25, 0x37, 0x13, 0x35, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x6F, 0x30,
+	// @85 '3' (runs)
+	0x35, 0x38, 0x22, 0x43, 0x82, 0x73, 0x45, 0x55, 0x83, 0x82, 0x84, 0x5C,
+	0x27, 0x20,
+	// @99 '4'
+	0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+	0xC1, 0xF0, 0xF8,
+	// @114 '5' (runs)
+	0x17, 0x27, 0x22, 0x72, 0x76, 0x37, 0x22, 0x33, 0x72, 0x72, 0x74, 0x4B,
+	0x26, 0x20,
+	// @128 '6'
+	0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+	0xEF, 0xE1, 0xE0,
+	// @143 '7' (runs)
+	0x0F, 0x55, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27,
+	0x23,
+	// @156 '8'
+	0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+	0xEF, 0xE3, 0xE0,
+	// @171 '9'
+	0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+	0xDF, 0xCF, 0x80,
+	// @186 '=' (runs)
+	0x0F, 0x7F, 0x7F, 0x70,
+	// @190 'C'
+	0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC,
+	0x73, 0xF8, 0x7C,
+	// @205 'D'
+	0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60,
+	0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+	// @222 'E'
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFF,
+	// @237 'L' (runs)
+	0x06, 0x46, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0x42, 0x22, 0x42, 0x22,
+	0x4F, 0x70,
+	// @251 'a'
+	0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,
+	// @263 'c'
+	0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,
+	// @275 'g'
+	0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+	0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,
+	// @293 'i' (runs)
+	0x32, 0x62, 0xF4, 0x53, 0x56, 0x26, 0x26, 0x26, 0x26, 0x23, 0xF1,
+	// @304 'l'
+	0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+	// @317 'n'
+	0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+	// @329 'o'
+	0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+	// @341 's' (runs)
+	0x2F, 0x14, 0x65, 0x65, 0x64, 0xF1, 0x20,
+	// @348 't' (runs)
+	0x22, 0x82, 0x82, 0x69, 0x19, 0x32, 0x82, 0x82, 0x82, 0x82, 0x42, 0x28,
+	0x35, 0x20,
+	// @362 'x'
+	0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,
+};
+
+const uint16_t Keys20_Offsets[] =
+{
+	0x0000, 0x0005, 0x800E, 0x8018, 0x801A, 0x001B, 0x002B, 0x003A,
+	0x8047, 0x8055, 0x0063, 0x8072, 0x0080, 0x808F, 0x009C, 0x00AB,
+	0x80BA, 0x00BE, 0x00CD, 0x00DE, 0x80ED, 0x00FB, 0x0107, 0x0113,
+	0x8125, 0x0130, 0x013D, 0x0149, 0x8155, 0x815C, 0x016A, 0x0176,
+};
+
+const uint8_t Keys20_Map[] =
+{
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF,
+	0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x12,
+	0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0xFF, 0x16, 0xFF, 0xFF, 0xFF, 0x17, 0xFF,
+	0x18, 0xFF, 0xFF, 0x19, 0xFF, 0x1A, 0x1B, 0xFF, 0xFF, 0xFF, 0x1C, 0x1D,
+	0xFF, 0xFF, 0xFF, 0x1E,
+};
+
+/* Advance, Left, Top, Width, Height */
+const sGLYPH Keys20_Glyphs[] =
+{
+	{  5,  0,  1,  3, 13 }, // '!'
+	{ 10,  0,  1,  8,  9 }, // '*'
+	{ 12,  0,  3, 10, 10 }, // '+'
+	{ 11,  0,  7,  9,  2 }, // '-'
+	{  5,  0, 11,  3,  3 }, // '.'
+	{ 10,  0,  0,  8, 16 }, // '/'
+	{ 12,  0,  1,  9, 13 }, // '0'
+	{ 12,  1,  1,  8, 13 }, // '1'
+	{ 12,  0,  1,  9, 13 }, // '2'
+	{ 12,  0,  1, 10, 13 }, // '3'
+	{ 12,  0,  1,  9, 13 }, // '4'
+	{ 12,  0,  1,  9, 13 }, // '5'
+	{ 12,  0,  1,  9, 13 }, // '6'
+	{ 12,  0,  1,  9, 13 }, // '7'
+	{ 12,  0,  1,  9, 13 }, // '8'
+	{ 12,  0,  1,  9, 13 }, // '9'
+	{ 13,  0,  5, 11,  6 }, // '='
+	{ 12,  0,  2, 10, 12 }, // 'C'
+	{ 13,  0,  2, 11, 12 }, // 'D'
+	{ 12,  0,  2, 10, 12 }, // 'E'
+	{ 12,  0,  2, 10, 12 }, // 'L'
+	{ 12,  0,  5, 10,  9 }, // 'a'
+	{ 12,  0,  5, 10,  9 }, // 'c'
+	{ 13,  0,  5, 11, 13 }, // 'g'
+	{ 10,  0,  1,  8, 13 }, // 'i'
+	{ 10,  0,  1,  8, 13 }, // 'l'
+	{ 12,  0,  5, 10,  9 }, // 'n'
+	{ 12,  0,  5, 10,  9 }, // 'o'
+	{ 10,  0,  5,  8,  9 }, // 's'
+	{ 12,  0,  2, 10, 12 }, // 't'
+	{ 12,  0,  5, 10,  9 }, // 'x'
+};
+
+const sPACKED Keys20_Packed = {
+  Keys20_Data,
+  Keys20_Offsets,
+  33, /* First */
+  120, /* Last */
+  Keys20_Map,
+  Keys20_Glyphs,
+};
+
+sFONT Keys20 = {
+  0,
+  13, /* Width */
+  20, /* Height */
+  &Keys20_Packed,
+};
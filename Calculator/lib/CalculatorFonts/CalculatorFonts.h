@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * | File        : CalculatorFonts.h
+ * | Function    : Proportional subsets of Font24/20/16 for the calculator
+ * | Info        : Only the glyphs the calculator draws are in flash
+ * |
+ * | About 2 KB for all four, against 6.5 KB for the packed Font24P, Font20P
+ * | and Font16P they replace (13.7 KB as tables). Characters outside a
+ * | subset are not drawn and take no space.
+ *****************************************************************************/
+
+#ifndef CALCULATOR_FONTS_H
+#define CALCULATOR_FONTS_H
+
+#include "fonts/fonts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern sFONT Readout24;
+extern sFONT Readout20;
+extern sFONT Readout16;
+extern sFONT Keys20;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CALCULATOR_FONTS_H
@@ -4,6 +4,10 @@
 #include <Arduino.h>
 #include "WaveshareLCD.h"
 #include "LCDTouch.h"
+#include "LCDBandRenderer.h"
+#include "LCDDisplayService.h"
+#include "LCDFont.h"
+#include "LCDTextLayout.h"
 
 /**
  * WaveShare - Simplified LCD interface wrapper
@@ -38,6 +42,41 @@ public:
                               const char* text, sFONT* font,
                               uint16_t bgColor, uint16_t fgColor);
 
+    // Text word-wrapped to the box, each line aligned in it and the lines
+    // centered vertically; what does not fit below is left out. The line
+    // breaks of a text are found once and reused.
+    void drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h,
+                     const char* text, sFONT* font,
+                     uint16_t bgColor, uint16_t fgColor,
+                     LCDTextLayout::Align align = LCDTextLayout::Align::CENTER);
+
+    // Full-screen redraws: the screen and text operations between
+    // beginScene() and endScene() are recorded, then sent band by band in
+    // one pass. Without memory for the bands they draw directly as usual.
+    //
+    // A retained scene is compared with the last retained one instead,
+    // and only what changed is sent: redraw the whole status area every
+    // time and a new balance costs just its digits. Drawing outside a
+    // scene over that area is noticed here; drawing through getLCD() is
+    // not, so report it with invalidateScene().
+    //
+    // While the render task runs, endScene() hands the scene to it and
+    // returns at once. The next beginScene() or invalidateScene() waits
+    // until that scene is on the panel.
+    bool beginScene(bool retained = false);
+    void endScene();
+    void invalidateScene();
+    void invalidateScene(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    // Hand the panel to a render task on the other core: the screen and
+    // text operations are then queued and return at once. Touch reads
+    // keep working through the shared SPI bus.
+    bool beginDisplayTask();
+    void endDisplayTask();
+
+    // Wait until everything queued so far is on the panel
+    void sync();
+
     // Touch operations
     bool readTouch(int16_t& tx, int16_t& ty);
     bool isTouched() const;
@@ -45,16 +84,39 @@ public:
     // Direct access to underlying objects (for advanced use)
     WaveshareLCD& getLCD() { return _lcd; }
     LCDTouch& getTouch() { return _touch; }
+    LCDGlyphCache& getGlyphCache() { return _glyphs; }
+    LCDTextLayout& getTextLayout() { return _layout; }
+    LCDDisplayService& getDisplay() { return _display; }
 
 private:
     WaveshareLCD _lcd;
     LCDTouch _touch;
 
+    // Rasterized glyphs for the text that is redrawn all the time
+    // (about 15 Font24 characters)
+    static constexpr size_t GLYPH_CACHE_BYTES = 12 * 1024;
+    LCDGlyphCache _glyphs;
+
+    // Line breaks of the texts drawTextBox() shows again and again
+    LCDTextLayout _layout;
+
+    // Scene recorder, allocated from beginScene() until the scene is sent
+    LCDBandRenderer _scene;
+    bool _recording;                // Between beginScene() and endScene()
+    bool _retained;
+    LCDDisplayService::Fence _sceneSent;
+
+    // Render task, running only between beginDisplayTask() and endDisplayTask()
+    LCDDisplayService _display;
+
     // Touch calibration values (for ESP32 Thing Plus + Waveshare 3.5")
     static constexpr float TOUCH_X_FAC = -0.132443f;
     static constexpr float TOUCH_Y_FAC = 0.089997f;
     static constexpr int TOUCH_X_OFF = 516;
     static constexpr int TOUCH_Y_OFF = -22;
+
+    static void sendScene(WaveshareLCD& lcd, void* context);
+    void waitForScene();
 };
 
 #endif // WAVEESHARE_H
@@ -0,0 +1,192 @@
+/*****************************************************************************
+ * | File        : LCDBlend.cpp
+ * | Function    : RGB565 blending kernels for RAM buffers
+ *****************************************************************************/
+
+#include "LCDBlend.h"
+#include <string.h>
+
+namespace {
+    // One channel of both pixels of a pair, each with room for its product
+    // (LCDBlend.h)
+    constexpr uint32_t FIVE = 0x001F001F;       // Red or blue
+    constexpr uint32_t SIX = 0x003F003F;        // Green
+    // Half a step (32) in both fields, for rounding
+    constexpr uint32_t HALF = 0x00200020;
+
+    // Level of each 4-bit mask value: m * 64 / 15, rounded
+    const uint8_t MASK_LEVELS[16] = {
+        0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64,
+    };
+
+    inline uint32_t level(uint8_t alpha) {
+        return ((uint32_t)alpha * 64 + 127) / 255;
+    }
+
+    inline uint8_t maskAt(const uint8_t* mask, uint32_t i) {
+        return (i & 1) ? (mask[i >> 1] & 0x0F) : (mask[i >> 1] >> 4);
+    }
+
+    inline uint32_t pairOf(COLOR color) {
+        return color | ((uint32_t)color << 16);
+    }
+
+    // Pairs may start at any pixel of 'src'; 'dst' is word aligned
+    inline uint32_t load(const COLOR* p) {
+        uint32_t w;
+        memcpy(&w, p, sizeof(w));
+        return w;
+    }
+
+    inline uint32_t loadAligned(const COLOR* p) {
+        uint32_t w;
+        memcpy(&w, __builtin_assume_aligned(p, 4), sizeof(w));
+        return w;
+    }
+
+    inline void storeAligned(COLOR* p, uint32_t w) {
+        memcpy(__builtin_assume_aligned(p, 4), &w, sizeof(w));
+    }
+
+    inline bool aligned(const COLOR* p) {
+        return ((uintptr_t)p & 3) == 0;
+    }
+
+    inline uint32_t red(uint32_t pair) { return (pair >> 11) & FIVE; }
+    inline uint32_t green(uint32_t pair) { return (pair >> 5) & SIX; }
+    inline uint32_t blue(uint32_t pair) { return pair & FIVE; }
+
+    // Rounded sums of products back into a pair
+    inline uint32_t join(uint32_t r, uint32_t g, uint32_t b) {
+        return (((r >> 6) & FIVE) << 11) | (((g >> 6) & SIX) << 5) | ((b >> 6) & FIVE);
+    }
+
+    // Both pixels of 'fg' over those of 'bg' at level a (0..64). A single
+    // pixel goes through as a pair with an empty high half.
+    inline uint32_t mixPair(uint32_t fg, uint32_t bg, uint32_t a) {
+        uint32_t b = 64 - a;
+        return join(red(fg) * a + red(bg) * b + HALF,
+                    green(fg) * a + green(bg) * b + HALF,
+                    blue(fg) * a + blue(bg) * b + HALF);
+    }
+
+    inline COLOR mixOne(COLOR fg, COLOR bg, uint32_t a) {
+        return (COLOR)mixPair(fg, bg, a);
+    }
+
+    // A color at a fixed level, its products worked out once
+    struct Paint {
+        uint32_t r, g, b, rest;
+
+        Paint(COLOR color, uint32_t a) : rest(64 - a) {
+            uint32_t pair = pairOf(color);
+            r = red(pair) * a + HALF;
+            g = green(pair) * a + HALF;
+            b = blue(pair) * a + HALF;
+        }
+
+        uint32_t overPair(uint32_t bg) const {
+            return join(r + red(bg) * rest, g + green(bg) * rest, b + blue(bg) * rest);
+        }
+
+        COLOR overOne(COLOR bg) const {
+            return (COLOR)overPair(bg);
+        }
+    };
+}
+
+COLOR LCDBlend::mix(COLOR fg, COLOR bg, uint8_t alpha) {
+    return mixOne(fg, bg, level(alpha));
+}
+
+void LCDBlend::blend(COLOR* dst, const COLOR* src, uint32_t count, uint8_t alpha) {
+    uint32_t a = level(alpha);
+    if (a == 0 || count == 0) return;
+    if (a == 64) {
+        if (dst != src) memmove(dst, src, count * sizeof(COLOR));
+        return;
+    }
+
+    if (!aligned(dst)) {
+        *dst = mixOne(*src++, *dst, a);
+        dst++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2, src += 2) {
+        storeAligned(dst, mixPair(load(src), loadAligned(dst), a));
+    }
+    if (count > 0) *dst = mixOne(*src, *dst, a);
+}
+
+void LCDBlend::over(COLOR* dst, const COLOR* src, const uint8_t* mask, uint32_t count) {
+    uint32_t i = 0;
+    if (count > 0 && !aligned(dst)) {
+        dst[0] = mixOne(src[0], dst[0], MASK_LEVELS[maskAt(mask, 0)]);
+        i = 1;
+    }
+    for (; i + 1 < count; i += 2) {
+        uint8_t m0 = maskAt(mask, i);
+        uint8_t m1 = maskAt(mask, i + 1);
+        if (m0 == m1) {
+            // Runs of one coverage, most of all empty and solid ones
+            if (m0 == 0) continue;
+            if (m0 == MASK_OPAQUE) {
+                storeAligned(dst + i, load(src + i));
+            } else {
+                storeAligned(dst + i, mixPair(load(src + i), loadAligned(dst + i), MASK_LEVELS[m0]));
+            }
+        } else {
+            dst[i] = mixOne(src[i], dst[i], MASK_LEVELS[m0]);
+            dst[i + 1] = mixOne(src[i + 1], dst[i + 1], MASK_LEVELS[m1]);
+        }
+    }
+    if (i < count) dst[i] = mixOne(src[i], dst[i], MASK_LEVELS[maskAt(mask, i)]);
+}
+
+void LCDBlend::fill(COLOR* dst, uint32_t count, COLOR color, uint8_t alpha) {
+    tint(dst, dst, count, color, alpha);
+}
+
+void LCDBlend::mask(COLOR* dst, const uint8_t* mask, uint32_t count, COLOR color) {
+    uint32_t pair = pairOf(color);
+    uint32_t i = 0;
+    if (count > 0 && !aligned(dst)) {
+        dst[0] = mixOne(color, dst[0], MASK_LEVELS[maskAt(mask, 0)]);
+        i = 1;
+    }
+    for (; i + 1 < count; i += 2) {
+        uint8_t m0 = maskAt(mask, i);
+        uint8_t m1 = maskAt(mask, i + 1);
+        if (m0 == m1) {
+            if (m0 == 0) continue;
+            if (m0 == MASK_OPAQUE) {
+                storeAligned(dst + i, pair);
+            } else {
+                storeAligned(dst + i, mixPair(pair, loadAligned(dst + i), MASK_LEVELS[m0]));
+            }
+        } else {
+            dst[i] = mixOne(color, dst[i], MASK_LEVELS[m0]);
+            dst[i + 1] = mixOne(color, dst[i + 1], MASK_LEVELS[m1]);
+        }
+    }
+    if (i < count) dst[i] = mixOne(color, dst[i], MASK_LEVELS[maskAt(mask, i)]);
+}
+
+void LCDBlend::tint(COLOR* dst, const COLOR* src, uint32_t count, COLOR color, uint8_t alpha) {
+    if (count == 0) return;
+    uint32_t a = level(alpha);
+    if (a == 0) {
+        if (dst != src) memmove(dst, src, count * sizeof(COLOR));
+        return;
+    }
+
+    Paint paint(color, a);
+    if (!aligned(dst)) {
+        *dst++ = paint.overOne(*src++);
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2, src += 2) {
+        storeAligned(dst, paint.overPair(load(src)));
+    }
+    if (count > 0) *dst = paint.overOne(*src);
+}
@@ -0,0 +1,63 @@
+/*****************************************************************************
+ * | File        : LCDFont.h
+ * | Function    : Glyph lookup and text measurement for every sFONT kind
+ * | Info        : Table, packed, subset and proportional fonts alike
+ * |
+ * | Text used to be measured as strlen() * Width. With proportional fonts
+ * | each character has its own advance, read from the font's glyph table,
+ * | so measuring never touches the glyph bits:
+ * |
+ * |   uint32_t w = LCDFont::measure(&Readout24, "1234.5");
+ * |   lcd.drawString(x + (boxWidth - w) / 2, y, "1234.5", &Readout24, ...);
+ * |
+ * | advance() is one lookup for any font, and measure() of a fixed-width
+ * | font whose length is known is a single multiply.
+ *****************************************************************************/
+
+#ifndef __LCD_FONT_H
+#define __LCD_FONT_H
+
+#include <Arduino.h>
+#include <string.h>
+#include "fonts/fonts.h"
+
+namespace LCDFont {
+    constexpr uint16_t NO_GLYPH = 0xFFFF;
+
+    inline bool isProportional(const sFONT* font) {
+        return font->Packed != nullptr && font->Packed->Glyphs != nullptr;
+    }
+
+    // Glyph number of 'ch' in a packed font, or NO_GLYPH
+    inline uint16_t glyphIndex(const sPACKED* packed, char ch) {
+        uint8_t code = (uint8_t)ch;
+        if (code < packed->First || code > packed->Last) return NO_GLYPH;
+        if (packed->Map == nullptr) return code - packed->First;
+        uint8_t index = pgm_read_byte(&packed->Map[code - packed->First]);
+        return index == PACKED_NO_GLYPH ? NO_GLYPH : index;
+    }
+
+    // How far the pen moves after 'ch'
+    inline uint16_t advance(const sFONT* font, char ch) {
+        if (!isProportional(font)) return font->Width;
+        uint16_t index = glyphIndex(font->Packed, ch);
+        if (index == NO_GLYPH) return 0;
+        return pgm_read_byte(&font->Packed->Glyphs[index].Advance);
+    }
+
+    // Width of the first 'length' characters of 'str'
+    inline uint32_t measure(const sFONT* font, const char* str, size_t length) {
+        if (!isProportional(font)) return (uint32_t)length * font->Width;
+        uint32_t width = 0;
+        for (size_t i = 0; i < length; i++) {
+            width += advance(font, str[i]);
+        }
+        return width;
+    }
+
+    inline uint32_t measure(const sFONT* font, const char* str) {
+        return measure(font, str, strlen(str));
+    }
+}
+
+#endif // __LCD_FONT_H
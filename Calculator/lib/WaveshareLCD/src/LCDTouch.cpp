@@ -19,7 +19,7 @@
 //------------------------------------------------------------------------------
 
 LCDTouch::LCDTouch(WaveshareLCD& lcd)
-    : _lcd(lcd), _pins(), _status(0),
+    : _lcd(lcd), _pins(), _busDevice(SPIBus::NO_DEVICE), _status(0),
       _rawX(0), _rawY(0), _rawX0(0), _rawY0(0),
       _drawPoint{0, 0, Colors::BLUE, DotPixel::PX_2X2},
       _scanDir(SCAN_DIR_DEFAULT),
@@ -27,7 +27,7 @@ LCDTouch::LCDTouch(WaveshareLCD& lcd)
 }
 
 LCDTouch::LCDTouch(WaveshareLCD& lcd, const TouchPins& pins)
-    : _lcd(lcd), _pins(pins), _status(0),
+    : _lcd(lcd), _pins(pins), _busDevice(SPIBus::NO_DEVICE), _status(0),
       _rawX(0), _rawY(0), _rawX0(0), _rawY0(0),
       _drawPoint{0, 0, Colors::BLUE, DotPixel::PX_2X2},
       _scanDir(SCAN_DIR_DEFAULT),
@@ -39,11 +39,14 @@ LCDTouch::LCDTouch(WaveshareLCD& lcd, const TouchPins& pins)
 //------------------------------------------------------------------------------
 
 void LCDTouch::begin() {
-    pinMode(_pins.cs, OUTPUT);
-    pinMode(_pins.irq, INPUT_PULLUP);
+    _irq.begin(_pins.irq, INPUT_PULLUP);
     pinMode(_pins.busy, INPUT);
 
-    csHigh();
+    // CS is set up by the bus
+    if (_busDevice == SPIBus::NO_DEVICE) {
+        _busDevice = _lcd.getBus().addDevice(_pins.cs,
+                                             SPISettings(TOUCH_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+    }
 
     _scanDir = _lcd.getScanDir();
     loadDefaultCalibration();
@@ -53,38 +56,22 @@ void LCDTouch::begin() {
 // ADC Reading
 //------------------------------------------------------------------------------
 
-void LCDTouch::readADC(POINT& x, POINT& y) {
-    POINT data = 0;
-
-    // Temporarily lower SPI clock for touch controller
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-
-    csLow();
-
-    // Read X coordinate (0xD0 command)
-    SPI.transfer(0xD0);
-    delayMicroseconds(200);
-    data = SPI.transfer(0x00);
-    data <<= 8;
-    data |= SPI.transfer(0x00);
-    data >>= 3;
-    x = data;
-
-    // Read Y coordinate (0x90 command)
-    SPI.transfer(0x90);
+POINT LCDTouch::readChannel(uint8_t command) {
+    SPI.transfer(command);
     delayMicroseconds(200);
-    data = SPI.transfer(0x00);
+    POINT data = SPI.transfer(0x00);
     data <<= 8;
     data |= SPI.transfer(0x00);
-    data >>= 3;
-    y = data;
-
-    csHigh();
+    return data >> 3;
+}
 
-    // Restore SPI clock
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+void LCDTouch::readRaw(POINT& x, POINT& y) {
+    // The bus waits out a panel DMA stream and switches to the touch clock
+    SPIBus& bus = _lcd.getBus();
+    bus.select(_busDevice);
+    x = readChannel(0xD0);
+    y = readChannel(0x90);
+    bus.deselect(_busDevice);
 }
 
 void LCDTouch::readADCAverage(POINT& x, POINT& y) {
@@ -93,7 +80,7 @@ void LCDTouch::readADCAverage(POINT& x, POINT& y) {
 
     // Read multiple samples
     for (uint8_t i = 0; i < READ_TIMES; i++) {
-        readADC(tempX, tempY);
+        readRaw(tempX, tempY);
         xBuff[i] = tempX;
         yBuff[i] = tempY;
         delayMicroseconds(200);
@@ -5,31 +5,85 @@
  *****************************************************************************/
 
 #include "WaveshareLCD.h"
+#include "LCDDmaTransport.h"
 #include <Arduino.h>
 
+#if defined(ESP32)
+#include <esp_system.h>
+#endif
+
+//------------------------------------------------------------------------------
+// Init sequence
+//------------------------------------------------------------------------------
+// Entries are: command, parameter count, parameters. INIT_DELAY in the count
+// adds a byte with a wait in ms after the command. Being const, the table
+// stays in flash.
+static constexpr uint8_t INIT_END = 0x00;       // NOP, never sent
+static constexpr uint8_t INIT_DELAY = 0x80;
+static constexpr uint8_t INIT_MAX_PARAMS = 15;
+
+static const uint8_t INIT_SEQUENCE[] = {
+    0xF9, 2,  0x00, 0x08,
+    0xC0, 2,  0x19, 0x1A,                       // Power Control 1
+    0xC1, 2,  0x45, 0x00,                       // Power Control 2
+    0xC2, 1,  0x33,                             // Power Control 3
+    0xC5, 2,  0x00, 0x28,                       // VCOM Control
+    0xB1, 2,  0xA0, 0x11,                       // Frame Rate Control
+    0xB4, 1,  0x02,                             // Display Inversion Control
+    0xB6, 3,  0x00, 0x42, 0x3B,                 // Display Function Control
+    0xB7, 1,  0x07,                             // Entry Mode Set
+    0xE0, 15, 0x1F, 0x25, 0x22, 0x0B, 0x06, 0x0A, 0x4E, 0xC6,
+              0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // Positive Gamma
+    0xE1, 15, 0x1F, 0x3F, 0x3F, 0x0F, 0x1F, 0x0F, 0x46, 0x49,
+              0x31, 0x05, 0x09, 0x03, 0x1C, 0x1A, 0x00,     // Negative Gamma
+    0xF1, 8,  0x36, 0x04, 0x00, 0x3C, 0x0F, 0x0F, 0xA4, 0x02,
+    0xF2, 9,  0x18, 0xA3, 0x12, 0x02, 0x32, 0x12, 0xFF, 0x32, 0x00,
+    0xF4, 5,  0x40, 0x00, 0x08, 0x91, 0x04,
+    0xF8, 2,  0x21, 0x04,
+    0x3A, 1,  0x55,                             // 16-bit pixels
+    INIT_END
+};
+
+// Sent once the panel may leave sleep
+static const uint8_t WAKE_SEQUENCE[] = {
+    0x11, INIT_DELAY | 0, 5,                    // Sleep Out, 5 ms to settle
+    0x29, 0,                                    // Display On
+    INIT_END
+};
+
 //------------------------------------------------------------------------------
 // Constructors
 //------------------------------------------------------------------------------
 
 WaveshareLCD::WaveshareLCD()
-    : _pins(), _info{0}, _initialized(false) {
+    : _pins(), _initialized(false), _warmStart(false), _beginMicros(0),
+      _transport(nullptr), _bus(nullptr), _busDevice(SPIBus::NO_DEVICE),
+      _window{0, 0, 0, 0, false}, _ramX(0), _ramY(0),
+      _ramValid(false), _ramOpen(false), _writeDepth(0), _stats{},
+      _scrollTop(0), _scrollLines(SCROLL_LINES), _scrollStart(0) {
 }
 
 WaveshareLCD::WaveshareLCD(const LCDPins& pins)
-    : _pins(pins), _info{0}, _initialized(false) {
+    : _pins(pins), _initialized(false), _warmStart(false), _beginMicros(0),
+      _transport(nullptr), _bus(nullptr), _busDevice(SPIBus::NO_DEVICE),
+      _window{0, 0, 0, 0, false}, _ramX(0), _ramY(0),
+      _ramValid(false), _ramOpen(false), _writeDepth(0), _stats{},
+      _scrollTop(0), _scrollLines(SCROLL_LINES), _scrollStart(0) {
 }
 
 //------------------------------------------------------------------------------
 // Initialization
 //------------------------------------------------------------------------------
 
-void WaveshareLCD::begin(ScanDir scanDir, uint16_t backlight) {
-    // Setup GPIO pins
-    pinMode(_pins.cs, OUTPUT);
-    pinMode(_pins.rst, OUTPUT);
-    pinMode(_pins.dc, OUTPUT);
+void WaveshareLCD::begin(ScanDir scanDir, uint16_t backlight, LCDStart start) {
+    uint32_t began = micros();
+    _warmStart = (start == LCDStart::WARM) ||
+                 (start == LCDStart::AUTO && isWarmReset());
 
-    csHigh();
+    // Setup GPIO pins; RST is high before it drives, or a warm panel resets
+    _rst.begin(_pins.rst, OUTPUT, HIGH);
+    _cs.begin(_pins.cs, OUTPUT, HIGH);
+    _dc.begin(_pins.dc, OUTPUT, LOW);
 
     // Setup PWM for backlight if pin is configured
     if (_pins.bl > 0) {
@@ -37,38 +91,202 @@ void WaveshareLCD::begin(ScanDir scanDir, uint16_t backlight) {
         ledcAttachPin(_pins.bl, 0);
     }
 
-    // Initialize SPI
-    SPI.begin();
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+    // Join the shared SPI bus; it applies the panel clock whenever we take it
+    if (_bus == nullptr) _bus = &SPIBus::shared();
+    _bus->begin();
+    if (_busDevice == SPIBus::NO_DEVICE) {
+        _busDevice = _bus->addDevice(_pins.cs,
+                                     SPISettings(LCD_SPI_CLOCK, MSBFIRST, SPI_MODE0),
+                                     onBusHandover, this);
+    }
+
+    // Bring up the DMA transport; without one every write stays blocking
+    if (_transport == nullptr) _transport = defaultTransport();
+    if (_transport != nullptr) {
+        _queue.setIdleHook(onTransferIdle, this);
+        if (!_queue.begin(_transport)) _transport = nullptr;
+    }
 
     // Hardware reset
-    reset();
+    uint32_t resetAt = 0;
+    if (!_warmStart) {
+        reset();
+        resetAt = millis();
+        delay(RESET_READY_MS);
+    }
 
     // Set backlight
     if (backlight > 255) backlight = 255;
     if (backlight > 0) setBacklight(backlight);
 
-    // Initialize LCD registers
-    initRegisters();
-
-    // Set scan direction
+    // Registers and scan direction in one batch
+    beginWrite();
+    sendSequence(INIT_SEQUENCE);
     setScanDirection(scanDir);
-    delay(200);
+    endWrite();
 
-    // Sleep out
-    writeReg(0x11);
-    delay(120);
-
-    // Display on
-    writeReg(0x29);
+    // Sleep out may not follow a reset any sooner
+    if (!_warmStart) {
+        while (millis() - resetAt < RESET_SLEEP_OUT_MS) delay(1);
+    }
+    sendSequence(WAKE_SEQUENCE);
 
     _initialized = true;
+    _beginMicros = micros() - began;
 }
 
 void WaveshareLCD::end() {
+    _queue.end();
     _initialized = false;
 }
 
+//------------------------------------------------------------------------------
+// Asynchronous transfers
+//------------------------------------------------------------------------------
+
+LCDTransport* WaveshareLCD::defaultTransport() {
+#if defined(ESP32)
+    static LCDDmaTransport dma;
+    return &dma;
+#else
+    return nullptr;
+#endif
+}
+
+void WaveshareLCD::onTransferIdle(void* context) {
+    // Last buffer is out: release the panel so touch can use the bus,
+    // unless a beginWrite() batch still owns CS
+    WaveshareLCD* lcd = static_cast<WaveshareLCD*>(context);
+    if (lcd->_writeDepth == 0) lcd->csHigh();
+}
+
+void WaveshareLCD::onBusHandover(void* context) {
+    // Another device wants the bus: let queued pixels finish first
+    static_cast<WaveshareLCD*>(context)->waitIdle();
+}
+
+void WaveshareLCD::flush(LCDFlushCallback callback, void* context) {
+    if (callback == nullptr) {
+        waitIdle();
+    } else if (_queue.isReady()) {
+        _queue.flush(callback, context);
+    } else {
+        callback(context);
+    }
+}
+
+void WaveshareLCD::poll() {
+    // Only needed for transports without a worker task
+    if (_queue.isReady() && !_transport->hasWorker()) _queue.pump(false);
+}
+
+void WaveshareLCD::waitIdle() {
+    if (_queue.isBusy()) _queue.waitIdle();
+}
+
+//------------------------------------------------------------------------------
+// Command batching
+//------------------------------------------------------------------------------
+
+void WaveshareLCD::beginWrite() {
+    waitIdle();
+    if (_writeDepth++ == 0) {
+        if (_bus != nullptr) _bus->acquire(_busDevice);
+        csLow();
+        _ramOpen = false;
+    }
+}
+
+void WaveshareLCD::endWrite() {
+    if (_writeDepth == 0) return;
+    // With a transfer still queued, onTransferIdle() releases CS instead
+    if (--_writeDepth == 0) {
+        if (!_queue.isBusy()) csHigh();
+        if (_bus != nullptr) _bus->release(_busDevice);
+    }
+}
+
+void WaveshareLCD::resetStats() {
+    _stats = LCDStats{};
+}
+
+void WaveshareLCD::sendCommand(uint8_t cmd) {
+    // Commands go out as a full 16-bit word so CS can stay low around them
+    dcCmd();
+    SPI.write16(cmd);
+    _stats.bytes += 2;
+    _stats.commands++;
+    _ramOpen = (cmd == 0x2C || cmd == 0x3C);
+}
+
+void WaveshareLCD::sendAddress(uint8_t cmd, POINT start, POINT end) {
+    uint8_t params[8] = {
+        0x00, (uint8_t)(start >> 8), 0x00, (uint8_t)(start & 0xFF),
+        0x00, (uint8_t)(end >> 8),   0x00, (uint8_t)(end & 0xFF)
+    };
+    sendCommand(cmd);
+    dcData();
+    SPI.writeBytes(params, sizeof(params));
+    _stats.bytes += sizeof(params);
+    _stats.addrSent++;
+}
+
+void WaveshareLCD::openWindow(POINT x0, POINT y0, POINT x1, POINT y1) {
+    beginWrite();
+    if (!_window.valid || _window.x0 != x0 || _window.x1 != x1) {
+        sendAddress(0x2A, x0, x1);
+    } else {
+        _stats.addrCached++;
+    }
+    if (!_window.valid || _window.y0 != y0 || _window.y1 != y1) {
+        sendAddress(0x2B, y0, y1);
+    } else {
+        _stats.addrCached++;
+    }
+    _window = Window{x0, x1, y0, y1, true};
+    sendCommand(0x2C);
+    endWrite();
+
+    _ramX = x0;
+    _ramY = y0;
+    _ramValid = (x0 <= x1 && y0 <= y1);
+}
+
+void WaveshareLCD::advanceRam(uint32_t count) {
+    if (!_ramValid) return;
+
+    uint32_t width = (uint32_t)(_window.x1 - _window.x0) + 1;
+    uint32_t size = width * ((uint32_t)(_window.y1 - _window.y0) + 1);
+    uint32_t pos = (uint32_t)(_ramY - _window.y0) * width + (_ramX - _window.x0) + count;
+
+    // Don't guess where the pointer goes once the window wraps
+    if (pos >= size) {
+        _ramValid = false;
+        return;
+    }
+    _ramX = _window.x0 + pos % width;
+    _ramY = _window.y0 + pos / width;
+}
+
+void WaveshareLCD::sendParams(uint8_t cmd, const uint16_t* values, uint8_t count) {
+    // Each 16-bit value is two parameter bytes, high first
+    sendCommand(cmd);
+    dcData();
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t params[4] = {
+            0x00, (uint8_t)(values[i] >> 8), 0x00, (uint8_t)(values[i] & 0xFF)
+        };
+        SPI.writeBytes(params, sizeof(params));
+    }
+    _stats.bytes += count * 4;
+}
+
+void WaveshareLCD::invalidateWindow() {
+    _window.valid = false;
+    _ramValid = false;
+    _ramOpen = false;
+}
+
 //------------------------------------------------------------------------------
 // Backlight control
 //------------------------------------------------------------------------------
@@ -84,142 +302,89 @@ void WaveshareLCD::setBacklight(uint16_t value) {
 // Hardware control
 //------------------------------------------------------------------------------
 
+bool WaveshareLCD::isWarmReset() {
+#if defined(ESP32)
+    // The chip restarted on its own; the panel kept power and its registers
+    switch (esp_reset_reason()) {
+        case ESP_RST_SW:
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+            return true;
+        default:
+            return false;
+    }
+#else
+    return false;
+#endif
+}
+
 void WaveshareLCD::reset() {
+    invalidateWindow();
     rstHigh();
-    delay(500);
     rstLow();
-    delay(500);
+    delayMicroseconds(RESET_PULSE_US);
     rstHigh();
-    delay(500);
 }
 
 void WaveshareLCD::writeReg(uint8_t reg) {
-    dcCmd();
-    csLow();
-    SPI.transfer(reg);
-    csHigh();
+    // The caller may be changing anything, so forget the cached window
+    beginWrite();
+    sendCommand(reg);
+    endWrite();
+    invalidateWindow();
 }
 
 void WaveshareLCD::writeData(uint8_t data) {
+    beginWrite();
     dcData();
-    csLow();
-    SPI.transfer(0x00);
-    SPI.transfer(data);
-    csHigh();
+    SPI.write16(data);
+    _stats.bytes += 2;
+    endWrite();
 }
 
 void WaveshareLCD::writeAllData(uint16_t data, uint32_t len) {
+    beginWrite();
     dcData();
-    csLow();
-    for (uint32_t i = 0; i < len; i++) {
-        SPI.write16(data);
+    _stats.bytes += len * 2;
+    if (_queue.isReady() && len >= ASYNC_MIN_PIXELS) {
+        // CS stays low until onTransferIdle()
+        _queue.pushColor(data, len);
+    } else {
+        for (uint32_t i = 0; i < len; i++) {
+            SPI.write16(data);
+        }
     }
-    csHigh();
+    advanceRam(len);
+    endWrite();
 }
 
-void WaveshareLCD::initRegisters() {
-    writeReg(0xF9);
-    writeData(0x00);
-    writeData(0x08);
-
-    writeReg(0xC0);
-    writeData(0x19);
-    writeData(0x1a);
-
-    writeReg(0xC1);
-    writeData(0x45);
-    writeData(0x00);
-
-    writeReg(0xC2);
-    writeData(0x33);
-
-    writeReg(0xC5);
-    writeData(0x00);
-    writeData(0x28);
-
-    writeReg(0xB1);
-    writeData(0xA0);
-    writeData(0x11);
-
-    writeReg(0xB4);
-    writeData(0x02);
-
-    writeReg(0xB6);
-    writeData(0x00);
-    writeData(0x42);
-    writeData(0x3B);
-
-    writeReg(0xB7);
-    writeData(0x07);
-
-    writeReg(0xE0);
-    writeData(0x1F);
-    writeData(0x25);
-    writeData(0x22);
-    writeData(0x0B);
-    writeData(0x06);
-    writeData(0x0A);
-    writeData(0x4E);
-    writeData(0xC6);
-    writeData(0x39);
-    writeData(0x00);
-    writeData(0x00);
-    writeData(0x00);
-    writeData(0x00);
-    writeData(0x00);
-    writeData(0x00);
-
-    writeReg(0xE1);
-    writeData(0x1F);
-    writeData(0x3F);
-    writeData(0x3F);
-    writeData(0x0F);
-    writeData(0x1F);
-    writeData(0x0F);
-    writeData(0x46);
-    writeData(0x49);
-    writeData(0x31);
-    writeData(0x05);
-    writeData(0x09);
-    writeData(0x03);
-    writeData(0x1C);
-    writeData(0x1A);
-    writeData(0x00);
-
-    writeReg(0xF1);
-    writeData(0x36);
-    writeData(0x04);
-    writeData(0x00);
-    writeData(0x3C);
-    writeData(0x0F);
-    writeData(0x0F);
-    writeData(0xA4);
-    writeData(0x02);
-
-    writeReg(0xF2);
-    writeData(0x18);
-    writeData(0xA3);
-    writeData(0x12);
-    writeData(0x02);
-    writeData(0x32);
-    writeData(0x12);
-    writeData(0xFF);
-    writeData(0x32);
-    writeData(0x00);
-
-    writeReg(0xF4);
-    writeData(0x40);
-    writeData(0x00);
-    writeData(0x08);
-    writeData(0x91);
-    writeData(0x04);
-
-    writeReg(0xF8);
-    writeData(0x21);
-    writeData(0x04);
-
-    writeReg(0x3A);
-    writeData(0x55);
+void WaveshareLCD::sendSequence(const uint8_t* sequence) {
+    // One command per entry; every parameter byte becomes a 16-bit word
+    uint8_t params[2 * INIT_MAX_PARAMS];
+
+    beginWrite();
+    while (sequence[0] != INIT_END) {
+        uint8_t count = sequence[1] & ~INIT_DELAY;
+        sendCommand(sequence[0]);
+        if (count > 0) {
+            for (uint8_t i = 0; i < count; i++) {
+                params[2 * i] = 0x00;
+                params[2 * i + 1] = sequence[2 + i];
+            }
+            dcData();
+            SPI.writeBytes(params, 2 * count);
+            _stats.bytes += 2 * count;
+        }
+        if (sequence[1] & INIT_DELAY) {
+            delay(sequence[2 + count]);
+            sequence++;
+        }
+        sequence += 2 + count;
+    }
+    endWrite();
+    invalidateWindow();
 }
 
 //------------------------------------------------------------------------------
@@ -278,391 +443,140 @@ void WaveshareLCD::setScanDirection(ScanDir dir) {
     }
 
     // Write to registers
+    beginWrite();
     writeReg(0xB6);
     writeData(0x00);
     writeData(disFunReg);
 
     writeReg(0x36);
     writeData(memoryAccessReg);
+    endWrite();
 }
 
 //------------------------------------------------------------------------------
-// Screen control
+// Hardware scrolling
 //------------------------------------------------------------------------------
 
-void WaveshareLCD::clear(COLOR color) {
-    fillArea(0, 0, _info.width, _info.height, color);
+bool WaveshareLCD::isScrollVertical() const {
+    // Portrait directions keep MV clear, so memory lines are screen rows
+    ScanDir dir = _info.scanDir;
+    return dir == ScanDir::L2R_U2D || dir == ScanDir::L2R_D2U ||
+           dir == ScanDir::R2L_U2D || dir == ScanDir::R2L_D2U;
 }
 
-void WaveshareLCD::setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
-    writeReg(0x2A);
-    writeData(xStart >> 8);
-    writeData(xStart & 0xFF);
-    writeData((xEnd - 1) >> 8);
-    writeData((xEnd - 1) & 0xFF);
+void WaveshareLCD::setScrollArea(LENGTH topFixed, LENGTH bottomFixed) {
+    if ((uint32_t)topFixed + bottomFixed >= SCROLL_LINES) return;
 
-    writeReg(0x2B);
-    writeData(yStart >> 8);
-    writeData(yStart & 0xFF);
-    writeData((yEnd - 1) >> 8);
-    writeData((yEnd - 1) & 0xFF);
+    _scrollTop = topFixed;
+    _scrollLines = SCROLL_LINES - topFixed - bottomFixed;
+    uint16_t params[3] = { topFixed, _scrollLines, bottomFixed };
 
-    writeReg(0x2C);
+    // The RAM pointer and window survive; only the open write ends
+    beginWrite();
+    sendParams(0x33, params, 3);
+    endWrite();
+    scrollTo(_scrollTop);
 }
 
-void WaveshareLCD::setCursor(POINT x, POINT y) {
-    setWindow(x, y, x, y);
-}
+void WaveshareLCD::scrollTo(POINT line) {
+    if (line < _scrollTop || line >= _scrollTop + _scrollLines) return;
 
-void WaveshareLCD::setWindowColor(COLOR color, POINT width, POINT height) {
-    writeAllData(color, (uint32_t)width * (uint32_t)height);
+    _scrollStart = line;
+    beginWrite();
+    sendParams(0x37, &_scrollStart, 1);
+    endWrite();
 }
 
-void WaveshareLCD::setPixel(POINT x, POINT y, COLOR color) {
-    if (x <= _info.width && y <= _info.height) {
-        setCursor(x, y);
-        setWindowColor(color, 1, 1);
-    }
-}
+void WaveshareLCD::endScroll() {
+    _scrollTop = 0;
+    _scrollLines = SCROLL_LINES;
+    _scrollStart = 0;
 
-void WaveshareLCD::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) {
-    if (xEnd > xStart && yEnd > yStart) {
-        setWindow(xStart, yStart, xEnd, yEnd);
-        setWindowColor(color, xEnd - xStart + 1, yEnd - yStart + 1);
-    }
+    // Normal Display Mode On leaves scroll mode
+    beginWrite();
+    sendCommand(0x13);
+    endWrite();
 }
 
 //------------------------------------------------------------------------------
-// Drawing primitives
+// Screen control
 //------------------------------------------------------------------------------
 
-void WaveshareLCD::swapPoints(POINT& p1, POINT& p2) {
-    POINT temp = p1;
-    p1 = p2;
-    p2 = temp;
-}
-
-void WaveshareLCD::drawPoint(POINT x, POINT y, COLOR color,
-                              DotPixel dotSize, DotStyle dotStyle) {
-    if (x > _info.width || y > _info.height) {
-        return;
-    }
-
-    int16_t xDir, yDir;
-    uint8_t size = static_cast<uint8_t>(dotSize);
-
-    if (dotStyle == DotStyle::FILL_AROUND) {
-        for (xDir = 0; xDir < 2 * size - 1; xDir++) {
-            for (yDir = 0; yDir < 2 * size - 1; yDir++) {
-                setPixel(x + xDir - size, y + yDir - size, color);
-            }
-        }
-    } else {
-        for (xDir = 0; xDir < size; xDir++) {
-            for (yDir = 0; yDir < size; yDir++) {
-                setPixel(x + xDir - 1, y + yDir - 1, color);
-            }
-        }
-    }
+void WaveshareLCD::setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
+    openWindow(xStart, yStart, xEnd - 1, yEnd - 1);
 }
 
-void WaveshareLCD::drawHorizontalLine(POINT xStart, POINT xEnd, POINT y,
-                                       COLOR color, LineStyle style,
-                                       DotPixel dotSize) {
-    uint8_t size = static_cast<uint8_t>(dotSize);
-    if (style == LineStyle::SOLID) {
-        fillArea(xStart, y, xEnd, y + size, color);
-    } else {
-        POINT x;
-        for (x = xStart; x <= xEnd - size; x += 2 * size) {
-            fillArea(x, y, x + size, y + size, color);
-        }
-        if (x < xEnd) {
-            fillArea(x, y, xEnd, y + size, color);
-        }
-    }
+void WaveshareLCD::setCursor(POINT x, POINT y) {
+    setWindow(x, y, x, y);
 }
 
-void WaveshareLCD::drawVerticalLine(POINT x, POINT yStart, POINT yEnd,
-                                     COLOR color, LineStyle style,
-                                     DotPixel dotSize) {
-    uint8_t size = static_cast<uint8_t>(dotSize);
-    if (style == LineStyle::SOLID) {
-        fillArea(x, yStart, x + size, yEnd, color);
-    } else {
-        POINT y;
-        for (y = yStart; y <= yEnd - size; y += 2 * size) {
-            fillArea(x, y, x + size, y + size, color);
-        }
-        if (y < yEnd) {
-            fillArea(x, y, x + size, yEnd, color);
-        }
-    }
+void WaveshareLCD::setWindowColor(COLOR color, POINT width, POINT height) {
+    writeAllData(color, (uint32_t)width * (uint32_t)height);
 }
 
-void WaveshareLCD::drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
-                             COLOR color, LineStyle lineStyle, DotPixel dotSize) {
-    if (xStart > _info.width || yStart > _info.height ||
-        xEnd > _info.width || yEnd > _info.height) {
-        return;
-    }
-
-    if (xStart > xEnd) swapPoints(xStart, xEnd);
-    if (yStart > yEnd) swapPoints(yStart, yEnd);
-
-    if (yStart == yEnd) {
-        drawHorizontalLine(xStart, xEnd, yStart, color, lineStyle, dotSize);
-        return;
-    }
-
-    if (xStart == xEnd) {
-        drawVerticalLine(xStart, yStart, yEnd, color, lineStyle, dotSize);
-        return;
-    }
-
-    // Bresenham's line algorithm for diagonal lines
-    POINT xPoint = xStart;
-    POINT yPoint = yStart;
-    int dx = (int)xEnd - (int)xStart >= 0 ? xEnd - xStart : xStart - xEnd;
-    int dy = (int)yEnd - (int)yStart <= 0 ? yEnd - yStart : yStart - yEnd;
-
-    int xAddWay = xStart < xEnd ? 1 : -1;
-    int yAddWay = yStart < yEnd ? 1 : -1;
-
-    int esp = dx + dy;
-    char lineStyleTemp = 0;
-
-    for (;;) {
-        lineStyleTemp++;
-        if (lineStyle == LineStyle::DOTTED && lineStyleTemp % 3 == 0) {
-            drawPoint(xPoint, yPoint, LCD_BACKGROUND, dotSize, DOT_STYLE_DEFAULT);
-            lineStyleTemp = 0;
+void WaveshareLCD::setPixel(POINT x, POINT y, COLOR color) {
+    if (x <= _info.width && y <= _info.height) {
+        beginWrite();
+        if (_ramValid && _ramX == x && _ramY == y) {
+            // Next pixel of the open row: no address update needed
+            if (!_ramOpen) sendCommand(0x3C);
+            _stats.continues++;
         } else {
-            drawPoint(xPoint, yPoint, color, dotSize, DOT_STYLE_DEFAULT);
-        }
-
-        if (2 * esp >= dy) {
-            if (xPoint == xEnd) break;
-            esp += dy;
-            xPoint += xAddWay;
-        }
-        if (2 * esp <= dx) {
-            if (yPoint == yEnd) break;
-            esp += dx;
-            yPoint += yAddWay;
+            // Open the rest of the row so following pixels can continue
+            openWindow(x, y, (x < _info.width) ? _info.width - 1 : x, y);
         }
+        writeAllData(color, 1);
+        endWrite();
     }
 }
 
-void WaveshareLCD::drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
-                                  COLOR color, DrawFill fill,
-                                  DotPixel dotSize, LineStyle lineStyle) {
-    if (xStart > _info.width || yStart > _info.height ||
-        xEnd > _info.width || yEnd > _info.height) {
-        return;
-    }
-
-    if (xStart > xEnd) swapPoints(xStart, xEnd);
-    if (yStart > yEnd) swapPoints(yStart, yEnd);
-
-    uint8_t size = static_cast<uint8_t>(dotSize);
-
-    if (fill == DrawFill::FULL) {
-        fillArea(xStart, yStart, xEnd, yEnd, color);
-    } else {
-        drawLine(xStart, yStart, xEnd + size, yStart, color, lineStyle, dotSize);
-        drawLine(xStart, yStart, xStart, yEnd + size, color, lineStyle, dotSize);
-        drawLine(xEnd, yEnd + size, xEnd, yStart, color, lineStyle, dotSize);
-        drawLine(xEnd + size, yEnd, xStart, yEnd, color, lineStyle, dotSize);
-    }
-}
-
-void WaveshareLCD::drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
-                               COLOR color, DrawFill fill, DotPixel dotSize) {
-    if (xCenter > _info.width || yCenter >= _info.height) {
-        return;
-    }
-
-    int16_t xCurrent = 0;
-    int16_t yCurrent = radius;
-    int16_t esp = 3 - (radius << 1);
-    int16_t sCountY;
-
-    if (fill == DrawFill::FULL) {
-        while (xCurrent <= yCurrent) {
-            for (sCountY = xCurrent; sCountY <= yCurrent; sCountY++) {
-                drawPoint(xCenter + xCurrent, yCenter + sCountY, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter - xCurrent, yCenter + sCountY, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter - sCountY, yCenter + xCurrent, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter - sCountY, yCenter - xCurrent, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter - xCurrent, yCenter - sCountY, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter + xCurrent, yCenter - sCountY, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter + sCountY, yCenter - xCurrent, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(xCenter + sCountY, yCenter + xCurrent, color, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-            }
-            if (esp < 0) {
-                esp += 4 * xCurrent + 6;
-            } else {
-                esp += 10 + 4 * (xCurrent - yCurrent);
-                yCurrent--;
-            }
-            xCurrent++;
-        }
-    } else {
-        while (xCurrent <= yCurrent) {
-            drawPoint(xCenter + xCurrent, yCenter + yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter - xCurrent, yCenter + yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter - yCurrent, yCenter + xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter - yCurrent, yCenter - xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter - xCurrent, yCenter - yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter + xCurrent, yCenter - yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter + yCurrent, yCenter - xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-            drawPoint(xCenter + yCurrent, yCenter + xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
-
-            if (esp < 0) {
-                esp += 4 * xCurrent + 6;
-            } else {
-                esp += 10 + 4 * (xCurrent - yCurrent);
-                yCurrent--;
-            }
-            xCurrent++;
-        }
+void WaveshareLCD::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) {
+    if (xEnd > xStart && yEnd > yStart) {
+        beginWrite();
+        setWindow(xStart, yStart, xEnd, yEnd);
+        setWindowColor(color, xEnd - xStart, yEnd - yStart);
+        endWrite();
     }
 }
 
 //------------------------------------------------------------------------------
-// Text and numbers
+// Bulk pixel transfer
 //------------------------------------------------------------------------------
 
-void WaveshareLCD::drawChar(POINT x, POINT y, char ch,
-                             sFONT* font, COLOR bgColor, COLOR fgColor) {
-    if (x > _info.width || y > _info.height) {
-        return;
-    }
+void WaveshareLCD::pushPixels(const COLOR* pixels, uint32_t count, bool swapped) {
+    if (pixels == nullptr || count == 0) return;
 
-    uint32_t charOffset = (ch - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[charOffset];
-
-    for (POINT page = 0; page < font->Height; page++) {
-        for (POINT col = 0; col < font->Width; col++) {
-            if (FONT_BACKGROUND == bgColor) {
-                if (pgm_read_byte(ptr) & (0x80 >> (col % 8))) {
-                    drawPoint(x + col, y + page, fgColor, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                }
-            } else {
-                if (pgm_read_byte(ptr) & (0x80 >> (col % 8))) {
-                    drawPoint(x + col, y + page, fgColor, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                } else {
-                    drawPoint(x + col, y + page, bgColor, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                }
-            }
-            if (col % 8 == 7) ptr++;
-        }
-        if (font->Width % 8 != 0) ptr++;
+    beginWrite();
+    dcData();
+    _stats.bytes += count * 2;
+    if (_queue.isReady() && count >= ASYNC_MIN_PIXELS) {
+        // CS stays low until onTransferIdle()
+        _queue.pushPixels(pixels, count, swapped);
+    } else if (swapped) {
+        SPI.writeBytes(reinterpret_cast<const uint8_t*>(pixels), count * 2);
+    } else {
+        SPI.writePixels(pixels, count * 2);
     }
+    advanceRam(count);
+    endWrite();
 }
 
-void WaveshareLCD::drawString(POINT x, POINT y, const char* str,
-                               sFONT* font, COLOR bgColor, COLOR fgColor) {
-    POINT xPoint = x;
-    POINT yPoint = y;
-
-    if (x > _info.width || y > _info.height) {
-        return;
-    }
-
-    while (*str != '\0') {
-        if ((xPoint + font->Width) > _info.width) {
-            xPoint = x;
-            yPoint += font->Height;
-        }
-        if ((yPoint + font->Height) > _info.height) {
-            xPoint = x;
-            yPoint = y;
-        }
-        drawChar(xPoint, yPoint, *str, font, bgColor, fgColor);
-        str++;
-        xPoint += font->Width;
-    }
+void WaveshareLCD::pushColor(COLOR color, uint32_t count) {
+    if (count > 0) writeAllData(color, count);
 }
 
-void WaveshareLCD::drawNumber(POINT x, POINT y, int32_t number,
-                               sFONT* font, COLOR bgColor, COLOR fgColor) {
-    char strArray[256] = {0};
-    char numArray[256] = {0};
-    int16_t numBit = 0, strBit = 0;
-
-    if (x > _info.width || y > _info.height) {
+void WaveshareLCD::pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs) {
+    if (indices == nullptr || pairs == nullptr || count == 0) return;
+    if (!_queue.isReady() || count < ASYNC_MIN_PIXELS) {
+        LCDSurface::pushIndexed(indices, count, pairs);
         return;
     }
 
-    while (number) {
-        numArray[numBit] = number % 10 + '0';
-        numBit++;
-        number /= 10;
-    }
-
-    while (numBit > 0) {
-        strArray[strBit] = numArray[numBit - 1];
-        strBit++;
-        numBit--;
-    }
-
-    drawString(x, y, strArray, font, bgColor, fgColor);
-}
-
-//------------------------------------------------------------------------------
-// Bitmap display
-//------------------------------------------------------------------------------
-
-void WaveshareLCD::drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
-                               POINT width, POINT height) {
-    POINT i, j, byteWidth = (width + 7) / 8;
-    for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            if (*(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-                drawPoint(x + i, y + j, Colors::WHITE, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-            }
-        }
-    }
-}
-
-void WaveshareLCD::drawGrayMap(POINT x, POINT y, const uint8_t* graymap) {
-    char gray = *(graymap + 1);
-    POINT width = (*(graymap + 3) << 8) | (*(graymap + 2));
-    POINT height = (*(graymap + 5) << 8) | (*(graymap + 4));
-
-    if (gray == 0x04) {
-        graymap = graymap + 6;
-        for (POINT j = 0; j < height; j++) {
-            for (POINT i = 0; i < width / 2; i++) {
-                drawPoint(x + i * 2, y + j, ~(*graymap >> 4), DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                drawPoint(x + i * 2 + 1, y + j, ~*graymap, DOT_PIXEL_DEFAULT, DOT_STYLE_DEFAULT);
-                graymap++;
-            }
-        }
-    }
-}
-
-//------------------------------------------------------------------------------
-// Utility functions
-//------------------------------------------------------------------------------
-
-sFONT* WaveshareLCD::getFontForSize(POINT dx, POINT dy) {
-    if (dx > Font24.Width && dy > Font24.Height) {
-        return &Font24;
-    } else if (dx > Font20.Width && dx < Font24.Width &&
-               dy > Font20.Height && dy < Font24.Height) {
-        return &Font20;
-    } else if (dx > Font16.Width && dx < Font20.Width &&
-               dy > Font16.Height && dy < Font20.Height) {
-        return &Font16;
-    } else if (dx > Font12.Width && dx < Font16.Width &&
-               dy > Font12.Height && dy < Font16.Height) {
-        return &Font12;
-    } else if (dx > Font8.Width && dx < Font12.Width &&
-               dy > Font8.Height && dy < Font12.Height) {
-        return &Font8;
-    }
-    return nullptr;
+    beginWrite();
+    dcData();
+    _stats.bytes += count * 2;
+    // CS stays low until onTransferIdle()
+    _queue.pushIndexed(indices, count, pairs);
+    advanceRam(count);
+    endWrite();
 }
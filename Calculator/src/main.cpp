@@ -28,6 +28,13 @@ void setup() {
     // Initialize the calculator application
     app.begin();
 
+    // Boot-to-first-frame; millis() counts from the chip reset
+    WaveshareLCD& lcd = app.getLCD().getLCD();
+    lcd.waitIdle();
+    Serial.printf("[BOOT] LCD %s start %lu us, first frame at %lu ms\n",
+                  lcd.wasWarmStart() ? "warm" : "cold",
+                  (unsigned long)lcd.getBeginMicros(), millis());
+
     Serial.println("Calculator Ready!");
 }
 
@@ -0,0 +1,42 @@
+/*****************************************************************************
+ * | File        : Arduino.cpp
+ * | Function    : Host stand-in for the ESP32 Arduino core
+ *****************************************************************************/
+
+#include "Arduino.h"
+
+uint64_t hostMicros = 0;
+HardwareSerial Serial;
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = 0;
+    while (size-- > 0) {
+        written += write(*buffer++);
+    }
+    return written;
+}
+
+size_t Print::printf(const char* format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return write(text);
+}
+
+size_t Print::print(long value)
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    return write(text);
+}
+
+size_t Print::print(double value, int digits)
+{
+    char text[40];
+    snprintf(text, sizeof(text), "%.*f", digits, value);
+    return write(text);
+}
@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * | File        : Arduino.h
+ * | Function    : Host stand-in for the parts of the ESP32 Arduino core the
+ * |               display libraries use
+ * | Info        : Pins and SPI are recorded by BusRecorder; time is simulated
+ * |
+ * | delay() and delayMicroseconds() only move the simulated clock that
+ * | millis() and micros() read, so a reset sequence costs nothing on the
+ * | host and its length still shows in the numbers. Serial prints to
+ * | stdout.
+ *****************************************************************************/
+
+#ifndef __HOST_ARDUINO_H
+#define __HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "BusRecorder.h"
+
+#define HIGH            0x1
+#define LOW             0x0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+
+#define PROGMEM
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define pgm_read_byte(addr)     (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr)    (*(const uint32_t*)(addr))
+
+#define DEG_TO_RAD      0.017453292519943295769236907684886
+#define RAD_TO_DEG      57.295779513082320876798154814105
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+//------------------------------------------------------------------------------
+// Pins
+//------------------------------------------------------------------------------
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t pin, uint8_t level) { BusRecorder::instance().pinWrite(pin, level); }
+inline int digitalRead(uint8_t pin) { return BusRecorder::instance().pinRead(pin); }
+
+inline double ledcSetup(uint8_t, double frequency, uint8_t) { return frequency; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+
+//------------------------------------------------------------------------------
+// Time
+//------------------------------------------------------------------------------
+extern uint64_t hostMicros;
+
+inline void delay(uint32_t ms) { hostMicros += ms * 1000ull; }
+inline void delayMicroseconds(uint32_t us) { hostMicros += us; }
+inline unsigned long millis() { return (unsigned long)(hostMicros / 1000); }
+inline unsigned long micros() { return (unsigned long)hostMicros; }
+inline void yield() {}
+
+//------------------------------------------------------------------------------
+// Heap
+//------------------------------------------------------------------------------
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 4 * 1024 * 1024; }
+
+//------------------------------------------------------------------------------
+// Serial
+//------------------------------------------------------------------------------
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char* str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long value);
+    size_t print(double value, int digits = 2);
+    size_t println() { return write("\r\n"); }
+    template <class T> size_t println(T value) { return print(value) + println(); }
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    void flush() { fflush(stdout); }
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // __HOST_ARDUINO_H
@@ -0,0 +1,145 @@
+/*****************************************************************************
+ * | File        : BusRecorder.cpp
+ * | Function    : Records what the host stubs of SPI and the GPIOs are asked to do
+ *****************************************************************************/
+
+#include "BusRecorder.h"
+#include <string.h>
+
+// ILI9486 commands the counters tell apart
+#define CMD_CASET   0x2A
+#define CMD_PASET   0x2B
+#define CMD_RAMWR   0x2C
+#define CMD_RAMWRC  0x3C
+
+BusRecorder::Counters BusRecorder::Counters::operator-(const Counters& other) const
+{
+    Counters diff;
+    diff.bytes = bytes - other.bytes;
+    diff.transactions = transactions - other.transactions;
+    diff.csToggles = csToggles - other.csToggles;
+    diff.windows = windows - other.windows;
+    diff.commands = commands - other.commands;
+    diff.addressCommands = addressCommands - other.addressCommands;
+    diff.pixels = pixels - other.pixels;
+    diff.busNanos = busNanos - other.busNanos;
+    return diff;
+}
+
+BusRecorder& BusRecorder::instance()
+{
+    static BusRecorder recorder;
+    return recorder;
+}
+
+BusRecorder::BusRecorder()
+    : _panelCs(NO_PIN)
+    , _panelDc(NO_PIN)
+    , _clock(1000000)           // SPI.begin() default
+    , _miso(0)
+    , _sink(nullptr)
+    , _haveHigh(false)
+    , _high(0)
+    , _command(0)
+    , _addressed(false)
+{
+    memset(&_counters, 0, sizeof(_counters));
+    memset(_level, 1, sizeof(_level));          // Pulled up until driven
+    memset(_chipSelect, 0, sizeof(_chipSelect));
+}
+
+void BusRecorder::watchPanel(uint8_t cs, uint8_t dc)
+{
+    _panelCs = cs;
+    _panelDc = dc;
+    watchChipSelect(cs);
+}
+
+void BusRecorder::watchChipSelect(uint8_t cs)
+{
+    if (cs < PINS) _chipSelect[cs] = true;
+}
+
+void BusRecorder::setInput(uint8_t pin, uint8_t level)
+{
+    if (pin < PINS) _level[pin] = level ? 1 : 0;
+}
+
+void BusRecorder::resetCounters()
+{
+    memset(&_counters, 0, sizeof(_counters));
+}
+
+//------------------------------------------------------------------------------
+// Stub hooks
+//------------------------------------------------------------------------------
+void BusRecorder::pinWrite(uint8_t pin, uint8_t level)
+{
+    if (pin >= PINS) return;
+    level = level ? 1 : 0;
+    if (_level[pin] == level) return;
+    _level[pin] = level;
+
+    if (!_chipSelect[pin]) return;
+    _counters.csToggles++;
+
+    if (pin == _panelCs) {
+        // A command goes out as one byte by the legacy driver; CS going
+        // high ends it. A new selection starts a new word.
+        if (level == 1 && _haveHigh) {
+            panelWord(_high, _level[_panelDc] == 1);
+        }
+        _haveHigh = false;
+    }
+}
+
+uint8_t BusRecorder::pinRead(uint8_t pin) const
+{
+    return pin < PINS ? _level[pin] : 1;
+}
+
+void BusRecorder::beginTransaction(uint32_t clock)
+{
+    _counters.transactions++;
+    if (clock > 0) _clock = clock;
+}
+
+uint8_t BusRecorder::transfer(uint8_t data)
+{
+    _counters.bytes++;
+    _counters.busNanos += 8000000000ull / _clock;
+
+    if (_panelCs < PINS && _level[_panelCs] == 0) {
+        if (!_haveHigh) {
+            _high = data;
+            _haveHigh = true;
+        } else {
+            _haveHigh = false;
+            panelWord((uint16_t)(_high << 8) | data, _level[_panelDc] == 1);
+        }
+    }
+    return _miso;
+}
+
+//------------------------------------------------------------------------------
+// Panel stream
+//------------------------------------------------------------------------------
+void BusRecorder::panelWord(uint16_t word, bool data)
+{
+    if (_sink != nullptr) _sink->panelWord(word, data);
+
+    if (data) {
+        if (_command == CMD_RAMWR || _command == CMD_RAMWRC) _counters.pixels++;
+        return;
+    }
+
+    _command = word & 0xFF;
+    _counters.commands++;
+    if (_command == CMD_CASET || _command == CMD_PASET) {
+        _counters.addressCommands++;
+        _addressed = true;
+    } else if (_command == CMD_RAMWR && _addressed) {
+        _counters.windows++;
+        _addressed = false;
+    }
+}
@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * | File        : BusRecorder.h
+ * | Function    : Records what the host stubs of SPI and the GPIOs are asked to do
+ * | Info        : Counts the traffic the drivers would put on the wire
+ * |
+ * | On the host, SPI.h and Arduino.h are stubs that report every byte,
+ * | transaction and pin edge here. The recorder counts them and follows
+ * | the panel's command stream (16-bit words, D/C low for a command), so a
+ * | drawing call can be measured without hardware:
+ * |
+ * |   BusRecorder& bus = BusRecorder::instance();
+ * |   bus.watchPanel(15, 17);              // Panel CS and D/C
+ * |   bus.watchChipSelect(4);              // Touch CS
+ * |   BusRecorder::Counters before = bus.getCounters();
+ * |   lcd.drawLine(0, 0, 479, 319, Colors::RED);
+ * |   BusRecorder::Counters line = bus.getCounters() - before;
+ * |
+ * | A window is a RAMWR (0x2C) with a CASET or PASET since the last one:
+ * | what it took to address a new area. busNanos is the time the bytes
+ * | take on the wire at the clock of the transaction they were sent in.
+ * |
+ * | The decoded words can also be handed on, to a model of the panel:
+ * |
+ * |   bus.setPanelSink(&panel);            // panel.panelWord(word, data)
+ *****************************************************************************/
+
+#ifndef __BUS_RECORDER_H
+#define __BUS_RECORDER_H
+
+#include <stdint.h>
+
+// Receives the panel stream as the shift register latches it: one 16-bit
+// word at a time, D/C high for data
+class PanelSink {
+public:
+    virtual ~PanelSink() = default;
+    virtual void panelWord(uint16_t word, bool data) = 0;
+};
+
+class BusRecorder {
+public:
+    static constexpr uint8_t PINS = 64;
+    static constexpr uint8_t NO_PIN = 0xFF;
+
+    struct Counters {
+        uint64_t bytes;             // Clocked out on MOSI, any device
+        uint64_t transactions;      // SPI.beginTransaction() calls
+        uint64_t csToggles;         // Edges of the watched chip selects
+        uint64_t windows;           // Address windows opened for RAMWR
+        uint64_t commands;          // Panel command words
+        uint64_t addressCommands;   // CASET and PASET
+        uint64_t pixels;            // Data words after RAMWR / RAMWRC
+        uint64_t busNanos;          // Time on the wire
+
+        Counters operator-(const Counters& other) const;
+    };
+
+    static BusRecorder& instance();
+
+    // Which pins to follow. The panel stream is decoded on 'cs' and 'dc'.
+    void watchPanel(uint8_t cs, uint8_t dc);
+    void watchChipSelect(uint8_t cs);
+
+    // What digitalRead() and SPI.transfer() give back
+    void setInput(uint8_t pin, uint8_t level);
+    void setMiso(uint8_t value) { _miso = value; }
+
+    const Counters& getCounters() const { return _counters; }
+
+    // Clock of the last SPI.beginTransaction()
+    uint32_t getClock() const { return _clock; }
+    void resetCounters();
+
+    // Where the decoded panel words go besides the counters; nullptr for none
+    void setPanelSink(PanelSink* sink) { _sink = sink; }
+
+    //--------------------------------------------------------------------------
+    // Called by the stubs
+    //--------------------------------------------------------------------------
+    void pinWrite(uint8_t pin, uint8_t level);
+    uint8_t pinRead(uint8_t pin) const;
+    void beginTransaction(uint32_t clock);
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data);
+
+private:
+    BusRecorder();
+
+    Counters _counters;
+    uint8_t _level[PINS];
+    bool _chipSelect[PINS];
+    uint8_t _panelCs;
+    uint8_t _panelDc;
+    uint32_t _clock;
+    uint8_t _miso;
+    PanelSink* _sink;
+
+    // Panel stream decoder
+    bool _haveHigh;             // First byte of a word received
+    uint8_t _high;
+    uint8_t _command;
+    bool _addressed;            // CASET/PASET since the last RAMWR
+
+    void panelWord(uint16_t word, bool data);
+};
+
+#endif // __BUS_RECORDER_H
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * | File        : SPI.cpp
+ * | Function    : Host stand-in for the ESP32 SPIClass
+ *****************************************************************************/
+
+#include "SPI.h"
+
+SPIClass SPI;
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+    uint16_t in = transfer(data >> 8) << 8;
+    return in | transfer(data & 0xFF);
+}
+
+void SPIClass::transferBytes(const uint8_t* data, uint8_t* out, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        uint8_t in = transfer(data != nullptr ? data[i] : 0xFF);
+        if (out != nullptr) out[i] = in;
+    }
+}
+
+void SPIClass::writeBytes(const uint8_t* data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        transfer(data[i]);
+    }
+}
+
+void SPIClass::writePixels(const void* data, uint32_t size)
+{
+    // 'size' is in bytes; the pixels are 16-bit words in CPU order
+    const uint16_t* pixels = (const uint16_t*)data;
+    for (uint32_t i = 0; i < size / 2; i++) {
+        transfer16(pixels[i]);
+    }
+}
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * | File        : SPI.h
+ * | Function    : Host stand-in for the ESP32 SPIClass
+ * | Info        : Every byte and transaction goes to BusRecorder
+ * |
+ * | Multi-byte writes go out most significant byte first, as on the
+ * | ESP32: write16(0x1234) clocks 0x12, then 0x34. writePixels() sends
+ * | 16-bit words the same way; writeBytes() sends memory in order.
+ *****************************************************************************/
+
+#ifndef __HOST_SPI_H
+#define __HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0   0x00
+#define SPI_MODE1   0x01
+#define SPI_MODE2   0x02
+#define SPI_MODE3   0x03
+#define SPI_MSBFIRST    1
+#define SPI_LSBFIRST    0
+#define MSBFIRST    SPI_MSBFIRST
+#define LSBFIRST    SPI_LSBFIRST
+
+class SPISettings {
+public:
+    SPISettings() : _clock(1000000), _bitOrder(MSBFIRST), _dataMode(SPI_MODE0) {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+        : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+
+    uint32_t _clock;
+    uint8_t _bitOrder;
+    uint8_t _dataMode;
+};
+
+class SPIClass {
+public:
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+
+    void beginTransaction(SPISettings settings) { BusRecorder::instance().beginTransaction(settings._clock); }
+    void endTransaction() { BusRecorder::instance().endTransaction(); }
+
+    uint8_t transfer(uint8_t data) { return BusRecorder::instance().transfer(data); }
+    uint16_t transfer16(uint16_t data);
+    void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size);
+
+    void write(uint8_t data) { transfer(data); }
+    void write16(uint16_t data) { transfer16(data); }
+    void writeBytes(const uint8_t* data, uint32_t size);
+    void writePixels(const void* data, uint32_t size);
+};
+
+extern SPIClass SPI;
+
+#endif // __HOST_SPI_H
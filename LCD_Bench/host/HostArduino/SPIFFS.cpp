@@ -0,0 +1,8 @@
+/*****************************************************************************
+ * | File        : SPIFFS.cpp
+ * | Function    : Host stand-in for the ESP32 SPIFFS file system
+ *****************************************************************************/
+
+#include "SPIFFS.h"
+
+SPIFFSFS SPIFFS;
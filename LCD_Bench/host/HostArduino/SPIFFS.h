@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * | File        : SPIFFS.h
+ * | Function    : Host stand-in for the ESP32 SPIFFS file system
+ * | Info        : An empty file system: every open() fails
+ * |
+ * | The legacy BMP code reads files from SPIFFS or from a BmpMF memory
+ * | file. The bench uses the memory file; this only lets the file
+ * | variant build.
+ *****************************************************************************/
+
+#ifndef __HOST_SPIFFS_H
+#define __HOST_SPIFFS_H
+
+#include "Arduino.h"
+
+class File {
+public:
+    operator bool() const { return false; }
+    int available() { return 0; }
+    bool seek(uint32_t) { return false; }
+    size_t position() const { return 0; }
+    size_t size() const { return 0; }
+    size_t read(uint8_t*, size_t) { return 0; }
+    int read() { return -1; }
+    size_t readBytes(char*, size_t) { return 0; }
+    size_t write(const uint8_t*, size_t) { return 0; }
+    void close() {}
+};
+
+class SPIFFSFS {
+public:
+    bool begin(bool formatOnFail = false) { return false; }
+    File open(const char*, const char* mode = "r") { return File(); }
+    bool exists(const char*) { return false; }
+    bool remove(const char*) { return false; }
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // __HOST_SPIFFS_H
@@ -0,0 +1,8 @@
+/*****************************************************************************
+ * | File        : Wire.cpp
+ * | Function    : Host stand-in for the ESP32 TwoWire
+ *****************************************************************************/
+
+#include "Wire.h"
+
+TwoWire Wire;
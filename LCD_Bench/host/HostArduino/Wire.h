@@ -0,0 +1,25 @@
+/*****************************************************************************
+ * | File        : Wire.h
+ * | Function    : Host stand-in for the ESP32 TwoWire
+ * | Info        : Nothing on the bench talks I2C; the legacy headers include it
+ *****************************************************************************/
+
+#ifndef __HOST_WIRE_H
+#define __HOST_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool = true) { return 2; }     // NACK: nobody there
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    size_t write(uint8_t) { return 1; }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+extern TwoWire Wire;
+
+#endif // __HOST_WIRE_H
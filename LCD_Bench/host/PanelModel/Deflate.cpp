@@ -0,0 +1,394 @@
+/*****************************************************************************
+ * | File        : Deflate.cpp
+ * | Function    : zlib streams (RFC 1950 / 1951) for the PNG files
+ *****************************************************************************/
+
+#include "Deflate.h"
+
+namespace {
+    constexpr uint32_t WINDOW = 32768;
+    constexpr uint16_t MIN_MATCH = 3;
+    constexpr uint16_t MAX_MATCH = 258;
+    constexpr uint16_t MAX_CHAIN = 64;         // Candidates looked at per position
+    constexpr uint8_t HASH_BITS = 15;
+
+    const uint16_t LENGTH_BASE[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    const uint8_t LENGTH_EXTRA[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    const uint16_t DISTANCE_BASE[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+        8193, 12289, 16385, 24577
+    };
+    const uint8_t DISTANCE_EXTRA[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    // Order the code length code lengths of a dynamic block come in
+    const uint8_t CODE_LENGTH_ORDER[19] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+    };
+
+    uint32_t adler32(const uint8_t* data, size_t size)
+    {
+        uint32_t a = 1, b = 0;
+        for (size_t i = 0; i < size; i++) {
+            a = (a + data[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        return (b << 16) | a;
+    }
+
+    //--------------------------------------------------------------------------
+    // Writing
+    //--------------------------------------------------------------------------
+    class BitWriter {
+    public:
+        explicit BitWriter(std::vector<uint8_t>& out) : _out(out), _bits(0), _count(0) {}
+
+        // Values go out least significant bit first
+        void put(uint32_t value, uint8_t count) {
+            _bits |= value << _count;
+            _count += count;
+            while (_count >= 8) {
+                _out.push_back(_bits & 0xFF);
+                _bits >>= 8;
+                _count -= 8;
+            }
+        }
+
+        // Huffman codes go out most significant bit first
+        void code(uint32_t code, uint8_t length) {
+            uint32_t reversed = 0;
+            for (uint8_t i = 0; i < length; i++) {
+                reversed = (reversed << 1) | ((code >> i) & 1);
+            }
+            put(reversed, length);
+        }
+
+        void flush() {
+            if (_count > 0) _out.push_back(_bits & 0xFF);
+            _bits = 0;
+            _count = 0;
+        }
+
+    private:
+        std::vector<uint8_t>& _out;
+        uint32_t _bits;
+        uint8_t _count;
+    };
+
+    // Fixed literal / length code (RFC 1951, 3.2.6)
+    void putSymbol(BitWriter& bits, uint16_t symbol)
+    {
+        if (symbol < 144)      bits.code(0x30 + symbol, 8);
+        else if (symbol < 256) bits.code(0x190 + symbol - 144, 9);
+        else if (symbol < 280) bits.code(symbol - 256, 7);
+        else                   bits.code(0xC0 + symbol - 280, 8);
+    }
+
+    void putMatch(BitWriter& bits, uint16_t length, uint16_t distance)
+    {
+        uint8_t l = 28;
+        while (LENGTH_BASE[l] > length) l--;
+        putSymbol(bits, 257 + l);
+        bits.put(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+
+        uint8_t d = 29;
+        while (DISTANCE_BASE[d] > distance) d--;
+        bits.code(d, 5);
+        bits.put(distance - DISTANCE_BASE[d], DISTANCE_EXTRA[d]);
+    }
+
+    uint32_t hash(const uint8_t* p)
+    {
+        uint32_t h = (p[0] << 16) | (p[1] << 8) | p[2];
+        return (h * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    //--------------------------------------------------------------------------
+    // Reading
+    //--------------------------------------------------------------------------
+    class BitReader {
+    public:
+        BitReader(const uint8_t* data, size_t size)
+            : _data(data), _size(size), _pos(0), _bits(0), _count(0), _overrun(false) {}
+
+        uint32_t get(uint8_t count) {
+            while (_count < count) {
+                uint32_t byte = 0;
+                if (_pos < _size) byte = _data[_pos++];
+                else _overrun = true;
+                _bits |= byte << _count;
+                _count += 8;
+            }
+            uint32_t value = _bits & ((1u << count) - 1);
+            _bits >>= count;
+            _count -= count;
+            return value;
+        }
+
+        void align() {
+            _bits = 0;
+            _count = 0;
+        }
+
+        const uint8_t* bytes(size_t count) {
+            if (_pos + count > _size) {
+                _overrun = true;
+                return nullptr;
+            }
+            const uint8_t* p = _data + _pos;
+            _pos += count;
+            return p;
+        }
+
+        bool overrun() const { return _overrun; }
+
+    private:
+        const uint8_t* _data;
+        size_t _size;
+        size_t _pos;
+        uint32_t _bits;
+        uint8_t _count;
+        bool _overrun;
+    };
+
+    // Canonical Huffman code: how many codes of each length, and the
+    // symbols in code order
+    struct Huffman {
+        uint16_t counts[16];
+        uint16_t symbols[288];
+
+        bool build(const uint8_t* lengths, uint16_t n) {
+            for (uint8_t i = 0; i < 16; i++) counts[i] = 0;
+            for (uint16_t i = 0; i < n; i++) counts[lengths[i]]++;
+            counts[0] = 0;
+
+            // Over-subscribed sets of lengths are no code at all
+            int32_t left = 1;
+            for (uint8_t len = 1; len < 16; len++) {
+                left = (left << 1) - counts[len];
+                if (left < 0) return false;
+            }
+
+            uint16_t offsets[16];
+            offsets[1] = 0;
+            for (uint8_t len = 1; len < 15; len++) offsets[len + 1] = offsets[len] + counts[len];
+            for (uint16_t i = 0; i < n; i++) {
+                if (lengths[i] != 0) symbols[offsets[lengths[i]]++] = i;
+            }
+            return true;
+        }
+
+        // -1 when the bits are no code
+        int32_t decode(BitReader& bits) const {
+            int32_t code = 0, first = 0, index = 0;
+            for (uint8_t len = 1; len < 16; len++) {
+                code |= bits.get(1);
+                int32_t count = counts[len];
+                if (code - first < count) return symbols[index + code - first];
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+    };
+
+    bool inflateBlock(BitReader& bits, const Huffman& lengths, const Huffman& distances,
+                      std::vector<uint8_t>& out)
+    {
+        for (;;) {
+            int32_t symbol = lengths.decode(bits);
+            if (symbol < 0 || bits.overrun()) return false;
+            if (symbol < 256) {
+                out.push_back((uint8_t)symbol);
+                continue;
+            }
+            if (symbol == 256) return true;
+
+            symbol -= 257;
+            if (symbol >= 29) return false;
+            uint32_t length = LENGTH_BASE[symbol] + bits.get(LENGTH_EXTRA[symbol]);
+
+            int32_t d = distances.decode(bits);
+            if (d < 0 || d >= 30) return false;
+            uint32_t distance = DISTANCE_BASE[d] + bits.get(DISTANCE_EXTRA[d]);
+            if (distance > out.size()) return false;
+
+            // The copy may overlap what it writes
+            size_t from = out.size() - distance;
+            for (uint32_t i = 0; i < length; i++) out.push_back(out[from + i]);
+        }
+    }
+
+    bool readDynamic(BitReader& bits, Huffman& lengths, Huffman& distances)
+    {
+        uint16_t nLengths = bits.get(5) + 257;
+        uint16_t nDistances = bits.get(5) + 1;
+        uint16_t nCodes = bits.get(4) + 4;
+        if (nLengths > 286 || nDistances > 30) return false;
+
+        uint8_t codeLengths[19] = {};
+        for (uint16_t i = 0; i < nCodes; i++) codeLengths[CODE_LENGTH_ORDER[i]] = bits.get(3);
+        Huffman codes;
+        if (!codes.build(codeLengths, 19)) return false;
+
+        // Both tables' lengths come as one run-length coded list
+        uint8_t list[286 + 30];
+        uint16_t n = 0;
+        while (n < nLengths + nDistances) {
+            int32_t symbol = codes.decode(bits);
+            if (symbol < 0 || bits.overrun()) return false;
+            if (symbol < 16) {
+                list[n++] = symbol;
+                continue;
+            }
+
+            uint8_t value = 0;
+            uint16_t repeat;
+            if (symbol == 16) {
+                if (n == 0) return false;
+                value = list[n - 1];
+                repeat = 3 + bits.get(2);
+            } else if (symbol == 17) {
+                repeat = 3 + bits.get(3);
+            } else {
+                repeat = 11 + bits.get(7);
+            }
+            if (n + repeat > nLengths + nDistances) return false;
+            while (repeat--) list[n++] = value;
+        }
+
+        if (list[256] == 0) return false;
+        return lengths.build(list, nLengths) && distances.build(list + nLengths, nDistances);
+    }
+}
+
+namespace Deflate {
+    void compress(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+    {
+        out.clear();
+        out.push_back(0x78);                    // 32 KB window, deflate
+        out.push_back(0x01);                    // No dictionary, fastest level
+
+        BitWriter bits(out);
+        bits.put(1, 1);                         // Final block
+        bits.put(1, 2);                         // Fixed Huffman codes
+
+        // Most recent position of each hash, and the one before it there
+        std::vector<int32_t> head(1u << HASH_BITS, -1);
+        std::vector<int32_t> previous(WINDOW, -1);
+
+        size_t pos = 0;
+        while (pos < size) {
+            uint16_t bestLength = 0;
+            uint32_t bestDistance = 0;
+
+            if (pos + MIN_MATCH <= size) {
+                uint32_t h = hash(data + pos);
+                size_t limit = size - pos < MAX_MATCH ? size - pos : MAX_MATCH;
+
+                int32_t candidate = head[h];
+                for (uint16_t chain = 0; candidate >= 0 && chain < MAX_CHAIN; chain++) {
+                    uint32_t distance = pos - candidate;
+                    if (distance > WINDOW) break;
+                    uint16_t length = 0;
+                    while (length < limit && data[candidate + length] == data[pos + length]) length++;
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestDistance = distance;
+                        if (length == limit) break;
+                    }
+                    candidate = previous[candidate % WINDOW];
+                }
+            }
+
+            uint16_t step = 1;
+            if (bestLength >= MIN_MATCH) {
+                putMatch(bits, bestLength, bestDistance);
+                step = bestLength;
+            } else {
+                putSymbol(bits, data[pos]);
+            }
+
+            // Every position passed over goes into the chains
+            for (uint16_t i = 0; i < step; i++, pos++) {
+                if (pos + MIN_MATCH <= size) {
+                    uint32_t h = hash(data + pos);
+                    previous[pos % WINDOW] = head[h];
+                    head[h] = pos;
+                }
+            }
+        }
+
+        putSymbol(bits, 256);
+        bits.flush();
+
+        uint32_t check = adler32(data, size);
+        out.push_back(check >> 24);
+        out.push_back(check >> 16);
+        out.push_back(check >> 8);
+        out.push_back(check);
+    }
+
+    bool inflate(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+    {
+        out.clear();
+        if (size < 6) return false;
+        if ((data[0] & 0x0F) != 8 || ((data[0] << 8) | data[1]) % 31 != 0) return false;
+        if (data[1] & 0x20) return false;       // Preset dictionary
+
+        BitReader bits(data + 2, size - 6);
+        bool last = false;
+        while (!last) {
+            last = bits.get(1);
+            uint32_t type = bits.get(2);
+
+            if (type == 0) {
+                bits.align();
+                const uint8_t* header = bits.bytes(4);
+                if (header == nullptr) return false;
+                uint16_t length = header[0] | (header[1] << 8);
+                uint16_t inverse = header[2] | (header[3] << 8);
+                if (length != (uint16_t)~inverse) return false;
+                const uint8_t* stored = bits.bytes(length);
+                if (stored == nullptr) return false;
+                out.insert(out.end(), stored, stored + length);
+            } else if (type == 1) {
+                static Huffman fixedLengths, fixedDistances;
+                static bool built = false;
+                if (!built) {
+                    uint8_t lengths[288];
+                    for (uint16_t i = 0; i < 288; i++) {
+                        lengths[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+                    }
+                    fixedLengths.build(lengths, 288);
+                    uint8_t distances[30];
+                    for (uint8_t i = 0; i < 30; i++) distances[i] = 5;
+                    fixedDistances.build(distances, 30);
+                    built = true;
+                }
+                if (!inflateBlock(bits, fixedLengths, fixedDistances, out)) return false;
+            } else if (type == 2) {
+                Huffman lengths, distances;
+                if (!readDynamic(bits, lengths, distances)) return false;
+                if (!inflateBlock(bits, lengths, distances, out)) return false;
+            } else {
+                return false;
+            }
+            if (bits.overrun()) return false;
+        }
+
+        const uint8_t* trailer = data + size - 4;
+        uint32_t check = ((uint32_t)trailer[0] << 24) | (trailer[1] << 16) | (trailer[2] << 8) | trailer[3];
+        return check == adler32(out.data(), out.size());
+    }
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * | File        : Deflate.h
+ * | Function    : zlib streams (RFC 1950 / 1951) for the PNG files
+ * | Info        : Small and dependency free; speed is not a goal
+ * |
+ * | compress() finds repeats in a 32 KB window and codes them with the
+ * | fixed Huffman tables. A rendered screen is mostly runs of one color,
+ * | and 460 KB of RGB comes down to a few KB. inflate() reads any zlib
+ * | stream: stored, fixed and dynamic blocks.
+ * |
+ * |   std::vector<uint8_t> packed;
+ * |   Deflate::compress(raw.data(), raw.size(), packed);
+ * |   std::vector<uint8_t> back;
+ * |   bool ok = Deflate::inflate(packed.data(), packed.size(), back);
+ *****************************************************************************/
+
+#ifndef __DEFLATE_H
+#define __DEFLATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace Deflate {
+    void compress(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+
+    // False on a broken stream or a wrong checksum
+    bool inflate(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+}
+
+#endif // __DEFLATE_H
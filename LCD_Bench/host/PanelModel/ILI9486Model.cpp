@@ -0,0 +1,225 @@
+/*****************************************************************************
+ * | File        : ILI9486Model.cpp
+ * | Function    : Host model of the ILI9486 behind the Waveshare shift register
+ *****************************************************************************/
+
+#include "ILI9486Model.h"
+
+// ILI9486 commands the model follows; the rest are taken and ignored
+#define CMD_SWRESET     0x01
+#define CMD_SLPIN       0x10
+#define CMD_SLPOUT      0x11
+#define CMD_NORON       0x13
+#define CMD_INVOFF      0x20
+#define CMD_INVON       0x21
+#define CMD_DISPOFF     0x28
+#define CMD_DISPON      0x29
+#define CMD_CASET       0x2A
+#define CMD_PASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_VSCRDEF     0x33
+#define CMD_MADCTL      0x36
+#define CMD_VSCRSADD    0x37
+#define CMD_RAMWRC      0x3C
+#define CMD_DFC         0xB6
+
+ILI9486Model::ILI9486Model()
+{
+    reset();
+}
+
+void ILI9486Model::reset()
+{
+    for (uint32_t i = 0; i < (uint32_t)COLUMNS * ROWS; i++) {
+        _memory[i] = POWER_ON_COLOR;
+    }
+    _stats = Stats{};
+
+    _command = 0;
+    _paramCount = 0;
+    _columnStart = 0;
+    _columnEnd = COLUMNS - 1;
+    _pageStart = 0;
+    _pageEnd = ROWS - 1;
+    _column = 0;
+    _page = 0;
+    _writing = false;
+
+    _madctl = 0;
+    _dfc = 0x02;
+    _inverted = false;
+    _displayOn = false;
+    _sleeping = true;
+
+    _scrolling = false;
+    _topFixed = 0;
+    _scrollLines = ROWS;
+    _scrollStart = 0;
+}
+
+//------------------------------------------------------------------------------
+// Command stream
+//------------------------------------------------------------------------------
+void ILI9486Model::panelWord(uint16_t word, bool data)
+{
+    if (!data) {
+        if (word >> 8) _stats.badPad++;
+        command(word & 0xFF);
+    } else if (_writing) {
+        pixel(word);
+    } else if (_command != 0) {
+        if (word >> 8) _stats.badPad++;
+        parameter(word & 0xFF);
+    } else {
+        _stats.strayData++;
+    }
+}
+
+void ILI9486Model::command(uint8_t cmd)
+{
+    _stats.commands++;
+    _command = cmd;
+    _paramCount = 0;
+    _writing = false;
+
+    switch (cmd) {
+    case CMD_SWRESET:
+        _madctl = 0;
+        _dfc = 0x02;
+        _inverted = false;
+        _displayOn = false;
+        _sleeping = true;
+        _scrolling = false;
+        break;
+    case CMD_SLPIN:     _sleeping = true; break;
+    case CMD_SLPOUT:    _sleeping = false; break;
+    case CMD_NORON:     _scrolling = false; break;
+    case CMD_INVOFF:    _inverted = false; break;
+    case CMD_INVON:     _inverted = true; break;
+    case CMD_DISPOFF:   _displayOn = false; break;
+    case CMD_DISPON:    _displayOn = true; break;
+    case CMD_RAMWR:
+        _column = _columnStart;
+        _page = _pageStart;
+        _writing = true;
+        break;
+    case CMD_RAMWRC:
+        _writing = true;
+        break;
+    default:
+        break;
+    }
+}
+
+void ILI9486Model::parameter(uint8_t value)
+{
+    if (_paramCount == MAX_PARAMS) return;
+    _params[_paramCount++] = value;
+
+    // A register takes effect with its last parameter
+    switch (_command) {
+    case CMD_CASET:
+        if (_paramCount == 4) {
+            _columnStart = (_params[0] << 8) | _params[1];
+            _columnEnd = (_params[2] << 8) | _params[3];
+        }
+        break;
+    case CMD_PASET:
+        if (_paramCount == 4) {
+            _pageStart = (_params[0] << 8) | _params[1];
+            _pageEnd = (_params[2] << 8) | _params[3];
+        }
+        break;
+    case CMD_MADCTL:
+        if (_paramCount == 1) _madctl = _params[0];
+        break;
+    case CMD_DFC:
+        if (_paramCount == 2) _dfc = _params[1];
+        break;
+    case CMD_VSCRDEF:
+        if (_paramCount == 6) {
+            _topFixed = (_params[0] << 8) | _params[1];
+            _scrollLines = (_params[2] << 8) | _params[3];
+        }
+        break;
+    case CMD_VSCRSADD:
+        if (_paramCount == 2) {
+            _scrollStart = (_params[0] << 8) | _params[1];
+            _scrolling = true;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void ILI9486Model::pixel(uint16_t color)
+{
+    _stats.pixels++;
+
+    // The counters run in window order; MADCTL decides where that is
+    uint16_t column = (_madctl & MADCTL_MV) ? _page : _column;
+    uint16_t row = (_madctl & MADCTL_MV) ? _column : _page;
+    if (column < COLUMNS && row < ROWS) {
+        if (_madctl & MADCTL_MX) column = COLUMNS - 1 - column;
+        if (_madctl & MADCTL_MY) row = ROWS - 1 - row;
+        _memory[(uint32_t)row * COLUMNS + column] = color;
+    } else {
+        _stats.clipped++;
+    }
+
+    if (_column < _columnEnd) {
+        _column++;
+    } else {
+        _column = _columnStart;
+        _page = (_page < _pageEnd) ? _page + 1 : _pageStart;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Readout
+//------------------------------------------------------------------------------
+uint16_t ILI9486Model::getMemory(uint16_t column, uint16_t row) const
+{
+    if (column >= COLUMNS || row >= ROWS) return 0;
+    return _memory[(uint32_t)row * COLUMNS + column];
+}
+
+uint16_t ILI9486Model::scrolledRow(uint16_t line) const
+{
+    if (!_scrolling || line < _topFixed || line >= _topFixed + _scrollLines) return line;
+    uint32_t row = (uint32_t)_scrollStart + (line - _topFixed);
+    if (row >= (uint32_t)_topFixed + _scrollLines) row -= _scrollLines;
+    return row < ROWS ? row : line;
+}
+
+uint16_t ILI9486Model::shown(uint16_t color) const
+{
+    // The color filter is BGR: without the BGR bit red and blue trade places
+    if (!(_madctl & MADCTL_BGR)) {
+        color = (color & 0x07E0) | (color >> 11) | (uint16_t)(color << 11);
+    }
+    return _inverted ? (uint16_t)~color : color;
+}
+
+void ILI9486Model::render(PanelImage& image) const
+{
+    image.resize(ROWS, COLUMNS);
+
+    for (uint16_t y = 0; y < COLUMNS; y++) {
+        // Landscape: image rows are sources, image columns gate lines
+        uint16_t source = COLUMNS - 1 - y;
+        uint16_t column = (_dfc & DFC_SS) ? COLUMNS - 1 - source : source;
+
+        for (uint16_t x = 0; x < ROWS; x++) {
+            uint16_t gate = ROWS - 1 - x;
+            uint16_t line = (_dfc & DFC_GS) ? ROWS - 1 - gate : gate;
+
+            uint16_t color = 0x0000;
+            if (_displayOn && !_sleeping) {
+                color = shown(_memory[(uint32_t)scrolledRow(line) * COLUMNS + column]);
+            }
+            image.setPixel(x, y, color);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * | File        : ILI9486Model.h
+ * | Function    : Host model of the ILI9486 behind the Waveshare shift register
+ * | Info        : Turns the recorded command stream back into a picture
+ * |
+ * | The panel takes 16-bit words from the shift register. A command or a
+ * | parameter is the low byte of its word; the high byte is the 0x00 pad
+ * | both drivers send in front of it. A pixel is the whole word, RGB565.
+ * | The model follows the commands the drivers use and keeps the frame
+ * | memory, so what a drawing call leaves on the glass can be looked at
+ * | and compared without hardware:
+ * |
+ * |   ILI9486Model panel;
+ * |   BusRecorder::instance().setPanelSink(&panel);
+ * |   lcd.begin();
+ * |   lcd.drawLine(0, 0, 479, 319, Colors::RED);
+ * |   lcd.waitIdle();
+ * |   PanelImage image;
+ * |   panel.render(image);
+ * |   image.write("line.png");
+ * |
+ * | Frame memory is 320 columns by 480 rows, as the glass is wired. CASET
+ * | and PASET set the window in the order MADCTL gives (MV exchanges the
+ * | two, MX and MY mirror them); RAMWR starts at its corner and RAMWRC goes
+ * | on where the last write stopped. Display Function Control (0xB6) sets
+ * | which way the sources (SS) and gates (GS) are scanned, and VSCRDEF /
+ * | VSCRSADD rotate the gate lines of the scroll area until NORON.
+ * |
+ * | render() shows the glass as it is mounted on the shield: 480 wide and
+ * | 320 high, so the default scan direction (D2U_L2R) reads upright and
+ * | a portrait direction comes out turned on its side, as on the device.
+ *****************************************************************************/
+
+#ifndef __ILI9486_MODEL_H
+#define __ILI9486_MODEL_H
+
+#include <stdint.h>
+#include "BusRecorder.h"
+#include "PanelImage.h"
+
+class ILI9486Model : public PanelSink {
+public:
+    static constexpr uint16_t COLUMNS = 320;    // Sources
+    static constexpr uint16_t ROWS = 480;       // Gate lines
+
+    // Frame memory after power-on is undefined; the model starts it here
+    static constexpr uint16_t POWER_ON_COLOR = 0x0000;
+
+    struct Stats {
+        uint32_t commands;
+        uint32_t pixels;            // Data words taken by RAMWR / RAMWRC
+        uint32_t clipped;           // Pixels addressed outside frame memory
+        uint32_t badPad;            // Command / parameter words with a high byte
+        uint32_t strayData;         // Data words no command was waiting for
+    };
+
+    ILI9486Model();
+
+    // Power-on: registers to their defaults, frame memory cleared
+    void reset();
+
+    void panelWord(uint16_t word, bool data) override;
+
+    // Frame memory as written, by column and row
+    uint16_t getMemory(uint16_t column, uint16_t row) const;
+
+    // What the glass shows, in the landscape view
+    void render(PanelImage& image) const;
+
+    const Stats& getStats() const { return _stats; }
+
+private:
+    // MADCTL (0x36)
+    static constexpr uint8_t MADCTL_MY = 0x80;
+    static constexpr uint8_t MADCTL_MX = 0x40;
+    static constexpr uint8_t MADCTL_MV = 0x20;
+    static constexpr uint8_t MADCTL_BGR = 0x08;
+
+    // Display Function Control (0xB6), second parameter
+    static constexpr uint8_t DFC_GS = 0x40;
+    static constexpr uint8_t DFC_SS = 0x20;
+
+    static constexpr uint8_t MAX_PARAMS = 16;
+
+    uint16_t _memory[COLUMNS * ROWS];
+    Stats _stats;
+
+    uint8_t _command;
+    uint8_t _params[MAX_PARAMS];
+    uint8_t _paramCount;
+
+    // Window and write pointer, in the order CASET / PASET give them
+    uint16_t _columnStart, _columnEnd;
+    uint16_t _pageStart, _pageEnd;
+    uint16_t _column, _page;
+    bool _writing;
+
+    uint8_t _madctl;
+    uint8_t _dfc;
+    bool _inverted;
+    bool _displayOn;
+    bool _sleeping;
+
+    // Vertical scroll, in gate lines
+    bool _scrolling;
+    uint16_t _topFixed, _scrollLines, _scrollStart;
+
+    void command(uint8_t cmd);
+    void parameter(uint8_t value);
+    void pixel(uint16_t color);
+
+    // Frame memory row a gate line shows
+    uint16_t scrolledRow(uint16_t line) const;
+    uint16_t shown(uint16_t color) const;
+};
+
+#endif // __ILI9486_MODEL_H
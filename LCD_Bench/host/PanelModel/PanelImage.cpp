@@ -0,0 +1,309 @@
+/*****************************************************************************
+ * | File        : PanelImage.cpp
+ * | Function    : An RGB565 picture of the panel, its files and comparison
+ *****************************************************************************/
+
+#include "PanelImage.h"
+#include "Deflate.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+    const uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+    {
+        static uint32_t table[256];
+        static bool built = false;
+        if (!built) {
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (uint8_t k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                table[n] = c;
+            }
+            built = true;
+        }
+
+        crc = ~crc;
+        for (size_t i = 0; i < size; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    uint32_t bigEndian(const uint8_t* p)
+    {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    void putBigEndian(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(value >> 24);
+        out.push_back(value >> 16);
+        out.push_back(value >> 8);
+        out.push_back(value);
+    }
+
+    void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data)
+    {
+        putBigEndian(out, data.size());
+        size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        putBigEndian(out, crc32(out.data() + start, out.size() - start));
+    }
+
+    bool writeFile(const char* path, const std::vector<uint8_t>& data)
+    {
+        FILE* file = fopen(path, "wb");
+        if (file == nullptr) return false;
+        bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+        return (fclose(file) == 0) && ok;
+    }
+
+    bool readFile(const char* path, std::vector<uint8_t>& data)
+    {
+        FILE* file = fopen(path, "rb");
+        if (file == nullptr) return false;
+        uint8_t buffer[4096];
+        size_t n;
+        data.clear();
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + n);
+        fclose(file);
+        return true;
+    }
+
+    uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+    {
+        int p = a + b - c;
+        int pa = p > a ? p - a : a - p;
+        int pb = p > b ? p - b : b - p;
+        int pc = p > c ? p - c : c - p;
+        if (pa <= pb && pa <= pc) return a;
+        return pb <= pc ? b : c;
+    }
+}
+
+void PanelImage::resize(uint16_t width, uint16_t height)
+{
+    _width = width;
+    _height = height;
+    _pixels.assign((uint32_t)width * height, 0);
+}
+
+void PanelImage::toRGB(uint16_t color, uint8_t* rgb)
+{
+    uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+uint16_t PanelImage::fromRGB(const uint8_t* rgb)
+{
+    return ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+}
+
+//------------------------------------------------------------------------------
+// Writing
+//------------------------------------------------------------------------------
+bool PanelImage::write(const char* path) const
+{
+    size_t length = strlen(path);
+    if (length >= 4 && strcmp(path + length - 4, ".ppm") == 0) return writePPM(path);
+    return writePNG(path);
+}
+
+bool PanelImage::writePPM(const char* path) const
+{
+    char header[32];
+    int n = snprintf(header, sizeof(header), "P6\n%u %u\n255\n", _width, _height);
+
+    std::vector<uint8_t> file(header, header + n);
+    file.resize(n + (size_t)_width * _height * 3);
+    uint8_t* rgb = file.data() + n;
+    for (uint32_t i = 0; i < (uint32_t)_width * _height; i++, rgb += 3) toRGB(_pixels[i], rgb);
+    return writeFile(path, file);
+}
+
+bool PanelImage::writePNG(const char* path) const
+{
+    // Each row is stored as the difference to the pixel on its left
+    // (filter 1, Sub): a run of one color becomes a run of zeros
+    size_t stride = (size_t)_width * 3;
+    std::vector<uint8_t> raw((stride + 1) * _height);
+    for (uint16_t y = 0; y < _height; y++) {
+        uint8_t* row = raw.data() + y * (stride + 1);
+        row[0] = 1;
+        uint8_t left[3] = { 0, 0, 0 };
+        for (uint16_t x = 0; x < _width; x++) {
+            uint8_t rgb[3];
+            toRGB(getPixel(x, y), rgb);
+            for (uint8_t c = 0; c < 3; c++) {
+                row[1 + x * 3 + c] = rgb[c] - left[c];
+                left[c] = rgb[c];
+            }
+        }
+    }
+
+    std::vector<uint8_t> header;
+    putBigEndian(header, _width);
+    putBigEndian(header, _height);
+    header.push_back(8);                    // Bits per channel
+    header.push_back(2);                    // RGB
+    header.push_back(0);                    // Deflate
+    header.push_back(0);                    // Adaptive filters
+    header.push_back(0);                    // Not interlaced
+
+    std::vector<uint8_t> packed;
+    Deflate::compress(raw.data(), raw.size(), packed);
+
+    std::vector<uint8_t> file(PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+    putChunk(file, "IHDR", header);
+    putChunk(file, "IDAT", packed);
+    putChunk(file, "IEND", std::vector<uint8_t>());
+    return writeFile(path, file);
+}
+
+//------------------------------------------------------------------------------
+// Reading
+//------------------------------------------------------------------------------
+bool PanelImage::read(const char* path)
+{
+    std::vector<uint8_t> file;
+    if (!readFile(path, file)) return false;
+    if (file.size() >= 8 && memcmp(file.data(), PNG_SIGNATURE, 8) == 0) return readPNG(file);
+    if (file.size() >= 2 && file[0] == 'P' && file[1] == '6') return readPPM(file);
+    return false;
+}
+
+bool PanelImage::readPPM(const std::vector<uint8_t>& file)
+{
+    // Three numbers after the magic, then one whitespace byte and the pixels
+    uint32_t values[3];
+    size_t pos = 2;
+    for (uint8_t i = 0; i < 3; i++) {
+        while (pos < file.size() && (file[pos] == ' ' || file[pos] == '\n' ||
+                                     file[pos] == '\r' || file[pos] == '\t' || file[pos] == '#')) {
+            if (file[pos] == '#') {
+                while (pos < file.size() && file[pos] != '\n') pos++;
+            } else {
+                pos++;
+            }
+        }
+        if (pos >= file.size() || file[pos] < '0' || file[pos] > '9') return false;
+        values[i] = 0;
+        while (pos < file.size() && file[pos] >= '0' && file[pos] <= '9') {
+            values[i] = values[i] * 10 + (file[pos++] - '0');
+            if (values[i] > 65535) return false;
+        }
+    }
+    pos++;
+
+    if (values[2] != 255) return false;
+    if (file.size() < pos + (size_t)values[0] * values[1] * 3) return false;
+
+    resize(values[0], values[1]);
+    const uint8_t* rgb = file.data() + pos;
+    for (uint32_t i = 0; i < (uint32_t)_width * _height; i++, rgb += 3) _pixels[i] = fromRGB(rgb);
+    return true;
+}
+
+bool PanelImage::readPNG(const std::vector<uint8_t>& file)
+{
+    uint32_t width = 0, height = 0;
+    uint8_t channels = 0;
+    std::vector<uint8_t> packed;
+
+    size_t pos = 8;
+    for (;;) {
+        if (pos + 12 > file.size()) return false;
+        uint32_t length = bigEndian(&file[pos]);
+        if (length > file.size() - pos - 12) return false;
+        const uint8_t* type = &file[pos + 4];
+        const uint8_t* data = type + 4;
+        if (bigEndian(data + length) != crc32(type, length + 4)) return false;
+
+        if (memcmp(type, "IHDR", 4) == 0) {
+            if (length != 13) return false;
+            width = bigEndian(data);
+            height = bigEndian(data + 4);
+            if (data[8] != 8 || data[10] != 0 || data[11] != 0 || data[12] != 0) return false;
+            if (data[9] == 2) channels = 3;
+            else if (data[9] == 6) channels = 4;
+            else return false;
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            packed.insert(packed.end(), data, data + length);
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        pos += 12 + length;
+    }
+    if (channels == 0 || width == 0 || height == 0 || width > 65535 || height > 65535) return false;
+
+    std::vector<uint8_t> raw;
+    if (!Deflate::inflate(packed.data(), packed.size(), raw)) return false;
+    size_t stride = (size_t)width * channels;
+    if (raw.size() != (stride + 1) * height) return false;
+
+    // Undo the filters in place, row by row
+    for (uint32_t y = 0; y < height; y++) {
+        uint8_t* row = raw.data() + y * (stride + 1);
+        uint8_t filter = row[0];
+        uint8_t* line = row + 1;
+        const uint8_t* above = y > 0 ? line - (stride + 1) : nullptr;
+        for (size_t i = 0; i < stride; i++) {
+            uint8_t a = i >= channels ? line[i - channels] : 0;
+            uint8_t b = above != nullptr ? above[i] : 0;
+            uint8_t c = (above != nullptr && i >= channels) ? above[i - channels] : 0;
+            switch (filter) {
+            case 0:                                 break;
+            case 1: line[i] += a;                   break;
+            case 2: line[i] += b;                   break;
+            case 3: line[i] += (a + b) / 2;         break;
+            case 4: line[i] += paeth(a, b, c);      break;
+            default: return false;
+            }
+        }
+    }
+
+    resize(width, height);
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t* line = raw.data() + y * (stride + 1) + 1;
+        for (uint32_t x = 0; x < width; x++) setPixel(x, y, fromRGB(line + x * channels));
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+PanelImage::Difference PanelImage::compare(const PanelImage& a, const PanelImage& b)
+{
+    Difference diff = { 0, 0xFFFF, 0xFFFF, 0, 0 };
+
+    if (a._width != b._width || a._height != b._height) {
+        uint16_t width = a._width > b._width ? a._width : b._width;
+        uint16_t height = a._height > b._height ? a._height : b._height;
+        diff.pixels = (uint32_t)width * height;
+        diff.x0 = 0;
+        diff.y0 = 0;
+        diff.x1 = width > 0 ? width - 1 : 0;
+        diff.y1 = height > 0 ? height - 1 : 0;
+        return diff;
+    }
+
+    for (uint16_t y = 0; y < a._height; y++) {
+        for (uint16_t x = 0; x < a._width; x++) {
+            if (a.getPixel(x, y) == b.getPixel(x, y)) continue;
+            diff.pixels++;
+            if (x < diff.x0) diff.x0 = x;
+            if (y < diff.y0) diff.y0 = y;
+            if (x > diff.x1) diff.x1 = x;
+            if (y > diff.y1) diff.y1 = y;
+        }
+    }
+    if (diff.pixels == 0) {
+        diff.x0 = 0;
+        diff.y0 = 0;
+    }
+    return diff;
+}
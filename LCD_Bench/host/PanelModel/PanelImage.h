@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * | File        : PanelImage.h
+ * | Function    : An RGB565 picture of the panel, its files and comparison
+ * | Info        : PPM to look at, PNG to keep; both exact in RGB565
+ * |
+ * | write() picks the format by the extension. The 5 and 6 bit channels
+ * | are widened by repeating their top bits, so reading a file back gives
+ * | the very same RGB565 values:
+ * |
+ * |   PanelImage image;
+ * |   panel.render(image);
+ * |   image.write("calculator.png");
+ * |
+ * |   PanelImage golden;
+ * |   if (golden.read("golden/class/calculator.png")) {
+ * |       PanelImage::Difference diff = PanelImage::compare(image, golden);
+ * |       if (diff.pixels > 0) ...            // diff.x0 .. diff.y1 bound them
+ * |   }
+ * |
+ * | read() takes 8-bit RGB or RGBA PNGs, any filter or compression, and
+ * | binary PPMs.
+ *****************************************************************************/
+
+#ifndef __PANEL_IMAGE_H
+#define __PANEL_IMAGE_H
+
+#include <stdint.h>
+#include <vector>
+
+class PanelImage {
+public:
+    struct Difference {
+        uint32_t pixels;            // Pixels that differ; all if the sizes do
+        uint16_t x0, y0, x1, y1;    // Inclusive box around them
+    };
+
+    PanelImage() : _width(0), _height(0) {}
+
+    void resize(uint16_t width, uint16_t height);
+    uint16_t getWidth() const { return _width; }
+    uint16_t getHeight() const { return _height; }
+
+    uint16_t getPixel(uint16_t x, uint16_t y) const { return _pixels[(uint32_t)y * _width + x]; }
+    void setPixel(uint16_t x, uint16_t y, uint16_t color) { _pixels[(uint32_t)y * _width + x] = color; }
+
+    // By extension, .ppm or .png; false if the file cannot be written
+    bool write(const char* path) const;
+    bool writePPM(const char* path) const;
+    bool writePNG(const char* path) const;
+
+    // False if the file is missing or not a picture this can read
+    bool read(const char* path);
+
+    static Difference compare(const PanelImage& a, const PanelImage& b);
+
+private:
+    uint16_t _width;
+    uint16_t _height;
+    std::vector<uint16_t> _pixels;
+
+    static void toRGB(uint16_t color, uint8_t* rgb);
+    static uint16_t fromRGB(const uint8_t* rgb);
+
+    bool readPPM(const std::vector<uint8_t>& file);
+    bool readPNG(const std::vector<uint8_t>& file);
+};
+
+#endif // __PANEL_IMAGE_H
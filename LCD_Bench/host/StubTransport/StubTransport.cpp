@@ -0,0 +1,126 @@
+/*****************************************************************************
+ * | File        : StubTransport.cpp
+ * | Function    : Scriptable LCDTransport for the host checks
+ *****************************************************************************/
+
+#include "StubTransport.h"
+#include <stdlib.h>
+
+StubTransport::StubTransport()
+    : _count(0)
+    , _inFlight(0)
+    , _refuse(0)
+    , _refuseAll(false)
+    , _completions(UINT8_MAX)
+{
+    for (uint8_t i = 0; i < MAX_BUFFERS; i++) _buffers[i] = nullptr;
+    reset();
+}
+
+StubTransport::~StubTransport()
+{
+    for (uint8_t i = 0; i < _count; i++) free(_buffers[i]);
+}
+
+void StubTransport::reset()
+{
+    _stream.clear();
+    _submits.clear();
+    _refusals = 0;
+    _reaps = 0;
+    _waits = 0;
+    _maxInFlight = _inFlight;
+    _overwrites = 0;
+    _locks = 0;
+    _maxLockDepth = 0;
+    _lockDepth = 0;
+    _idleNotifies = 0;
+}
+
+bool StubTransport::begin(LCDTransferQueue& queue)
+{
+    (void)queue;
+    return true;
+}
+
+uint8_t* StubTransport::allocBuffer(size_t bytes)
+{
+    // A freed slot is taken again, so a queue begun twice sees the same indices
+    uint8_t slot = 0;
+    while (slot < _count && _buffers[slot] != nullptr) slot++;
+    if (slot == MAX_BUFFERS) return nullptr;
+
+    uint8_t* buffer = (uint8_t*)malloc(bytes);
+    if (buffer == nullptr) return nullptr;
+    _buffers[slot] = buffer;
+    if (slot == _count) _count++;
+    return buffer;
+}
+
+void StubTransport::freeBuffer(uint8_t* buffer)
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_buffers[i] == buffer && buffer != nullptr) {
+            free(buffer);
+            _buffers[i] = nullptr;
+        }
+    }
+}
+
+bool StubTransport::submit(const uint8_t* data, size_t len)
+{
+    if (_refuseAll || _refuse > 0 || _inFlight == MAX_IN_FLIGHT) {
+        if (_refuse > 0) _refuse--;
+        _refusals++;
+        return false;
+    }
+
+    uint8_t index = UINT8_MAX;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_buffers[i] == data) index = i;
+    }
+    _submits.push_back(Submit{ index, len });
+    _stream.insert(_stream.end(), data, data + len);
+
+    _flight[_inFlight++] = Transfer{ data, len, hash(data, len) };
+    if (_inFlight > _maxInFlight) _maxInFlight = _inFlight;
+    return true;
+}
+
+uint8_t StubTransport::reap(bool wait)
+{
+    _reaps++;
+    if (wait) _waits++;
+
+    uint8_t done = _completions < _inFlight ? _completions : _inFlight;
+    if (wait && done == 0 && _inFlight > 0) done = 1;
+
+    for (uint8_t i = 0; i < done; i++) {
+        const Transfer& t = _flight[i];
+        if (hash(t.data, t.bytes) != t.hash) _overwrites++;
+    }
+    for (uint8_t i = done; i < _inFlight; i++) _flight[i - done] = _flight[i];
+    _inFlight -= done;
+    return done;
+}
+
+void StubTransport::lock()
+{
+    _locks++;
+    if (++_lockDepth > _maxLockDepth) _maxLockDepth = _lockDepth;
+}
+
+void StubTransport::unlock()
+{
+    if (_lockDepth > 0) _lockDepth--;
+}
+
+uint32_t StubTransport::hash(const uint8_t* data, size_t bytes)
+{
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < bytes; i++) {
+        h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+}
@@ -0,0 +1,129 @@
+/*****************************************************************************
+ * | File        : StubTransport.h
+ * | Function    : Scriptable LCDTransport for the host checks
+ * | Info        : Records every submit; completes and refuses on script
+ * |
+ * | The DMA transport finishes transfers when the wire is done with them.
+ * | The stub finishes them when the script says so, which lets a check put
+ * | LCDTransferQueue in any state: both buffers in flight, one refused,
+ * | nothing completing until it waits:
+ * |
+ * |   StubTransport stub;
+ * |   LCDTransferQueue queue;
+ * |   queue.begin(&stub, 8);               // Four pixels a buffer
+ * |   stub.setCompletions(0);              // Only a blocking reap finishes one
+ * |   stub.refuse(1);                      // The next submit is turned down
+ * |   queue.pushPixels(pixels, 10);
+ * |   queue.waitIdle();
+ * |   stub.getStream();                    // The accepted bytes, in order
+ * |
+ * | reap() finishes transfers in submit order. A buffer whose bytes change
+ * | between its submit and its completion was refilled while on the wire;
+ * | getOverwrites() counts them.
+ *****************************************************************************/
+
+#ifndef __STUB_TRANSPORT_H
+#define __STUB_TRANSPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "LCDTransport.h"
+
+class StubTransport : public LCDTransport {
+public:
+    static constexpr uint8_t MAX_BUFFERS = 4;
+    static constexpr uint8_t MAX_IN_FLIGHT = 8;
+
+    struct Submit {
+        uint8_t buffer;             // Index into the allocated buffers
+        size_t bytes;
+    };
+
+    StubTransport();
+    ~StubTransport() override;
+
+    //--------------------------------------------------------------------------
+    // Script
+    //--------------------------------------------------------------------------
+    // Turn down the next 'count' submits
+    void refuse(uint32_t count) { _refuse = count; }
+
+    // Turn down every submit until called with false
+    void refuseAll(bool refuse) { _refuseAll = refuse; }
+
+    // Transfers a reap(false) finishes; reap(true) finishes at least one.
+    // UINT8_MAX finishes everything in flight (the default).
+    void setCompletions(uint8_t count) { _completions = count; }
+
+    // Forget the recorded submits and counters; the buffers stay
+    void reset();
+
+    //--------------------------------------------------------------------------
+    // Recorded
+    //--------------------------------------------------------------------------
+    // Accepted bytes, in submit order
+    const std::vector<uint8_t>& getStream() const { return _stream; }
+    const std::vector<Submit>& getSubmits() const { return _submits; }
+
+    // The memory handed out by allocBuffer(), in allocation order; valid
+    // until the queue frees it
+    uint8_t* getBuffer(uint8_t index) const { return index < _count ? _buffers[index] : nullptr; }
+
+    uint32_t getRefusals() const { return _refusals; }
+    uint32_t getReaps() const { return _reaps; }
+    uint32_t getWaits() const { return _waits; }            // reap(true) calls
+    uint8_t getInFlight() const { return _inFlight; }
+    uint8_t getMaxInFlight() const { return _maxInFlight; }
+    uint32_t getOverwrites() const { return _overwrites; }
+    uint32_t getLocks() const { return _locks; }
+    uint8_t getLockDepth() const { return _lockDepth; }
+    uint8_t getMaxLockDepth() const { return _maxLockDepth; }
+    uint32_t getIdleNotifies() const { return _idleNotifies; }
+
+    //--------------------------------------------------------------------------
+    // LCDTransport
+    //--------------------------------------------------------------------------
+    bool begin(LCDTransferQueue& queue) override;
+    uint8_t* allocBuffer(size_t bytes) override;
+    void freeBuffer(uint8_t* buffer) override;
+    bool submit(const uint8_t* data, size_t len) override;
+    uint8_t reap(bool wait) override;
+    void notifyIdle() override { _idleNotifies++; }
+    void lock() override;
+    void unlock() override;
+
+private:
+    struct Transfer {
+        const uint8_t* data;
+        size_t bytes;
+        uint32_t hash;              // Of the bytes at submit
+    };
+
+    uint8_t* _buffers[MAX_BUFFERS];
+    uint8_t _count;
+
+    // In flight, oldest first
+    Transfer _flight[MAX_IN_FLIGHT];
+    uint8_t _inFlight;
+
+    uint32_t _refuse;
+    bool _refuseAll;
+    uint8_t _completions;
+
+    std::vector<uint8_t> _stream;
+    std::vector<Submit> _submits;
+    uint32_t _refusals;
+    uint32_t _reaps;
+    uint32_t _waits;
+    uint8_t _maxInFlight;
+    uint32_t _overwrites;
+    uint32_t _locks;
+    uint8_t _lockDepth;
+    uint8_t _maxLockDepth;
+    uint32_t _idleNotifies;
+
+    static uint32_t hash(const uint8_t* data, size_t bytes);
+};
+
+#endif // __STUB_TRANSPORT_H
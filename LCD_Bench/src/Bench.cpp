@@ -0,0 +1,178 @@
+/*****************************************************************************
+ * | File        : Bench.cpp
+ * | Function    : Display throughput benchmark for WaveshareLCD
+ * | Info        : env:bench on the ESP32, env:bench_native on the host
+ * |
+ * |   pio run -e bench -t upload && pio device monitor -e bench
+ * |   pio run -e bench_native -t exec
+ * |
+ * | Each step draws its part of the workload (Workload.h), waits for the
+ * | panel to take the last pixel and is timed with BenchClock. The table
+ * | has the same format on both targets, so runs can be compared with
+ * | diff. On the host SPI is a recording stub: the times are the CPU side
+ * | of the driver only, the bytes are the same as on the wire.
+ * |
+ * |   LCD bench 2 | esp32 240 MHz | spi 8000000 | cycles
+ * |   step         reps       ticks   total_us  per_op_us      bytes     KB/s
+ * |   clear           4   ...
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "WaveshareLCD.h"
+#include "LCDIndexedCanvas.h"
+#include "BenchClock.h"
+#include "Workload.h"
+
+namespace {
+    constexpr uint8_t FORMAT_VERSION = 2;
+    constexpr uint16_t CLEARS = 4;
+    constexpr uint16_t FILLS = 200;
+    constexpr uint16_t BLITS = 10;
+    constexpr uint16_t FRAMES = 4;
+
+    const COLOR CLEAR_COLORS[CLEARS] = {
+        Colors::WHITE, Colors::BLACK, Colors::RED, Colors::BLUE,
+    };
+
+    WaveshareLCD lcd;
+    LCDIndexedCanvas frame;
+    COLOR pixels[Workload::BMP_WIDTH * Workload::BMP_HEIGHT];
+
+    void printHeader()
+    {
+#if defined(ESP32)
+        Serial.printf("LCD bench %u | esp32 %u MHz | spi %u | %s\n", FORMAT_VERSION,
+                      (unsigned)getCpuFrequencyMhz(), (unsigned)LCD_SPI_CLOCK, BenchClock::UNIT);
+#else
+        Serial.printf("LCD bench %u | host | spi %u | %s\n", FORMAT_VERSION,
+                      (unsigned)LCD_SPI_CLOCK, BenchClock::UNIT);
+#endif
+        Serial.printf("%-10s %6s %11s %10s %10s %10s %8s\n",
+                      "step", "reps", "ticks", "total_us", "per_op_us", "bytes", "KB/s");
+    }
+
+    // Time 'work' from a settled panel until its last pixel is out
+    template <class Work>
+    void run(const char* step, uint32_t reps, Work work)
+    {
+        lcd.waitIdle();
+        lcd.resetStats();
+
+        uint32_t start = BenchClock::now();
+        work();
+        lcd.waitIdle();
+        uint32_t ticks = BenchClock::now() - start;
+
+        uint32_t totalMicros = ticks / BenchClock::ticksPerMicro();
+        uint32_t bytes = lcd.getStats().bytes;
+        uint32_t tenthsPerOp = (uint32_t)((uint64_t)ticks * 10 / BenchClock::ticksPerMicro() / reps);
+        uint32_t kbPerSecond = totalMicros > 0 ? (uint32_t)((uint64_t)bytes * 1000 / totalMicros) : 0;
+
+        Serial.printf("%-10s %6u %11u %10u %8u.%u %10u %8u\n", step, (unsigned)reps,
+                      (unsigned)ticks, (unsigned)totalMicros, (unsigned)(tenthsPerOp / 10),
+                      (unsigned)(tenthsPerOp % 10), (unsigned)bytes, (unsigned)kbPerSecond);
+    }
+
+    void runBench()
+    {
+        LENGTH width = lcd.getWidth();
+        LENGTH height = lcd.getHeight();
+
+        printHeader();
+
+        run("clear", CLEARS, [] {
+            for (uint16_t i = 0; i < CLEARS; i++) {
+                lcd.clear(CLEAR_COLORS[i]);
+            }
+        });
+
+        // Every step starts the generator over, so none depends on the others
+        run("fillArea", FILLS, [=] {
+            Workload::Random random;
+            for (uint16_t i = 0; i < FILLS; i++) {
+                Workload::Line l = Workload::line(random, width, height);
+                lcd.fillArea(min(l.x0, l.x1), min(l.y0, l.y1),
+                             max(l.x0, l.x1) + 1, max(l.y0, l.y1) + 1, l.color);
+            }
+        });
+
+        run("lines", Workload::LINES, [=] {
+            Workload::Random random;
+            for (uint16_t i = 0; i < Workload::LINES; i++) {
+                Workload::Line l = Workload::line(random, width, height);
+                lcd.drawLine(l.x0, l.y0, l.x1, l.y1, l.color);
+            }
+        });
+
+        run("circles", Workload::CIRCLES, [=] {
+            Workload::Random random;
+            for (uint16_t i = 0; i < Workload::CIRCLES; i++) {
+                Workload::Circle c = Workload::circle(random, width, height);
+                lcd.drawCircle(c.x, c.y, c.radius, c.color, DrawFill::FULL);
+            }
+        });
+
+        uint16_t columns = width / Workload::TEXT_CHAR_WIDTH;
+        uint16_t rows = height / Workload::TEXT_CHAR_HEIGHT;
+        run("text", (uint32_t)columns * rows, [=] {
+            char row[Workload::TEXT_MAX_COLUMNS + 1];
+            for (uint16_t r = 0; r < rows; r++) {
+                Workload::textRow(r, columns, row);
+                lcd.drawString(1, 1 + r * Workload::TEXT_CHAR_HEIGHT, row, &Font16,
+                               Colors::BLACK, Colors::WHITE);
+            }
+        });
+
+        // The BMP is converted once; the blits are what is timed
+        static uint8_t bmp[Workload::BMP_SIZE];
+        Workload::makeBmp(bmp);
+        Workload::decodeBmp(bmp, pixels);
+        run("blit", BLITS, [=] {
+            for (uint16_t i = 0; i < BLITS; i++) {
+                POINT x = (i * 32) % (width - Workload::BMP_WIDTH);
+                POINT y = (i * 20) % (height - Workload::BMP_HEIGHT);
+                lcd.blit(x, y, Workload::BMP_WIDTH, Workload::BMP_HEIGHT, pixels);
+            }
+        });
+
+        // A whole screen from the 4-bit frame, expanded through the palette
+        // on the way out
+        if (frame.begin(width, height)) {
+            frame.clear(Colors::WHITE);
+            Workload::Random random;
+            for (uint16_t i = 0; i < Workload::CIRCLES; i++) {
+                Workload::Circle c = Workload::circle(random, width, height);
+                frame.drawCircle(c.x, c.y, c.radius, c.color, DrawFill::FULL);
+            }
+            run("frame4", FRAMES, [] {
+                for (uint16_t i = 0; i < FRAMES; i++) {
+                    frame.markDirty();
+                    frame.flush(lcd, 0, 0);
+                }
+            });
+            frame.end();
+        }
+
+        Serial.printf("end\n");
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    lcd.begin();
+    runBench();
+}
+
+void loop()
+{
+    delay(1000);
+}
+
+#if !defined(ESP32)
+int main()
+{
+    setup();
+    return 0;
+}
+#endif
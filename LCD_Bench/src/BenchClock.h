@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * | File        : BenchClock.h
+ * | Function    : The clock the display benchmark is timed with
+ * | Info        : CPU cycle counter on the ESP32, nanoseconds on the host
+ * |
+ * | The Xtensa cycle counter (CCOUNT) counts every CPU clock and costs one
+ * | instruction to read, so even a short primitive is timed exactly. It is
+ * | 32 bits wide and wraps after 17.9 s at 240 MHz; a single measurement
+ * | must stay below that. micros() would round every step to a microsecond
+ * | and takes a lock on the way.
+ * |
+ * |   uint32_t start = BenchClock::now();
+ * |   lcd.clear(Colors::WHITE);
+ * |   lcd.waitIdle();
+ * |   uint32_t ticks = BenchClock::now() - start;     // Wraps cleanly
+ * |   uint32_t us = ticks / BenchClock::ticksPerMicro();
+ *****************************************************************************/
+
+#ifndef __BENCH_CLOCK_H
+#define __BENCH_CLOCK_H
+
+#include <Arduino.h>
+
+#if !defined(ESP32)
+#include <chrono>
+#endif
+
+namespace BenchClock {
+#if defined(ESP32)
+    constexpr const char* UNIT = "cycles";
+
+    inline uint32_t now() { return ESP.getCycleCount(); }
+    inline uint32_t ticksPerMicro() { return getCpuFrequencyMhz(); }
+#else
+    constexpr const char* UNIT = "ns";
+
+    // Wraps after 4.3 s; the host runs the workload much faster than that
+    inline uint32_t now() {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    inline uint32_t ticksPerMicro() { return 1000; }
+#endif
+}
+
+#endif // __BENCH_CLOCK_H
@@ -0,0 +1,288 @@
+/*****************************************************************************
+ * | File        : BlendBench.cpp
+ * | Function    : Accuracy and speed of the LCDBlend kernels
+ * | Info        : env:blend on the ESP32, env:blend_native on the host
+ * |
+ * |   pio run -e blend -t upload && pio device monitor -e blend
+ * |   pio run -e blend_native -t exec
+ * |
+ * | First every kernel is checked. mix() is compared with a float blend
+ * | for sampled color pairs at every alpha and every mask value; the
+ * | buffer kernels, at every alignment and length up to 40, must give
+ * | exactly what mix() gives pixel by pixel. Then each kernel is timed
+ * | over a 480x320 buffer next to the plain per-channel blend, in the
+ * | format of the display bench:
+ * |
+ * |   LCD blend 1 | host | ns
+ * |   check        samples     worst_r   worst_g   worst_b  result
+ * |   ...
+ * |   step         reps       ticks   total_us  per_op_us     Mpx/s
+ * |   channels       10   ...
+ * |
+ * | The host program exits with 1 when a check fails.
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include <math.h>
+#include "LCDBlend.h"
+#include "BenchClock.h"
+#include "Workload.h"
+
+namespace {
+    constexpr uint8_t FORMAT_VERSION = 1;
+    constexpr LENGTH WIDTH = 480;
+    constexpr LENGTH HEIGHT = 320;
+    constexpr uint32_t PIXELS = (uint32_t)WIDTH * HEIGHT;
+    constexpr uint16_t REPS = 10;
+
+    // Most a channel may be off the float blend, in steps of that channel
+    constexpr double WORST = 1.0;
+
+    constexpr uint32_t COLOR_STEP = 251;         // Samples of fg and of bg
+    constexpr uint32_t RUN_MAX = 40;
+
+    alignas(4) COLOR screen[PIXELS];
+    alignas(4) COLOR image[PIXELS];
+    uint8_t coverage[PIXELS / 2];
+
+    bool passed = true;
+
+    //--------------------------------------------------------------------------
+    // Accuracy
+    //--------------------------------------------------------------------------
+    struct Worst {
+        double r, g, b;
+    };
+
+    void measure(Worst& worst, COLOR out, COLOR fg, COLOR bg, double alpha)
+    {
+        double r = (fg >> 11) * alpha + (bg >> 11) * (1 - alpha);
+        double g = ((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (1 - alpha);
+        double b = (fg & 0x1F) * alpha + (bg & 0x1F) * (1 - alpha);
+        worst.r = fmax(worst.r, fabs((out >> 11) - r));
+        worst.g = fmax(worst.g, fabs(((out >> 5) & 0x3F) - g));
+        worst.b = fmax(worst.b, fabs((out & 0x1F) - b));
+    }
+
+    void report(const char* check, uint32_t samples, const Worst& worst, bool ok)
+    {
+        Serial.printf("%-12s %8u %11.3f %9.3f %9.3f  %s\n", check, (unsigned)samples,
+                      worst.r, worst.g, worst.b, ok ? "ok" : "FAIL");
+        passed = passed && ok;
+    }
+
+    bool withinBounds(const Worst& worst)
+    {
+        return worst.r < WORST && worst.g < WORST && worst.b < WORST;
+    }
+
+    void checkAlpha()
+    {
+        Worst worst = { 0, 0, 0 };
+        uint32_t samples = 0;
+        bool ends = true;
+        for (uint32_t fg = 0; fg < 0x10000; fg += COLOR_STEP) {
+            for (uint32_t bg = 0; bg < 0x10000; bg += COLOR_STEP) {
+                for (uint16_t alpha = 0; alpha <= 255; alpha++, samples++) {
+                    measure(worst, LCDBlend::mix(fg, bg, alpha), fg, bg, alpha / 255.0);
+                }
+                ends = ends && LCDBlend::mix(fg, bg, LCDBlend::TRANSPARENT) == bg &&
+                       LCDBlend::mix(fg, bg, LCDBlend::OPAQUE) == fg;
+            }
+        }
+        report("alpha", samples, worst, ends && withinBounds(worst));
+    }
+
+    void checkMask()
+    {
+        Worst worst = { 0, 0, 0 };
+        uint32_t samples = 0;
+        bool ends = true;
+        for (uint32_t fg = 0; fg < 0x10000; fg += COLOR_STEP) {
+            for (uint32_t bg = 0; bg < 0x10000; bg += COLOR_STEP) {
+                for (uint8_t m = 0; m <= LCDBlend::MASK_OPAQUE; m++, samples++) {
+                    COLOR out = bg;
+                    uint8_t mask = m << 4;
+                    LCDBlend::mask(&out, &mask, 1, fg);
+                    measure(worst, out, fg, bg, m / 15.0);
+                    if (m == 0) ends = ends && out == bg;
+                    if (m == LCDBlend::MASK_OPAQUE) ends = ends && out == fg;
+                }
+            }
+        }
+        report("mask", samples, worst, ends && withinBounds(worst));
+    }
+
+    // The buffer kernels against mix() one pixel at a time, at both
+    // alignments of dst and src
+    void checkKernels()
+    {
+        static const uint8_t ALPHAS[] = { 0, 1, 77, 128, 200, 254, 255 };
+        static const uint8_t MASK_LEVEL[16] = {
+            0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+        };
+
+        Workload::Random random(7);
+        alignas(4) COLOR dst[RUN_MAX + 2];
+        alignas(4) COLOR src[RUN_MAX + 2];
+        COLOR want[RUN_MAX + 2];
+        uint8_t mask[RUN_MAX / 2 + 1];
+        uint32_t runs = 0, wrong = 0;
+
+        auto fillRandom = [&] {
+            for (uint32_t i = 0; i < RUN_MAX + 2; i++) {
+                dst[i] = random.next();
+                src[i] = random.next();
+            }
+            // Mostly empty and solid, like glyphs
+            for (uint32_t i = 0; i < sizeof(mask); i++) {
+                uint8_t hi = random.below(3) == 0 ? random.below(16) : (random.below(2) ? 0 : 15);
+                uint8_t lo = random.below(3) == 0 ? random.below(16) : hi;
+                mask[i] = (hi << 4) | lo;
+            }
+        };
+        auto nibble = [&](uint32_t i) -> uint8_t {
+            return (i & 1) ? (mask[i >> 1] & 0x0F) : (mask[i >> 1] >> 4);
+        };
+        auto compare = [&](const COLOR* out, uint32_t count) {
+            runs++;
+            for (uint32_t i = 0; i < count; i++) {
+                if (out[i] != want[i]) {
+                    wrong++;
+                    break;
+                }
+            }
+        };
+
+        for (uint8_t d = 0; d < 2; d++) {
+            for (uint8_t s = 0; s < 2; s++) {
+                for (uint32_t count = 0; count <= RUN_MAX; count++) {
+                    COLOR* out = dst + d;
+                    const COLOR* in = src + s;
+                    COLOR color = random.next();
+
+                    for (uint8_t alpha : ALPHAS) {
+                        fillRandom();
+                        for (uint32_t i = 0; i < count; i++) want[i] = LCDBlend::mix(in[i], out[i], alpha);
+                        LCDBlend::blend(out, in, count, alpha);
+                        compare(out, count);
+
+                        fillRandom();
+                        for (uint32_t i = 0; i < count; i++) want[i] = LCDBlend::mix(color, out[i], alpha);
+                        LCDBlend::fill(out, count, color, alpha);
+                        compare(out, count);
+
+                        fillRandom();
+                        for (uint32_t i = 0; i < count; i++) want[i] = LCDBlend::mix(color, in[i], alpha);
+                        LCDBlend::tint(out, in, count, color, alpha);
+                        compare(out, count);
+                    }
+
+                    fillRandom();
+                    for (uint32_t i = 0; i < count; i++) {
+                        want[i] = LCDBlend::mix(in[i], out[i], MASK_LEVEL[nibble(i)]);
+                    }
+                    LCDBlend::over(out, in, mask, count);
+                    compare(out, count);
+
+                    fillRandom();
+                    for (uint32_t i = 0; i < count; i++) {
+                        want[i] = LCDBlend::mix(color, out[i], MASK_LEVEL[nibble(i)]);
+                    }
+                    LCDBlend::mask(out, mask, count, color);
+                    compare(out, count);
+                }
+            }
+        }
+
+        Worst none = { 0, 0, 0 };
+        report("kernels", runs, none, wrong == 0);
+    }
+
+    //--------------------------------------------------------------------------
+    // Speed
+    //--------------------------------------------------------------------------
+    // What a blend costs without the kernels: three channels, two multiplies each
+    void blendChannels(COLOR* dst, const COLOR* src, uint32_t count, uint8_t alpha)
+    {
+        uint32_t a = alpha + (alpha >> 7);
+        for (uint32_t i = 0; i < count; i++) {
+            COLOR fg = src[i], bg = dst[i];
+            uint32_t r = ((fg >> 11) * a + (bg >> 11) * (256 - a)) >> 8;
+            uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (256 - a)) >> 8;
+            uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (256 - a)) >> 8;
+            dst[i] = (COLOR)((r << 11) | (g << 5) | b);
+        }
+    }
+
+    template <class Work>
+    void run(const char* step, Work work)
+    {
+        uint32_t start = BenchClock::now();
+        for (uint16_t i = 0; i < REPS; i++) work();
+        uint32_t ticks = BenchClock::now() - start;
+
+        uint32_t totalMicros = ticks / BenchClock::ticksPerMicro();
+        uint32_t tenthsPerOp = (uint32_t)((uint64_t)ticks * 10 / BenchClock::ticksPerMicro() / REPS);
+        uint32_t tenthsMpx = totalMicros > 0 ? (uint32_t)((uint64_t)PIXELS * REPS * 10 / totalMicros) : 0;
+
+        Serial.printf("%-10s %6u %11u %10u %8u.%u %7u.%u\n", step, (unsigned)REPS,
+                      (unsigned)ticks, (unsigned)totalMicros, (unsigned)(tenthsPerOp / 10),
+                      (unsigned)(tenthsPerOp % 10), (unsigned)(tenthsMpx / 10),
+                      (unsigned)(tenthsMpx % 10));
+    }
+
+    void runBench()
+    {
+        Workload::Random random;
+        for (uint32_t i = 0; i < PIXELS; i++) {
+            screen[i] = random.next();
+            image[i] = random.next();
+        }
+        // A screen of 16-pixel glyph rows: 3 of 4 pixels empty or solid
+        for (uint32_t i = 0; i < PIXELS / 2; i++) {
+            uint8_t r = random.below(8);
+            coverage[i] = r < 3 ? 0x00 : r < 6 ? 0xFF : (uint8_t)random.next();
+        }
+
+        Serial.printf("%-10s %6s %11s %10s %10s %9s\n",
+                      "step", "reps", "ticks", "total_us", "per_op_us", "Mpx/s");
+        run("channels", [] { blendChannels(screen, image, PIXELS, 100); });
+        run("blend", [] { LCDBlend::blend(screen, image, PIXELS, 100); });
+        run("fill", [] { LCDBlend::fill(screen, PIXELS, Colors::BLACK, 100); });
+        run("tint", [] { LCDBlend::tint(screen, image, PIXELS, Colors::RED, 100); });
+        run("over", [] { LCDBlend::over(screen, image, coverage, PIXELS); });
+        run("mask", [] { LCDBlend::mask(screen, coverage, PIXELS, Colors::WHITE); });
+        Serial.printf("end\n");
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+#if defined(ESP32)
+    Serial.printf("LCD blend %u | esp32 %u MHz | %s\n", FORMAT_VERSION,
+                  (unsigned)getCpuFrequencyMhz(), BenchClock::UNIT);
+#else
+    Serial.printf("LCD blend %u | host | %s\n", FORMAT_VERSION, BenchClock::UNIT);
+#endif
+    Serial.printf("%-12s %8s %11s %9s %9s  %s\n",
+                  "check", "samples", "worst_r", "worst_g", "worst_b", "result");
+    checkAlpha();
+    checkMask();
+    checkKernels();
+    runBench();
+}
+
+void loop()
+{
+    delay(1000);
+}
+
+#if !defined(ESP32)
+int main()
+{
+    setup();
+    return passed ? 0 : 1;
+}
+#endif
@@ -0,0 +1,134 @@
+/*****************************************************************************
+ * | File        : CheckBus.cpp
+ * | Function    : SPIBus arbitration: chip selects and clocks of nested devices
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "SPIBus.h"
+#include "WaveshareLCD.h"
+#include "LCDTouch.h"
+#include "BusRecorder.h"
+#include "Checks.h"
+
+namespace {
+    // Free pins, away from the panel and the touch controller
+    const uint8_t CS[SPIBus::MAX_DEVICES] = { 25, 27, 32, 33 };
+    const uint32_t CLOCK[SPIBus::MAX_DEVICES] = { 20000000, 2000000, 4000000, 1000000 };
+
+    bool low(uint8_t pin)
+    {
+        return BusRecorder::instance().pinRead(pin) == 0;
+    }
+
+    uint32_t clock()
+    {
+        return BusRecorder::instance().getClock();
+    }
+
+    // Only 'device' of the four selected, at its clock
+    void expectOwner(HostCheck& check, int8_t device, const char* when)
+    {
+        for (int8_t i = 0; i < SPIBus::MAX_DEVICES; i++) {
+            check.expect(low(CS[i]) == (i == device), "%s: CS of device %d is %s",
+                         when, i, low(CS[i]) ? "low" : "high");
+        }
+        if (device >= 0) {
+            check.expect(clock() == CLOCK[device], "%s: clock %u, device %d runs at %u",
+                         when, (unsigned)clock(), device, (unsigned)CLOCK[device]);
+        }
+    }
+
+    void nesting(HostCheck& check)
+    {
+        SPIBus bus;
+        bus.begin();
+        SPIBus::Device d[SPIBus::MAX_DEVICES];
+        for (uint8_t i = 0; i < SPIBus::MAX_DEVICES; i++) {
+            d[i] = bus.addDevice(CS[i], SPISettings(CLOCK[i], MSBFIRST, SPI_MODE0));
+        }
+
+        // A batch on one device with a second one taken inside it
+        bus.select(d[0]);
+        bus.acquire(d[0]);
+        expectOwner(check, 0, "outer batch");
+        check.expect(bus.select(d[1]), "nested select refused");
+        expectOwner(check, 1, "nested device");
+        bus.deselect(d[1]);
+        expectOwner(check, 0, "back to the outer batch");
+        bus.release(d[0]);
+        bus.deselect(d[0]);
+        expectOwner(check, -1, "all released");
+
+        // A chain deeper than the bus keeps places for: 0 1 2 3 0, then 1
+        for (uint8_t i = 0; i < SPIBus::MAX_DEVICES; i++) bus.select(d[i]);
+        check.expect(bus.select(d[0]), "device 0 again refused");
+        expectOwner(check, 0, "device 0 again");
+        check.expect(!bus.select(d[1]), "a fifth nesting level was accepted");
+        expectOwner(check, 0, "after the refusal");
+        bus.deselect(d[1]);                 // Ignored, as the select was
+        expectOwner(check, 0, "after the refused deselect");
+
+        bus.deselect(d[0]);
+        for (int8_t i = SPIBus::MAX_DEVICES - 1; i >= 0; i--) {
+            expectOwner(check, i, "unwinding the chain");
+            bus.deselect(d[i]);
+        }
+        expectOwner(check, -1, "chain released");
+    }
+
+    // The reported failure: a touch read inside a panel batch, with the
+    // panel's RAM write open
+    void panelAndTouch(HostCheck& check)
+    {
+        LCDPins pins;
+        TouchPins touchPins;
+        BusRecorder& recorder = BusRecorder::instance();
+        recorder.watchPanel(pins.cs, pins.dc);
+        recorder.watchChipSelect(touchPins.cs);
+
+        WaveshareLCD lcd(pins);
+        LCDTouch touch(lcd, touchPins);
+        lcd.begin();
+        touch.begin();
+
+        lcd.beginWrite();
+        lcd.setWindow(0, 0, 10, 10);
+
+        BusRecorder::Counters before = recorder.getCounters();
+        POINT x, y;
+        touch.readRaw(x, y);
+        BusRecorder::Counters read = recorder.getCounters() - before;
+
+        check.expect(read.bytes > 0, "the touch read sent nothing");
+        check.expect(read.commands == 0 && read.pixels == 0,
+                     "the panel latched %u commands and %u pixels of the touch read",
+                     (unsigned)read.commands, (unsigned)read.pixels);
+        check.expect(read.busNanos == read.bytes * (8000000000ull / TOUCH_SPI_CLOCK),
+                     "the touch read was not clocked at %u Hz", (unsigned)TOUCH_SPI_CLOCK);
+        check.expect(low(pins.cs), "panel CS not low again after the touch read");
+        check.expect(clock() == LCD_SPI_CLOCK, "clock %u after the touch read",
+                     (unsigned)clock());
+
+        // The open window takes the rest of its pixels
+        COLOR red[100];
+        for (COLOR& c : red) c = Colors::RED;
+        before = recorder.getCounters();
+        lcd.pushPixels(red, 100);
+        BusRecorder::Counters fill = recorder.getCounters() - before;
+        check.expect(fill.pixels == 100, "%u of 100 pixels reached the panel",
+                     (unsigned)fill.pixels);
+
+        lcd.endWrite();
+        check.expect(!low(pins.cs), "panel CS low after endWrite()");
+        check.expect(!low(touchPins.cs), "touch CS low after the read");
+    }
+}
+
+void checkSPIBus(HostCheck& check)
+{
+    check.begin("spi_bus");
+    nesting(check);
+
+    check.begin("panel_touch");
+    panelAndTouch(check);
+}
@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * | File        : CheckFonts.cpp
+ * | Function    : Table fonts against their packed copies, in every text mode
+ * | Info        : Font8..Font24 and Font8P..Font24P, ' '..'~'
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "LCDCanvas.h"
+#include "LCDGlyphCache.h"
+#include "Checks.h"
+
+namespace {
+    const uint8_t COLUMNS = 16;
+    const uint8_t ROWS = 6;                 // 96 cells for the 95 characters
+    const char FIRST = ' ', LAST = '~';
+
+    const COLOR BACKGROUND = Colors::BLACK;
+    const COLOR FOREGROUND = Colors::YELLOW;
+
+    enum class Mode : uint8_t { OPAQUE, TRANSPARENT, CACHED };
+    const char* const MODE_NAMES[] = { "opaque", "transparent", "cached" };
+
+    struct Pair {
+        const char* name;
+        sFONT* table;
+        sFONT* packed;
+    };
+
+    // Every character in its own cell. Transparent text goes over the
+    // opaque background, so all modes must leave the same pixels.
+    void render(LCDCanvas& canvas, sFONT* font, Mode mode)
+    {
+        LCDGlyphCache cache;
+        canvas.setGlyphCache(mode == Mode::CACHED ? &cache : nullptr);
+        canvas.clear(BACKGROUND);
+        for (char ch = FIRST; ch <= LAST; ch++) {
+            uint8_t cell = (uint8_t)(ch - FIRST);
+            POINT x = (cell % COLUMNS) * font->Width + 1;
+            POINT y = (cell / COLUMNS) * font->Height + 1;
+            if (mode == Mode::TRANSPARENT) {
+                canvas.drawChar(x, y, ch, font, FONT_BACKGROUND, FOREGROUND);
+            } else {
+                canvas.drawChar(x, y, ch, font, BACKGROUND, FOREGROUND);
+            }
+        }
+        canvas.setGlyphCache(nullptr);
+    }
+
+    // The first character whose cell differs, or 0
+    char firstDifference(const LCDCanvas& a, const LCDCanvas& b, const sFONT* font)
+    {
+        LENGTH width = COLUMNS * font->Width;
+        for (char ch = FIRST; ch <= LAST; ch++) {
+            uint8_t cell = (uint8_t)(ch - FIRST);
+            POINT left = (cell % COLUMNS) * font->Width;
+            POINT top = (cell / COLUMNS) * font->Height;
+            for (POINT y = top; y < top + font->Height; y++) {
+                for (POINT x = left; x < left + font->Width; x++) {
+                    if (a.getBuffer()[y * width + x] != b.getBuffer()[y * width + x]) return ch;
+                }
+            }
+        }
+        return 0;
+    }
+
+    uint32_t ink(const LCDCanvas& canvas, const sFONT* font)
+    {
+        uint32_t count = 0;
+        uint32_t pixels = (uint32_t)COLUMNS * font->Width * ROWS * font->Height;
+        for (uint32_t i = 0; i < pixels; i++) {
+            if (canvas.getBuffer()[i] == FOREGROUND) count++;
+        }
+        return count;
+    }
+
+    void comparePair(HostCheck& check, const Pair& pair)
+    {
+        check.expect(pair.packed->Width == pair.table->Width &&
+                     pair.packed->Height == pair.table->Height,
+                     "%s: packed %ux%u, table %ux%u", pair.name,
+                     (unsigned)pair.packed->Width, (unsigned)pair.packed->Height,
+                     (unsigned)pair.table->Width, (unsigned)pair.table->Height);
+
+        LENGTH width = COLUMNS * pair.table->Width;
+        LENGTH height = ROWS * pair.table->Height;
+        LCDCanvas reference(width, height);
+        LCDCanvas canvas(width, height);
+
+        render(reference, pair.table, Mode::OPAQUE);
+        check.expect(ink(reference, pair.table) > 0, "%s: nothing drawn", pair.name);
+
+        for (uint8_t m = 0; m < 3; m++) {
+            for (uint8_t packed = 0; packed < 2; packed++) {
+                if (m == 0 && !packed) continue;            // The reference
+                sFONT* font = packed ? pair.packed : pair.table;
+                render(canvas, font, (Mode)m);
+                char ch = firstDifference(reference, canvas, pair.table);
+                check.expect(ch == 0, "%s%s %s: '%c' differs from the table font drawn opaque",
+                             pair.name, packed ? "P" : "", MODE_NAMES[m], ch);
+            }
+        }
+    }
+}
+
+void checkFonts(HostCheck& check)
+{
+    const Pair pairs[] = {
+        { "Font8", &Font8, &Font8P },
+        { "Font12", &Font12, &Font12P },
+        { "Font16", &Font16, &Font16P },
+        { "Font20", &Font20, &Font20P },
+        { "Font24", &Font24, &Font24P },
+    };
+
+    check.begin("packed_fonts");
+    for (const Pair& pair : pairs) comparePair(check, pair);
+}
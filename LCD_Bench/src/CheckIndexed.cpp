@@ -0,0 +1,163 @@
+/*****************************************************************************
+ * | File        : CheckIndexed.cpp
+ * | Function    : LCDIndexedCanvas against LCDCanvas: the same scene, flushed
+ * | Info        : Odd and even widths, blocking and queued, palette changes
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include <vector>
+#include "WaveshareLCD.h"
+#include "LCDCanvas.h"
+#include "LCDIndexedCanvas.h"
+#include "SPIBus.h"
+#include "StubTransport.h"
+#include "Checks.h"
+
+namespace {
+    const LENGTH HEIGHT = 40;
+
+    // Where the indexed canvas lands on the surface it is flushed to
+    const POINT SCREEN_X = 13, SCREEN_Y = 9;
+    const LENGTH SCREEN_WIDTH = 200, SCREEN_HEIGHT = 60;
+    const COLOR OUTSIDE = Colors::GRAY;
+
+    // Palette colors only, so both canvases hold exactly the same pixels
+    void drawScene(LCDSurface& s, LENGTH width, COLOR accent)
+    {
+        s.clear(Colors::BLACK);
+        s.drawRectangle(4, 6, 40, 14, accent, DrawFill::FULL);
+        s.drawString(50, 4, "Idx 42", &Font16, Colors::BLUE, Colors::WHITE);
+        s.drawLine(0, HEIGHT - 1, width - 1, 20, Colors::GREEN);
+        s.drawCircle(width - 20, 28, 9, Colors::YELLOW, DrawFill::FULL);
+        s.drawPoint(width, HEIGHT, Colors::BROWN);                 // The last pixel
+    }
+
+    // Rows of 'reference' with a pixel of 'color'
+    std::vector<bool> rowsWith(const LCDCanvas& reference, LENGTH width, COLOR color)
+    {
+        std::vector<bool> rows(HEIGHT, false);
+        const COLOR* pixels = reference.getBuffer();
+        for (uint32_t i = 0; i < (uint32_t)width * HEIGHT; i++) {
+            if (pixels[i] == color) rows[i / width] = true;
+        }
+        return rows;
+    }
+
+    // 'screen' shows 'reference' at (SCREEN_X, SCREEN_Y) and OUTSIDE elsewhere
+    uint32_t differences(const LCDCanvas& screen, const LCDCanvas& reference, LENGTH width)
+    {
+        uint32_t count = 0;
+        for (POINT y = 0; y < SCREEN_HEIGHT; y++) {
+            for (POINT x = 0; x < SCREEN_WIDTH; x++) {
+                COLOR expected = OUTSIDE;
+                if (x >= SCREEN_X && x < SCREEN_X + width &&
+                    y >= SCREEN_Y && y < SCREEN_Y + HEIGHT) {
+                    expected = reference.getBuffer()[(y - SCREEN_Y) * width + (x - SCREEN_X)];
+                }
+                if (screen.getBuffer()[y * SCREEN_WIDTH + x] != expected) count++;
+            }
+        }
+        return count;
+    }
+
+    // The wire bytes of the 'rows' of 'reference'
+    std::vector<uint8_t> wire(const LCDCanvas& reference, LENGTH width, const std::vector<bool>& rows)
+    {
+        std::vector<uint8_t> bytes;
+        for (POINT y = 0; y < HEIGHT; y++) {
+            if (!rows[y]) continue;
+            for (POINT x = 0; x < width; x++) {
+                COLOR c = reference.getBuffer()[y * width + x];
+                bytes.push_back((uint8_t)(c >> 8));
+                bytes.push_back((uint8_t)(c & 0xFF));
+            }
+        }
+        return bytes;
+    }
+
+    void blocking(HostCheck& check, LENGTH width)
+    {
+        LCDIndexedCanvas indexed(width, HEIGHT);
+        LCDCanvas reference(width, HEIGHT);
+        LCDCanvas screen(SCREEN_WIDTH, SCREEN_HEIGHT);
+        drawScene(indexed, width, Colors::RED);
+        drawScene(reference, width, Colors::RED);
+        screen.clear(OUTSIDE);
+
+        indexed.flush(screen, SCREEN_X, SCREEN_Y);
+        uint32_t diff = differences(screen, reference, width);
+        check.expect(diff == 0, "width %u: %u pixels differ from LCDCanvas",
+                     (unsigned)width, (unsigned)diff);
+        check.expect(!indexed.isDirty(), "width %u: dirty after flush()", (unsigned)width);
+
+        // An entry no row uses, and an entry set to the color it has
+        indexed.setPaletteColor(15, Colors::CYAN);
+        indexed.setPaletteColor(indexed.findColor(Colors::GREEN), Colors::GREEN);
+        check.expect(!indexed.isDirty(), "width %u: an unused or unchanged entry dirtied rows",
+                     (unsigned)width);
+
+        // The accent becomes another color: only its rows are dirty
+        std::vector<bool> accentRows = rowsWith(reference, width, Colors::RED);
+        indexed.setPaletteColor(indexed.findColor(Colors::RED), Colors::MAGENTA);
+        uint32_t wrong = 0;
+        for (POINT y = 0; y < HEIGHT; y++) {
+            if (indexed.isRowDirty(y) != accentRows[y]) wrong++;
+        }
+        check.expect(wrong == 0, "width %u: %u rows dirtied wrongly by setPaletteColor()",
+                     (unsigned)width, (unsigned)wrong);
+
+        drawScene(reference, width, Colors::MAGENTA);
+        indexed.flush(screen, SCREEN_X, SCREEN_Y);
+        diff = differences(screen, reference, width);
+        check.expect(diff == 0, "width %u, new accent: %u pixels differ from LCDCanvas",
+                     (unsigned)width, (unsigned)diff);
+    }
+
+    void queued(HostCheck& check, LENGTH width)
+    {
+        SPIBus bus;
+        StubTransport stub;
+        LCDPins pins;
+        WaveshareLCD lcd(pins);
+        lcd.setBus(&bus);
+        lcd.setTransport(&stub);
+        lcd.begin();
+        lcd.waitIdle();
+
+        LCDIndexedCanvas indexed(width, HEIGHT);
+        LCDCanvas reference(width, HEIGHT);
+        drawScene(indexed, width, Colors::RED);
+        drawScene(reference, width, Colors::RED);
+
+        // Every row is at least ASYNC_MIN_PIXELS: all of it goes through the queue
+        stub.reset();
+        indexed.flush(lcd, 0, 0);
+        lcd.waitIdle();
+        std::vector<bool> all(HEIGHT, true);
+        check.expect(stub.getStream() == wire(reference, width, all),
+                     "width %u, queued: the stream is not the LCDCanvas pixels", (unsigned)width);
+
+        std::vector<bool> accentRows = rowsWith(reference, width, Colors::RED);
+        indexed.setPaletteColor(indexed.findColor(Colors::RED), Colors::MAGENTA);
+        drawScene(reference, width, Colors::MAGENTA);
+        stub.reset();
+        indexed.flush(lcd, 0, 0);
+        lcd.waitIdle();
+        check.expect(stub.getStream() == wire(reference, width, accentRows),
+                     "width %u, queued: the new accent did not send just its rows",
+                     (unsigned)width);
+        check.expect(stub.getOverwrites() == 0, "width %u, queued: %u buffers refilled on the wire",
+                     (unsigned)width, (unsigned)stub.getOverwrites());
+    }
+}
+
+void checkIndexedCanvas(HostCheck& check)
+{
+    check.begin("indexed_flush");
+    blocking(check, 160);
+    blocking(check, 161);
+
+    check.begin("indexed_queued");
+    queued(check, 160);
+    queued(check, 161);
+}
@@ -0,0 +1,397 @@
+/*****************************************************************************
+ * | File        : CheckQueue.cpp
+ * | Function    : LCDTransferQueue on a scripted transport
+ * | Info        : Buffer rotation, refills, refusals and flush callbacks
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include <string.h>
+#include <vector>
+#include "LCDTransport.h"
+#include "StubTransport.h"
+#include "Checks.h"
+
+namespace {
+    // Four pixels a buffer: short streams already take several turns
+    const size_t BUFFER_BYTES = 8;
+
+    const uint16_t RED = 0xF800;
+    const uint16_t GREEN = 0x07E0;
+    const uint16_t BLUE = 0x001F;
+
+    typedef std::vector<uint8_t> Bytes;
+
+    // What the panel must receive for 'count' native pixels
+    Bytes wire(const uint16_t* pixels, uint32_t count)
+    {
+        Bytes bytes;
+        for (uint32_t i = 0; i < count; i++) {
+            bytes.push_back((uint8_t)(pixels[i] >> 8));
+            bytes.push_back((uint8_t)(pixels[i] & 0xFF));
+        }
+        return bytes;
+    }
+
+    Bytes wire(uint16_t color, uint32_t count)
+    {
+        std::vector<uint16_t> pixels(count, color);
+        return wire(pixels.data(), count);
+    }
+
+    struct Source {
+        uint16_t pixels[128];
+
+        Source()
+        {
+            for (uint16_t i = 0; i < 128; i++) pixels[i] = (uint16_t)(i * 0x0101 + 0x1234);
+        }
+    };
+
+    // Which buffers the submits used, and how many bytes each took
+    bool submitsAre(const StubTransport& stub, const uint8_t* buffers, const size_t* bytes,
+                    size_t count)
+    {
+        const std::vector<StubTransport::Submit>& submits = stub.getSubmits();
+        if (submits.size() != count) return false;
+        for (size_t i = 0; i < count; i++) {
+            if (submits[i].buffer != buffers[i] || submits[i].bytes != bytes[i]) return false;
+        }
+        return true;
+    }
+
+    void countCall(void* context)
+    {
+        (*(uint32_t*)context)++;
+    }
+
+    void rotation(HostCheck& check)
+    {
+        Source source;
+
+        // Nothing completes until the queue waits: both buffers go out,
+        // then each wait frees the older one
+        StubTransport stub;
+        LCDTransferQueue queue;
+        queue.begin(&stub, BUFFER_BYTES);
+        stub.setCompletions(0);
+        queue.pushPixels(source.pixels, 10);
+        check.expect(queue.isBusy() && stub.getInFlight() == 2,
+                     "after pushPixels(): busy %d, %u in flight",
+                     queue.isBusy(), (unsigned)stub.getInFlight());
+        queue.waitIdle();
+
+        const uint8_t buffers[] = { 0, 1, 0 };
+        const size_t bytes[] = { 8, 8, 4 };
+        check.expect(submitsAre(stub, buffers, bytes, 3), "10 pixels not sent as 0:8 1:8 0:4");
+        check.expect(stub.getStream() == wire(source.pixels, 10), "10 pixels: wrong bytes");
+        check.expect(stub.getOverwrites() == 0, "%u buffers refilled on the wire",
+                     (unsigned)stub.getOverwrites());
+        check.expect(stub.getWaits() == 3, "%u blocking reaps for 3 transfers",
+                     (unsigned)stub.getWaits());
+        check.expect(queue.getTransfers() == 3 && queue.getBytes() == 20,
+                     "counters: %u transfers, %u bytes",
+                     (unsigned)queue.getTransfers(), (unsigned)queue.getBytes());
+
+        // A long stream, one completion a reap: the buffers alternate
+        stub.reset();
+        stub.setCompletions(1);
+        queue.pushPixels(source.pixels, 101);
+        queue.waitIdle();
+        const std::vector<StubTransport::Submit>& submits = stub.getSubmits();
+        bool alternate = submits.size() == 26;
+        for (size_t i = 0; alternate && i < submits.size(); i++) {
+            alternate = submits[i].buffer == (i + 1) % 2;       // Went on from buffer 1
+        }
+        check.expect(alternate, "101 pixels: buffers not alternating over 26 submits");
+        check.expect(stub.getStream() == wire(source.pixels, 101), "101 pixels: wrong bytes");
+        check.expect(stub.getOverwrites() == 0 && stub.getMaxInFlight() == 2,
+                     "101 pixels: %u overwrites, %u in flight at most",
+                     (unsigned)stub.getOverwrites(), (unsigned)stub.getMaxInFlight());
+
+        // Pixels already in wire order are sent as they are
+        stub.reset();
+        queue.pushPixels(source.pixels, 7, true);
+        queue.waitIdle();
+        const uint8_t* memory = (const uint8_t*)source.pixels;
+        check.expect(stub.getStream() == Bytes(memory, memory + 14), "swapped pixels: wrong bytes");
+    }
+
+    void fills(HostCheck& check)
+    {
+        Source source;
+        StubTransport stub;
+        LCDTransferQueue queue;
+        queue.begin(&stub, BUFFER_BYTES);
+
+        queue.pushColor(RED, 12);
+        queue.waitIdle();
+        check.expect(stub.getStream() == wire(RED, 12), "12 red pixels: wrong bytes");
+
+        // Both buffers hold four red pixels: a red fill sends them as they
+        // are. A mark left in them shows they were not written again.
+        stub.getBuffer(0)[0] = 0x5A;
+        stub.getBuffer(1)[0] = 0x5A;
+        stub.reset();
+        queue.pushColor(RED, 8);
+        queue.waitIdle();
+        const Bytes& sent = stub.getStream();
+        check.expect(sent.size() == 16 && sent[0] == 0x5A && sent[8] == 0x5A,
+                     "a repeated fill wrote its buffers again");
+
+        // Another color, pixels in between, or more pixels than a buffer
+        // holds of the color: written again
+        stub.reset();
+        queue.pushColor(BLUE, 8);
+        queue.waitIdle();
+        check.expect(stub.getStream() == wire(BLUE, 8), "red then blue: wrong bytes");
+
+        stub.reset();
+        queue.pushPixels(source.pixels, 8);
+        queue.pushColor(BLUE, 8);
+        queue.waitIdle();
+        Bytes expected = wire(source.pixels, 8);
+        Bytes blue = wire(BLUE, 8);
+        expected.insert(expected.end(), blue.begin(), blue.end());
+        check.expect(stub.getStream() == expected, "pixels then blue: wrong bytes");
+
+        stub.reset();
+        queue.pushColor(GREEN, 2);
+        queue.pushColor(GREEN, 8);
+        queue.waitIdle();
+        check.expect(stub.getStream() == wire(GREEN, 10), "2 green then 8 green: wrong bytes");
+
+        const uint32_t pairs[1] = { 0x11223344 };
+        const uint8_t indices[4] = { 0, 0, 0, 0 };
+        stub.reset();
+        queue.pushColor(GREEN, 8);
+        queue.pushIndexed(indices, 8, pairs);
+        queue.pushColor(GREEN, 8);
+        queue.waitIdle();
+        Bytes tail(stub.getStream().end() - 16, stub.getStream().end());
+        check.expect(tail == wire(GREEN, 8), "indexed then green: wrong bytes");
+        check.expect(stub.getOverwrites() == 0, "fills: %u buffers refilled on the wire",
+                     (unsigned)stub.getOverwrites());
+    }
+
+    void indexed(HostCheck& check)
+    {
+        // Entry e is 0x1000 * e + e: the nibbles show in every pixel
+        uint32_t pairs[256];
+        for (uint16_t byte = 0; byte < 256; byte++) {
+            uint16_t pixels[2] = { (uint16_t)((byte >> 4) * 0x1001), (uint16_t)((byte & 0x0F) * 0x1001) };
+            Bytes w = wire(pixels, 2);
+            memcpy(&pairs[byte], w.data(), 4);
+        }
+        uint8_t indices[16];
+        for (uint8_t i = 0; i < 16; i++) indices[i] = (uint8_t)(i * 37 + 11);
+
+        struct Case {
+            size_t bufferBytes;
+            uint32_t count;
+            size_t chunks[4];
+        };
+        // Every chunk but the last ends on a whole index byte
+        const Case cases[] = {
+            { 10, 13, { 8, 8, 10, 0 } },
+            { 8, 7, { 8, 6, 0, 0 } },
+            { 10, 1, { 2, 0, 0, 0 } },
+            { 6, 9, { 4, 4, 4, 6 } },
+        };
+        for (const Case& c : cases) {
+            StubTransport stub;
+            LCDTransferQueue queue;
+            queue.begin(&stub, c.bufferBytes);
+            queue.pushIndexed(indices, c.count, pairs);
+            queue.waitIdle();
+
+            std::vector<uint16_t> pixels;
+            for (uint32_t i = 0; i < c.count; i++) {
+                uint8_t byte = indices[i / 2];
+                uint8_t entry = (i & 1) ? (byte & 0x0F) : (byte >> 4);
+                pixels.push_back((uint16_t)(entry * 0x1001));
+            }
+            check.expect(stub.getStream() == wire(pixels.data(), c.count),
+                         "%u indices in %u-byte buffers: wrong bytes",
+                         (unsigned)c.count, (unsigned)c.bufferBytes);
+
+            const std::vector<StubTransport::Submit>& submits = stub.getSubmits();
+            bool sizes = true;
+            for (size_t i = 0; i < 4; i++) {
+                size_t got = i < submits.size() ? submits[i].bytes : 0;
+                sizes = sizes && got == c.chunks[i];
+            }
+            check.expect(sizes && submits.size() <= 4,
+                         "%u indices in %u-byte buffers: wrong chunks",
+                         (unsigned)c.count, (unsigned)c.bufferBytes);
+        }
+    }
+
+    void refusals(HostCheck& check)
+    {
+        Source source;
+
+        // Refused with nothing in flight: the stream is dropped, not spun on
+        {
+            StubTransport stub;
+            LCDTransferQueue queue;
+            queue.begin(&stub, BUFFER_BYTES);
+            uint32_t idle = 0, flushed = 0;
+            queue.setIdleHook(countCall, &idle);
+            stub.refuseAll(true);
+            queue.pushColor(RED, 100);
+            check.expect(!queue.isBusy(), "a refused stream still busy");
+            check.expect(queue.getErrors() == 1 && queue.getTransfers() == 0,
+                         "refused stream: %u errors, %u transfers",
+                         (unsigned)queue.getErrors(), (unsigned)queue.getTransfers());
+            check.expect(stub.getStream().empty() && stub.getRefusals() == 1,
+                         "refused stream: %u bytes sent, %u refusals",
+                         (unsigned)stub.getStream().size(), (unsigned)stub.getRefusals());
+            queue.flush(countCall, &flushed);
+            check.expect(idle == 1 && flushed == 1 && stub.getIdleNotifies() == 1,
+                         "refused stream: idle hook %u, flush %u, notifyIdle %u",
+                         (unsigned)idle, (unsigned)flushed, (unsigned)stub.getIdleNotifies());
+
+            // The transport takes transfers again: so does the queue
+            stub.refuseAll(false);
+            queue.pushColor(BLUE, 6);
+            queue.waitIdle();
+            check.expect(stub.getStream() == wire(BLUE, 6) && queue.getErrors() == 1,
+                         "the stream after a refused one: wrong bytes or errors");
+        }
+
+        // Refused with a buffer in flight: retried once it completes
+        {
+            StubTransport stub;
+            LCDTransferQueue queue;
+            queue.begin(&stub, BUFFER_BYTES);
+            stub.setCompletions(0);
+            queue.pushPixels(source.pixels, 12);
+            stub.refuse(1);
+            queue.waitIdle();
+            check.expect(stub.getRefusals() == 1 && queue.getErrors() == 0,
+                         "refused third buffer: %u refusals, %u errors",
+                         (unsigned)stub.getRefusals(), (unsigned)queue.getErrors());
+            check.expect(stub.getStream() == wire(source.pixels, 12),
+                         "refused third buffer: wrong bytes");
+        }
+
+        // Refused again once the wire has drained: the rest is dropped
+        {
+            StubTransport stub;
+            LCDTransferQueue queue;
+            queue.begin(&stub, BUFFER_BYTES);
+            stub.setCompletions(0);
+            queue.pushPixels(source.pixels, 12);
+            stub.refuseAll(true);
+            queue.waitIdle();
+            check.expect(!queue.isBusy() && queue.getErrors() == 1,
+                         "refused after draining: busy %d, %u errors",
+                         queue.isBusy(), (unsigned)queue.getErrors());
+            check.expect(stub.getStream() == wire(source.pixels, 8),
+                         "refused after draining: %u bytes sent, 16 were accepted",
+                         (unsigned)stub.getStream().size());
+        }
+    }
+
+    void flushes(HostCheck& check)
+    {
+        Source source;
+        StubTransport stub;
+        LCDTransferQueue queue;
+        queue.begin(&stub, BUFFER_BYTES);
+        uint32_t idle = 0;
+        queue.setIdleHook(countCall, &idle);
+
+        uint32_t first = 0;
+        queue.flush(countCall, &first);
+        check.expect(first == 1, "flush() on an idle queue ran %u times", (unsigned)first);
+
+        // Stored while the stream runs, fired by the end of it
+        first = 0;
+        stub.setCompletions(0);
+        queue.pushPixels(source.pixels, 12);
+        queue.flush(countCall, &first);
+        queue.pump(false);
+        check.expect(first == 0, "flush() ran with the stream still on the wire");
+        queue.waitIdle();
+        queue.pump(true);
+        queue.waitIdle();
+        check.expect(first == 1, "flush() ran %u times for one stream", (unsigned)first);
+
+        // A second flush waits for the first one's stream, then runs
+        uint32_t a = 0, b = 0;
+        queue.pushPixels(source.pixels, 12);
+        queue.flush(countCall, &a);
+        queue.flush(countCall, &b);
+        check.expect(a == 1 && b == 1, "two flushes: ran %u and %u times", (unsigned)a, (unsigned)b);
+        queue.pushColor(RED, 12);
+        queue.waitIdle();
+        check.expect(a == 1 && b == 1 && first == 1, "flush callbacks ran again for a later stream");
+
+        check.expect(idle == 3 && stub.getIdleNotifies() == 3,
+                     "3 streams: idle hook %u, notifyIdle %u",
+                     (unsigned)idle, (unsigned)stub.getIdleNotifies());
+        check.expect(stub.getLockDepth() == 0 && stub.getMaxLockDepth() == 1,
+                     "lock depth %u at the end, %u at most",
+                     (unsigned)stub.getLockDepth(), (unsigned)stub.getMaxLockDepth());
+    }
+
+    void pumping(HostCheck& check)
+    {
+        Source source;
+        StubTransport stub;
+        LCDTransferQueue queue;
+        queue.begin(&stub, BUFFER_BYTES);
+
+        // All queued, nothing done: pump(false) never blocks
+        stub.setCompletions(0);
+        queue.pushPixels(source.pixels, 6);
+        bool busy = queue.pump(false);
+        check.expect(busy && stub.getInFlight() == 2 && stub.getWaits() == 0,
+                     "pump(false): busy %d, %u in flight, %u waits",
+                     busy, (unsigned)stub.getInFlight(), (unsigned)stub.getWaits());
+
+        // Each pump(true) retires the oldest buffer
+        busy = queue.pump(true);
+        check.expect(busy && stub.getInFlight() == 1, "first pump(true): busy %d, %u in flight",
+                     busy, (unsigned)stub.getInFlight());
+        busy = queue.pump(true);
+        check.expect(!busy && !queue.isBusy() && stub.getInFlight() == 0,
+                     "second pump(true): busy %d, %u in flight",
+                     busy, (unsigned)stub.getInFlight());
+        check.expect(!queue.pump(true) && stub.getWaits() == 2,
+                     "pump() on an idle queue: %u waits", (unsigned)stub.getWaits());
+
+        // Completions as they come: polling alone finishes a long stream
+        stub.reset();
+        stub.setCompletions(1);
+        queue.pushPixels(source.pixels, 40);
+        uint32_t polls = 0;
+        while (queue.pump(false) && polls < 1000) polls++;
+        check.expect(!queue.isBusy() && stub.getWaits() == 0,
+                     "polled stream: busy %d after %u polls, %u waits",
+                     queue.isBusy(), (unsigned)polls, (unsigned)stub.getWaits());
+        check.expect(stub.getStream() == wire(source.pixels, 40), "polled stream: wrong bytes");
+    }
+}
+
+void checkTransferQueue(HostCheck& check)
+{
+    check.begin("queue_rotation");
+    rotation(check);
+
+    check.begin("queue_fill");
+    fills(check);
+
+    check.begin("queue_indexed");
+    indexed(check);
+
+    check.begin("queue_refusal");
+    refusals(check);
+
+    check.begin("queue_flush");
+    flushes(check);
+
+    check.begin("queue_pump");
+    pumping(check);
+}
@@ -0,0 +1,24 @@
+/*****************************************************************************
+ * | File        : Checks.cpp
+ * | Function    : Host checks of the class library internals
+ * | Info        : env:checks
+ * |
+ * |   pio run -e checks -t exec
+ * |
+ * | Exits with 1 when a check fails.
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "Checks.h"
+
+int main()
+{
+    HostCheck check;
+    checkSPIBus(check);
+    checkTransferQueue(check);
+    checkIndexedCanvas(check);
+    checkFonts(check);
+
+    check.print();
+    return check.passed() ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+/*****************************************************************************
+ * | File        : Checks.h
+ * | Function    : The groups of host checks (env:checks)
+ *****************************************************************************/
+
+#ifndef __CHECKS_H
+#define __CHECKS_H
+
+#include "HostCheck.h"
+
+// CheckBus.cpp: SPIBus arbitration, the panel and touch on one bus
+void checkSPIBus(HostCheck& check);
+
+// CheckQueue.cpp: LCDTransferQueue on the scripted StubTransport
+void checkTransferQueue(HostCheck& check);
+
+// CheckIndexed.cpp: LCDIndexedCanvas flushed, against LCDCanvas
+void checkIndexedCanvas(HostCheck& check);
+
+// CheckFonts.cpp: Font8..Font24 against Font8P..Font24P, opaque, transparent, cached
+void checkFonts(HostCheck& check);
+
+#endif // __CHECKS_H
@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * | File        : GoldenCheck.cpp
+ * | Function    : Screens drawn through the panel model, compared with golden images
+ *****************************************************************************/
+
+#include "GoldenCheck.h"
+#include <stdio.h>
+
+namespace {
+    const char* const RESULT_NAMES[] = {
+        "match", "DIFFERENT", "NO GOLDEN", "BAD STREAM", "updated", "CANNOT WRITE"
+    };
+}
+
+GoldenCheck::GoldenCheck(const char* target, ILI9486Model& panel, bool update)
+    : _target(target)
+    , _panel(panel)
+    , _update(update)
+    , _count(0)
+{
+}
+
+void GoldenCheck::powerOn()
+{
+    _panel.reset();
+}
+
+void GoldenCheck::compare(const char* scene)
+{
+    if (_count == MAX_SCENES) return;
+    Scene& s = _scenes[_count++];
+    s.name = scene;
+    s.stats = _panel.getStats();
+    s.difference = PanelImage::Difference{};
+
+    PanelImage image;
+    _panel.render(image);
+
+    char golden[128], render[128];
+    snprintf(golden, sizeof(golden), "golden/%s/%s.png", _target, scene);
+    snprintf(render, sizeof(render), "render_%s_%s.png", _target, scene);
+
+    // Words the shift register would have garbled make the picture moot
+    if (s.stats.badPad > 0 || s.stats.strayData > 0) {
+        s.result = Result::STREAM;
+        image.write(render);
+        return;
+    }
+
+    if (_update) {
+        s.result = image.write(golden) ? Result::UPDATED : Result::WRITE_FAILED;
+        return;
+    }
+
+    PanelImage expected;
+    if (!expected.read(golden)) {
+        s.result = Result::MISSING;
+        image.write(render);
+        return;
+    }
+
+    s.difference = PanelImage::compare(image, expected);
+    if (s.difference.pixels == 0) {
+        s.result = Result::MATCH;
+    } else {
+        s.result = Result::DIFFERENT;
+        image.write(render);
+    }
+}
+
+bool GoldenCheck::passed() const
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        Result r = _scenes[i].result;
+        if (r != Result::MATCH && r != Result::UPDATED) return false;
+    }
+    return true;
+}
+
+void GoldenCheck::print() const
+{
+    printf("%s\n", _target);
+    printf("%-18s %9s %8s %8s  %s\n", "scene", "commands", "pixels", "clipped", "result");
+    for (uint8_t i = 0; i < _count; i++) {
+        const Scene& s = _scenes[i];
+        printf("%-18s %9u %8u %8u  %s", s.name, (unsigned)s.stats.commands,
+               (unsigned)s.stats.pixels, (unsigned)s.stats.clipped,
+               RESULT_NAMES[(uint8_t)s.result]);
+        if (s.result == Result::DIFFERENT) {
+            const PanelImage::Difference& d = s.difference;
+            printf(" %u px in (%u,%u)-(%u,%u)", (unsigned)d.pixels,
+                   d.x0, d.y0, d.x1, d.y1);
+        } else if (s.result == Result::STREAM) {
+            printf(" %u padded, %u stray", (unsigned)s.stats.badPad,
+                   (unsigned)s.stats.strayData);
+        }
+        printf("\n");
+    }
+    printf("%s\n", passed() ? "PASS" : "FAIL");
+}
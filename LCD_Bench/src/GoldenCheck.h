@@ -0,0 +1,67 @@
+/*****************************************************************************
+ * | File        : GoldenCheck.h
+ * | Function    : Screens drawn through the panel model, compared with golden images
+ * | Info        : The pictures are the reference; any change to a pixel fails
+ * |
+ * | Each scene starts the panel from power-on, draws with the real
+ * | application or demo code and is rendered by ILI9486Model. The picture
+ * | must be identical to golden/<target>/<scene>.png, pixel for pixel, so
+ * | a faster way to draw something can be shown to draw the same thing:
+ * |
+ * |   static ILI9486Model panel;
+ * |   BusRecorder::instance().setPanelSink(&panel);
+ * |   GoldenCheck check("class", panel, update);
+ * |   check.powerOn();
+ * |   app.begin();
+ * |   check.compare("calculator");
+ * |   check.print();
+ * |   return check.passed() ? 0 : 1;
+ * |
+ * | A scene that differs is written to render_<target>_<scene>.png for a
+ * | look. With 'update' the renders replace the golden images instead;
+ * | do that only for a change that is meant to look different, and look
+ * | at the new pictures before committing them.
+ *****************************************************************************/
+
+#ifndef __GOLDEN_CHECK_H
+#define __GOLDEN_CHECK_H
+
+#include <stdint.h>
+#include "ILI9486Model.h"
+#include "PanelImage.h"
+
+class GoldenCheck {
+public:
+    static constexpr uint8_t MAX_SCENES = 16;
+
+    GoldenCheck(const char* target, ILI9486Model& panel, bool update);
+
+    // The panel as it comes out of power-on
+    void powerOn();
+
+    // Render the panel and hold it against the golden image of 'scene'
+    void compare(const char* scene);
+
+    // Table on stdout
+    void print() const;
+
+    bool passed() const;
+
+private:
+    enum class Result : uint8_t { MATCH, DIFFERENT, MISSING, STREAM, UPDATED, WRITE_FAILED };
+
+    struct Scene {
+        const char* name;
+        Result result;
+        ILI9486Model::Stats stats;
+        PanelImage::Difference difference;
+    };
+
+    const char* _target;
+    ILI9486Model& _panel;
+    bool _update;
+    Scene _scenes[MAX_SCENES];
+    uint8_t _count;
+};
+
+#endif // __GOLDEN_CHECK_H
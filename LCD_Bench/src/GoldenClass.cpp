@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * | File        : GoldenClass.cpp
+ * | Function    : Golden images of the screens drawn with the class library
+ * | Info        : env:golden; the Calculator, the RavKav gate and GUI_Show
+ * |
+ * |   pio run -e golden -t exec
+ * |   .pio/build/golden/program --update     # Rewrite the images in golden/class
+ * |
+ * | Exits with 1 when a screen differs from its golden image.
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "WaveShare.h"
+#include "CalculatorApp.h"
+#include "GateScreen.h"
+#include "BusRecorder.h"
+#include "ILI9486Model.h"
+#include "GoldenCheck.h"
+
+// GUI_Show() is part of the demo application, not of a library
+#include "../../WaveShareLCD_Demo_with_class/src/WaveShareDemo.cpp"
+
+namespace {
+    // The SPI bus takes four devices: the calculator's panel and touch
+    // controller, and one more pair for everything else
+    CalculatorApp app;
+    WaveShare screen;
+    GateScreen gate(screen);
+
+    ILI9486Model panel;
+
+    void gateScenes(GoldenCheck& check)
+    {
+        check.powerOn();
+        screen.begin();
+        gate.begin("192.168.1.20");
+        screen.getLCD().waitIdle();
+        check.compare("ravkav_ready");
+
+        // More cards than the log has lines: it scrolls
+        char line[48];
+        for (uint16_t i = 0; i < 14; i++) {
+            snprintf(line, sizeof(line), "%6us  Entry OK, budget=%u\n", 12 + i * 7, 55 - i);
+            gate.log(line);
+        }
+        gate.showStatus("Denied: budget=0");
+        gate.showStatus("Balance = 41 ILS");
+        screen.getLCD().waitIdle();
+        check.compare("ravkav_gate");
+
+        gate.showLeft(41);
+        screen.getLCD().waitIdle();
+        check.compare("ravkav_left");
+    }
+
+    void demoScenes(GoldenCheck& check)
+    {
+        WaveshareLCD& lcd = screen.getLCD();
+
+        check.powerOn();
+        lcd.begin();
+        GUI_Show(lcd);
+        lcd.waitIdle();
+        check.compare("gui_show");
+
+        check.powerOn();
+        lcd.begin(ScanDir::L2R_U2D);
+        GUI_Show(lcd);
+        lcd.waitIdle();
+        check.compare("gui_show_portrait");
+
+        // Portrait with the gates scanned upwards: the console scrolls
+        // through the panel's scroll registers
+        check.powerOn();
+        lcd.begin(ScanDir::R2L_D2U);
+        lcd.clear(Colors::WHITE);
+        LCDConsole console(lcd);
+        console.begin(40, lcd.getHeight() - 80, &Font16, Colors::BLACK, Colors::GREEN);
+        char line[48];
+        for (uint16_t i = 0; i < 40; i++) {
+            snprintf(line, sizeof(line), "Line %u of the console\n", i);
+            console.print(line);
+        }
+        lcd.waitIdle();
+        check.compare("console_scroll");
+
+        // Text at x = 0 that grows, then shrinks, over three retained
+        // frames: only the changes are sent, and nothing stale may stay
+        check.powerOn();
+        lcd.begin();
+        LCDBandRenderer scene;
+        scene.begin(lcd);
+        scene.setBackground(Colors::WHITE);
+        static const char* const FRAMES[] = { "777", "123456789", "99999" };
+        for (const char* text : FRAMES) {
+            scene.clear(Colors::WHITE);
+            scene.drawString(0, 40, text, &Font16, Colors::WHITE, Colors::BLACK);
+            scene.drawString(0, 80, text, &Font24, Colors::WHITE, Colors::BLUE);
+            scene.present();
+        }
+        scene.end();
+        lcd.waitIdle();
+        check.compare("retained_text");
+
+        // A centered label in the top left corner that shrinks onto
+        // another grid: the strips it erases start at x = 0 and y = 0.
+        // On its own background the screen is the same as "1" drawn once
+        check.powerOn();
+        lcd.begin();
+        lcd.clear(Colors::BLACK);
+        LCDLabel corner;
+        corner.begin(lcd, 0, 0, 136, 24, &Font24, Colors::BLACK, Colors::WHITE,
+                     LCDLabel::Align::CENTER);
+        corner.setText("12345678");
+        corner.setText("1");
+        lcd.waitIdle();
+        check.compare("label_edge");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+
+    LCDPins pins;
+    BusRecorder& bus = BusRecorder::instance();
+    bus.watchPanel(pins.cs, pins.dc);
+    bus.setPanelSink(&panel);
+
+    GoldenCheck check("class", panel, update);
+
+    check.powerOn();
+    app.begin();
+    app.getLCD().getLCD().waitIdle();
+    check.compare("calculator");
+
+    gateScenes(check);
+    demoScenes(check);
+
+    check.print();
+    return check.passed() ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * | File        : GoldenLegacy.cpp
+ * | Function    : Golden images of the screens drawn with the legacy LCD_GUI
+ * | Info        : env:golden_legacy; GUI_Show, the touch dialog and scrolling
+ * |
+ * |   pio run -e golden_legacy -t exec
+ * |   .pio/build/golden_legacy/program --update    # Rewrite the images in golden/legacy
+ * |
+ * | Exits with 1 when a screen differs from its golden image.
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "WVSHR_Config.h"
+#include "LCD_Driver.h"
+#include "LCD_GUI.h"
+#include "LCD_Label.h"
+#include "BusRecorder.h"
+#include "ILI9486Model.h"
+#include "GoldenCheck.h"
+
+// GUI_Show() and TP_Dialog() are part of the demo application, not of a library
+#include "../../WaveShareLCD_Demo/src/WaveShareDemo.cpp"
+
+namespace {
+    ILI9486Model panel;
+
+    // Numbered bands down a portrait screen, then the middle of it
+    // scrolled by 100 lines between fixed top and bottom areas
+    void scrollScene()
+    {
+        LCD_Init(L2R_D2U, 200);
+        LCD_Clear(WHITE);
+
+        const COLOR colors[4] = { RED, GREEN, BLUE, YELLOW };
+        char label[8];
+        for (uint16_t band = 0; band < 12; band++) {
+            POINT y = band * 40;
+            GUI_DrawRectangle(0, y, sLCD_DIS.LCD_Dis_Column, y + 40, colors[band % 4],
+                              DRAW_FULL, DOT_PIXEL_1X1);
+            snprintf(label, sizeof(label), "%u", band);
+            GUI_DisString_EN(10, y + 10, label, &Font20, colors[band % 4], BLACK);
+        }
+
+        LCD_SetScrollArea(40, 40);
+        LCD_ScrollTo(140);
+    }
+
+    // A centered label in the top left corner that shrinks onto another
+    // grid; on its own background the screen is "1" drawn once
+    void labelEdgeScene()
+    {
+        LCD_Init(SCAN_DIR_DFT, 200);
+        LCD_Clear(BLACK);
+
+        GUI_LABEL corner;
+        GUI_LabelInit(&corner, 0, 0, 136, 24, &Font24, BLACK, WHITE, LABEL_CENTER);
+        GUI_LabelString(&corner, "12345678");
+        GUI_LabelString(&corner, "1");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+
+    BusRecorder& bus = BusRecorder::instance();
+    bus.watchPanel(LCD_CS, LCD_DC);
+    bus.setPanelSink(&panel);
+
+    GoldenCheck check("legacy", panel, update);
+    Wvshr_Init();
+
+    check.powerOn();
+    LCD_Init(SCAN_DIR_DFT, 200);
+    GUI_Show();
+    check.compare("gui_show");
+
+    check.powerOn();
+    LCD_Init(L2R_U2D, 200);
+    GUI_Show();
+    check.compare("gui_show_portrait");
+
+    check.powerOn();
+    LCD_Init(SCAN_DIR_DFT, 200);
+    TP_Dialog();
+    check.compare("tp_dialog");
+
+    check.powerOn();
+    scrollScene();
+    check.compare("scroll");
+
+    check.powerOn();
+    labelEdgeScene();
+    check.compare("label_edge");
+
+    check.print();
+    return check.passed() ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * | File        : HostCheck.cpp
+ * | Function    : Pass/fail checks of library internals on the host
+ *****************************************************************************/
+
+#include "HostCheck.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+HostCheck::HostCheck()
+    : _count(0)
+{
+}
+
+void HostCheck::begin(const char* group)
+{
+    if (_count == MAX_GROUPS) return;
+    _groups[_count++] = Group{ group, 0, 0 };
+}
+
+bool HostCheck::expect(bool ok, const char* format, ...)
+{
+    if (_count == 0) begin("checks");
+    Group& g = _groups[_count - 1];
+    g.checks++;
+    if (ok) return true;
+
+    g.failed++;
+    printf("FAIL %s: ", g.name);
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+    return false;
+}
+
+bool HostCheck::passed() const
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_groups[i].failed > 0) return false;
+    }
+    return true;
+}
+
+void HostCheck::print() const
+{
+    printf("%-18s %8s %8s  %s\n", "group", "checks", "failed", "result");
+    for (uint8_t i = 0; i < _count; i++) {
+        const Group& g = _groups[i];
+        printf("%-18s %8u %8u  %s\n", g.name, (unsigned)g.checks, (unsigned)g.failed,
+               g.failed == 0 ? "ok" : "FAIL");
+    }
+    printf("%s\n", passed() ? "PASS" : "FAIL");
+}
@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * | File        : HostCheck.h
+ * | Function    : Pass/fail checks of library internals on the host
+ * | Info        : The checks that need no picture: bus arbitration, queues
+ * |
+ * | Some behavior is not a screen: which chip select is low while another
+ * | device talks, how the transfer queue hands its buffers out. Each group
+ * | of checks runs on the host stubs and counts what it expects:
+ * |
+ * |   HostCheck check;
+ * |   check.begin("spi_bus");
+ * |   check.expect(bus.acquire(touch), "touch taken");
+ * |   check.expect(clock == 2000000, "touch clock %u", clock);
+ * |   check.print();
+ * |   return check.passed() ? 0 : 1;
+ * |
+ * | A failed check prints its message right away; print() gives a table of
+ * | the groups.
+ *****************************************************************************/
+
+#ifndef __HOST_CHECK_H
+#define __HOST_CHECK_H
+
+#include <stdint.h>
+
+class HostCheck {
+public:
+    static constexpr uint8_t MAX_GROUPS = 16;
+
+    HostCheck();
+
+    // Start counting checks under 'group'
+    void begin(const char* group);
+
+    // Count one check; prints 'format' when it fails. Returns 'ok'.
+    bool expect(bool ok, const char* format, ...)
+        __attribute__((format(printf, 3, 4)));
+
+    // Table on stdout
+    void print() const;
+
+    bool passed() const;
+
+private:
+    struct Group {
+        const char* name;
+        uint32_t checks;
+        uint32_t failed;
+    };
+
+    Group _groups[MAX_GROUPS];
+    uint8_t _count;
+};
+
+#endif // __HOST_CHECK_H
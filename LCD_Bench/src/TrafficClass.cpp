@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * | File        : TrafficClass.cpp
+ * | Function    : Bus traffic of the WaveshareLCD / LCDTouch classes
+ * | Info        : env:native; runs the workload, writes traffic_class.json
+ * |
+ * |   pio run -e native -t exec
+ * |   .pio/build/native/program [report.json]
+ * |
+ * | Exits with 1 when a step is over its limit (see TrafficLimits.cpp).
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "WaveshareLCD.h"
+#include "LCDTouch.h"
+#include "BusRecorder.h"
+#include "TrafficReport.h"
+#include "Workload.h"
+
+int main(int argc, char** argv)
+{
+    const char* path = argc > 1 ? argv[1] : "traffic_class.json";
+
+    LCDPins pins;
+    TouchPins touchPins;
+    BusRecorder& bus = BusRecorder::instance();
+    bus.watchPanel(pins.cs, pins.dc);
+    bus.watchChipSelect(touchPins.cs);
+
+    WaveshareLCD lcd(pins);
+    LCDTouch touch(lcd, touchPins);
+    TrafficReport report("WaveshareLCD");
+
+    report.begin("init");
+    lcd.begin();
+    touch.begin();
+    report.end();
+
+    LENGTH width = lcd.getWidth();
+    LENGTH height = lcd.getHeight();
+
+    report.begin("clear");
+    lcd.clear(Colors::WHITE);
+    lcd.waitIdle();
+    report.end();
+
+    Workload::Random random;
+    report.begin("lines");
+    for (uint16_t i = 0; i < Workload::LINES; i++) {
+        Workload::Line l = Workload::line(random, width, height);
+        lcd.drawLine(l.x0, l.y0, l.x1, l.y1, l.color);
+    }
+    lcd.waitIdle();
+    report.end();
+
+    report.begin("circles");
+    for (uint16_t i = 0; i < Workload::CIRCLES; i++) {
+        Workload::Circle c = Workload::circle(random, width, height);
+        lcd.drawCircle(c.x, c.y, c.radius, c.color, DrawFill::FULL);
+    }
+    lcd.waitIdle();
+    report.end();
+
+    char row[Workload::TEXT_MAX_COLUMNS + 1];
+    uint16_t columns = width / Workload::TEXT_CHAR_WIDTH;
+    report.begin("text");
+    for (uint16_t r = 0; r < height / Workload::TEXT_CHAR_HEIGHT; r++) {
+        Workload::textRow(r, columns, row);
+        lcd.drawString(1, 1 + r * Workload::TEXT_CHAR_HEIGHT, row, &Font16,
+                       Colors::BLACK, Colors::WHITE);
+    }
+    lcd.waitIdle();
+    report.end();
+
+    // The class library has no BMP reader: the file is converted up front
+    // and only the blit is measured
+    static uint8_t bmp[Workload::BMP_SIZE];
+    static COLOR pixels[Workload::BMP_WIDTH * Workload::BMP_HEIGHT];
+    Workload::makeBmp(bmp);
+    Workload::decodeBmp(bmp, pixels);
+    report.begin("bmp");
+    lcd.blit(Workload::BMP_X, Workload::BMP_Y, Workload::BMP_WIDTH, Workload::BMP_HEIGHT, pixels);
+    lcd.waitIdle();
+    report.end();
+
+    // IRQ low: the controller reports a touch and every scan reads it
+    bus.setInput(touchPins.irq, LOW);
+    report.begin("touch");
+    for (uint16_t i = 0; i < Workload::TOUCH_SCANS; i++) {
+        touch.scan();
+    }
+    report.end();
+    bus.setInput(touchPins.irq, HIGH);
+
+    report.print();
+    if (!report.write(path)) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 2;
+    }
+    return report.passed() ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * | File        : TrafficLegacy.cpp
+ * | Function    : Bus traffic of the legacy LCD_Driver / LCD_GUI functions
+ * | Info        : env:native_legacy; runs the workload, writes traffic_legacy.json
+ * |
+ * |   pio run -e native_legacy -t exec
+ * |   .pio/build/native_legacy/program [report.json]
+ * |
+ * | Exits with 1 when a step is over its limit (see TrafficLimits.cpp).
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "WVSHR_Config.h"
+#include "LCD_Driver.h"
+#include "LCD_GUI.h"
+#include "LCD_Touch.h"
+#include "LCD_Bmp.h"
+#include "BusRecorder.h"
+#include "TrafficReport.h"
+#include "Workload.h"
+
+int main(int argc, char** argv)
+{
+    const char* path = argc > 1 ? argv[1] : "traffic_legacy.json";
+
+    BusRecorder& bus = BusRecorder::instance();
+    bus.watchPanel(LCD_CS, LCD_DC);
+    bus.watchChipSelect(TP_CS);
+
+    TrafficReport report("LCD_GUI");
+
+    report.begin("init");
+    Wvshr_Init();
+    LCD_Init(SCAN_DIR_DFT, 200);
+    TP_Init();
+    report.end();
+
+    LENGTH width = sLCD_DIS.LCD_Dis_Column;
+    LENGTH height = sLCD_DIS.LCD_Dis_Page;
+
+    report.begin("clear");
+    LCD_Clear(WHITE);
+    report.end();
+
+    Workload::Random random;
+    report.begin("lines");
+    for (uint16_t i = 0; i < Workload::LINES; i++) {
+        Workload::Line l = Workload::line(random, width, height);
+        GUI_DrawLine(l.x0, l.y0, l.x1, l.y1, l.color, LINE_SOLID, DOT_PIXEL_1X1);
+    }
+    report.end();
+
+    report.begin("circles");
+    for (uint16_t i = 0; i < Workload::CIRCLES; i++) {
+        Workload::Circle c = Workload::circle(random, width, height);
+        GUI_DrawCircle(c.x, c.y, c.radius, c.color, DRAW_FULL, DOT_PIXEL_1X1);
+    }
+    report.end();
+
+    char row[Workload::TEXT_MAX_COLUMNS + 1];
+    uint16_t columns = width / Workload::TEXT_CHAR_WIDTH;
+    report.begin("text");
+    for (uint16_t r = 0; r < height / Workload::TEXT_CHAR_HEIGHT; r++) {
+        Workload::textRow(r, columns, row);
+        GUI_DisString_EN(1, 1 + r * Workload::TEXT_CHAR_HEIGHT, row, &Font16, BLACK, WHITE);
+    }
+    report.end();
+
+    // The BMP goes through the memory file the web upload fills, in
+    // upload-sized records; only the drawing is measured
+    static uint8_t bmp[Workload::BMP_SIZE];
+    Workload::makeBmp(bmp);
+    BmpMF file;
+    for (uint32_t offset = 0; offset < Workload::BMP_SIZE; offset += 1436) {
+        uint32_t length = Workload::BMP_SIZE - offset;
+        file.BmpMFwrite(bmp + offset, length < 1436 ? length : 1436);
+    }
+    ReadBmpHeader(file);
+    report.begin("bmp");
+    LCD_DrawBmp(file, Workload::BMP_X, Workload::BMP_Y, 1);
+    report.end();
+    file.BmpMFfree();
+
+    // IRQ low: the controller reports a touch and every scan reads it
+    bus.setInput(TP_IRQ, LOW);
+    report.begin("touch");
+    for (uint16_t i = 0; i < Workload::TOUCH_SCANS; i++) {
+        TP_Scan(0);
+    }
+    report.end();
+    bus.setInput(TP_IRQ, HIGH);
+
+    report.print();
+    if (!report.write(path)) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 2;
+    }
+    return report.passed() ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * | File        : TrafficLimits.cpp
+ * | Function    : Most bus traffic each workload step may cause
+ * | Info        : The counts of the drivers as they are; lower them when a
+ * |               change makes a step cheaper, never raise them to pass
+ *****************************************************************************/
+
+#include "TrafficLimits.h"
+
+const TrafficLimit TRAFFIC_LIMITS[] = {
+    //  target            step           bytes   trans        cs  windows
+    { "WaveshareLCD",  "init",          188,      2,        4,       0 },
+    { "WaveshareLCD",  "clear",      307222,      1,        2,       1 },
+    { "WaveshareLCD",  "lines",     2446482,   1000,     2000,  107923 },
+    { "WaveshareLCD",  "circles",    507468,    100,      200,    4859 },
+    { "WaveshareLCD",  "text",       303064,     20,       40,      20 },
+    { "WaveshareLCD",  "bmp",         38422,      1,        2,       1 },
+    { "WaveshareLCD",  "touch",        6000,   1000,     2000,       0 },
+
+    { "LCD_GUI",       "init",          188,      2,        4,       0 },
+    { "LCD_GUI",       "clear",      307222,      1,        2,       1 },
+    { "LCD_GUI",       "lines",     2446482,   1000,     2000,  107923 },
+    { "LCD_GUI",       "circles",    507468,    100,      200,    4859 },
+    { "LCD_GUI",       "text",       303064,     20,       40,      20 },
+    { "LCD_GUI",       "bmp",         39850,    240,      480,     120 },
+    { "LCD_GUI",       "touch",        6000,   1000,     2000,       0 },
+};
+
+const size_t TRAFFIC_LIMIT_COUNT = sizeof(TRAFFIC_LIMITS) / sizeof(TRAFFIC_LIMITS[0]);
@@ -0,0 +1,25 @@
+/*****************************************************************************
+ * | File        : TrafficLimits.h
+ * | Function    : Most bus traffic each workload step may cause
+ * | Info        : The table is in TrafficLimits.cpp
+ *****************************************************************************/
+
+#ifndef __TRAFFIC_LIMITS_H
+#define __TRAFFIC_LIMITS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct TrafficLimit {
+    const char* target;         // TrafficReport target name
+    const char* step;
+    uint64_t bytes;
+    uint64_t transactions;
+    uint64_t csToggles;
+    uint64_t windows;
+};
+
+extern const TrafficLimit TRAFFIC_LIMITS[];
+extern const size_t TRAFFIC_LIMIT_COUNT;
+
+#endif // __TRAFFIC_LIMITS_H
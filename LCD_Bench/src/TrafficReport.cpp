@@ -0,0 +1,156 @@
+/*****************************************************************************
+ * | File        : TrafficReport.cpp
+ * | Function    : Bus traffic per workload step, checked against limits
+ *****************************************************************************/
+
+#include "TrafficReport.h"
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+    // The metrics with a limit, in report order
+    enum Metric : uint8_t { BYTES, TRANSACTIONS, CS_TOGGLES, WINDOWS, METRICS };
+    const char* const METRIC_NAMES[METRICS] = { "bytes", "transactions", "csToggles", "windows" };
+
+    uint64_t measured(const BusRecorder::Counters& counters, uint8_t metric) {
+        switch (metric) {
+        case BYTES:         return counters.bytes;
+        case TRANSACTIONS:  return counters.transactions;
+        case CS_TOGGLES:    return counters.csToggles;
+        default:            return counters.windows;
+        }
+    }
+
+    uint64_t allowed(const TrafficLimit& limit, uint8_t metric) {
+        switch (metric) {
+        case BYTES:         return limit.bytes;
+        case TRANSACTIONS:  return limit.transactions;
+        case CS_TOGGLES:    return limit.csToggles;
+        default:            return limit.windows;
+        }
+    }
+
+    uint64_t nowNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+TrafficReport::TrafficReport(const char* target)
+    : _target(target)
+    , _count(0)
+    , _startNanos(0)
+{
+    memset(&_start, 0, sizeof(_start));
+}
+
+void TrafficReport::begin(const char* step)
+{
+    if (_count == MAX_STEPS) return;
+    _steps[_count].name = step;
+    _start = BusRecorder::instance().getCounters();
+    _startNanos = nowNanos();
+}
+
+void TrafficReport::end()
+{
+    if (_count == MAX_STEPS) return;
+    Step& step = _steps[_count++];
+    step.hostMicros = (nowNanos() - _startNanos) / 1000;
+    step.counters = BusRecorder::instance().getCounters() - _start;
+    step.limit = findLimit(step.name);
+}
+
+const TrafficLimit* TrafficReport::findLimit(const char* step) const
+{
+    for (size_t i = 0; i < TRAFFIC_LIMIT_COUNT; i++) {
+        const TrafficLimit& limit = TRAFFIC_LIMITS[i];
+        if (strcmp(limit.target, _target) == 0 && strcmp(limit.step, step) == 0) {
+            return &limit;
+        }
+    }
+    return nullptr;
+}
+
+bool TrafficReport::over(const Step& step, uint8_t metric)
+{
+    return step.limit != nullptr && measured(step.counters, metric) > allowed(*step.limit, metric);
+}
+
+bool TrafficReport::passed() const
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        for (uint8_t m = 0; m < METRICS; m++) {
+            if (over(_steps[i], m)) return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+void TrafficReport::print() const
+{
+    printf("%s\n", _target);
+    printf("%-8s %10s %8s %8s %8s %9s %10s %10s\n",
+           "step", "bytes", "trans", "cs", "windows", "pixels", "bus us", "host us");
+    for (uint8_t i = 0; i < _count; i++) {
+        const Step& step = _steps[i];
+        const BusRecorder::Counters& c = step.counters;
+        printf("%-8s %10" PRIu64 " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %9" PRIu64
+               " %10" PRIu64 " %10" PRIu64,
+               step.name, c.bytes, c.transactions, c.csToggles, c.windows, c.pixels,
+               c.busNanos / 1000, step.hostMicros);
+        for (uint8_t m = 0; m < METRICS; m++) {
+            if (over(step, m)) {
+                printf("  %s over %" PRIu64, METRIC_NAMES[m], allowed(*step.limit, m));
+            }
+        }
+        if (step.limit == nullptr) printf("  (no limit)");
+        printf("\n");
+    }
+    printf("%s\n", passed() ? "PASS" : "REGRESSION");
+}
+
+bool TrafficReport::write(const char* path) const
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr) return false;
+
+    fprintf(file, "{\n  \"target\": \"%s\",\n  \"steps\": [\n", _target);
+    for (uint8_t i = 0; i < _count; i++) {
+        const Step& step = _steps[i];
+        const BusRecorder::Counters& c = step.counters;
+        fprintf(file, "    {\"name\": \"%s\", \"bytes\": %" PRIu64 ", \"transactions\": %" PRIu64
+                ", \"csToggles\": %" PRIu64 ", \"windows\": %" PRIu64 ", \"commands\": %" PRIu64
+                ", \"addressCommands\": %" PRIu64 ", \"pixels\": %" PRIu64
+                ", \"busMicros\": %" PRIu64 ", \"hostMicros\": %" PRIu64 ",\n",
+                step.name, c.bytes, c.transactions, c.csToggles, c.windows, c.commands,
+                c.addressCommands, c.pixels, c.busNanos / 1000, step.hostMicros);
+
+        if (step.limit == nullptr) {
+            fprintf(file, "     \"limits\": null, \"regressions\": [], \"pass\": true}");
+        } else {
+            fprintf(file, "     \"limits\": {");
+            for (uint8_t m = 0; m < METRICS; m++) {
+                fprintf(file, "%s\"%s\": %" PRIu64, m > 0 ? ", " : "",
+                        METRIC_NAMES[m], allowed(*step.limit, m));
+            }
+            fprintf(file, "}, \"regressions\": [");
+            bool pass = true;
+            for (uint8_t m = 0; m < METRICS; m++) {
+                if (!over(step, m)) continue;
+                fprintf(file, "%s\"%s\"", pass ? "" : ", ", METRIC_NAMES[m]);
+                pass = false;
+            }
+            fprintf(file, "], \"pass\": %s}", pass ? "true" : "false");
+        }
+        fprintf(file, "%s\n", i + 1 < _count ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"pass\": %s\n}\n", passed() ? "true" : "false");
+
+    return fclose(file) == 0;
+}
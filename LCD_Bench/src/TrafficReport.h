@@ -0,0 +1,65 @@
+/*****************************************************************************
+ * | File        : TrafficReport.h
+ * | Function    : Bus traffic per workload step, checked against limits
+ * | Info        : Written as JSON for scripts, printed as a table for people
+ * |
+ * | Each step of the workload is bracketed by begin()/end(); the report
+ * | keeps what BusRecorder counted in between and the host time it took:
+ * |
+ * |   TrafficReport report("WaveshareLCD");
+ * |   report.begin("clear");
+ * |   lcd.clear(Colors::WHITE);
+ * |   report.end();
+ * |   report.print();
+ * |   report.write("traffic_class.json");
+ * |   return report.passed() ? 0 : 1;
+ * |
+ * | Bytes, transactions, CS toggles and windows are checked against the
+ * | limits in TrafficLimits.h. A step over any of them is a regression and
+ * | fails the run. The counts do not depend on the host, so the limits are
+ * | exact: after an optimization, lower them to the new numbers.
+ *****************************************************************************/
+
+#ifndef __TRAFFIC_REPORT_H
+#define __TRAFFIC_REPORT_H
+
+#include <stdint.h>
+#include "BusRecorder.h"
+#include "TrafficLimits.h"
+
+class TrafficReport {
+public:
+    static constexpr uint8_t MAX_STEPS = 16;
+
+    explicit TrafficReport(const char* target);
+
+    void begin(const char* step);
+    void end();
+
+    // Table on stdout
+    void print() const;
+
+    // JSON report; false if the file cannot be written
+    bool write(const char* path) const;
+
+    bool passed() const;
+
+private:
+    struct Step {
+        const char* name;
+        BusRecorder::Counters counters;
+        uint64_t hostMicros;
+        const TrafficLimit* limit;      // nullptr: no limit yet
+    };
+
+    const char* _target;
+    Step _steps[MAX_STEPS];
+    uint8_t _count;
+    BusRecorder::Counters _start;
+    uint64_t _startNanos;
+
+    const TrafficLimit* findLimit(const char* step) const;
+    static bool over(const Step& step, uint8_t metric);
+};
+
+#endif // __TRAFFIC_REPORT_H
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * | File        : Workload.cpp
+ * | Function    : The fixed drawing workload every bench target runs
+ *****************************************************************************/
+
+#include "Workload.h"
+#include <string.h>
+
+namespace {
+    const uint16_t PALETTE[] = {
+        0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xBC40, 0x8430,
+    };
+    constexpr uint8_t PALETTE_SIZE = sizeof(PALETTE) / sizeof(PALETTE[0]);
+
+    void put16(uint8_t* out, uint16_t value) {
+        out[0] = value & 0xFF;
+        out[1] = value >> 8;
+    }
+
+    void put32(uint8_t* out, uint32_t value) {
+        put16(out, value & 0xFFFF);
+        put16(out + 2, value >> 16);
+    }
+}
+
+namespace Workload {
+
+Line line(Random& random, uint16_t width, uint16_t height)
+{
+    Line l;
+    l.x0 = random.below(width);
+    l.y0 = random.below(height);
+    l.x1 = random.below(width);
+    l.y1 = random.below(height);
+    l.color = PALETTE[random.below(PALETTE_SIZE)];
+    return l;
+}
+
+Circle circle(Random& random, uint16_t width, uint16_t height)
+{
+    Circle c;
+    c.radius = 5 + random.below(36);
+    c.x = c.radius + random.below(width - 2 * c.radius);
+    c.y = c.radius + random.below(height - 2 * c.radius);
+    c.color = PALETTE[random.below(PALETTE_SIZE)];
+    return c;
+}
+
+void textRow(uint16_t row, uint16_t columns, char* out)
+{
+    if (columns > TEXT_MAX_COLUMNS) columns = TEXT_MAX_COLUMNS;
+    for (uint16_t i = 0; i < columns; i++) {
+        out[i] = ' ' + 1 + (row * columns + i) % ('~' - ' ');
+    }
+    out[columns] = '\0';
+}
+
+void makeBmp(uint8_t* out)
+{
+    memset(out, 0, BMP_SIZE);
+
+    // File header
+    out[0] = 'B';
+    out[1] = 'M';
+    put32(out + 2, BMP_SIZE);
+    put32(out + 10, BMP_HEADER);
+
+    // BITMAPINFOHEADER
+    put32(out + 14, 40);
+    put32(out + 18, BMP_WIDTH);
+    put32(out + 22, BMP_HEIGHT);
+    put16(out + 26, 1);
+    put16(out + 28, 24);
+    put32(out + 34, BMP_ROW * BMP_HEIGHT);
+
+    // A red/green ramp with a blue pattern; rows are stored bottom-up
+    for (uint16_t y = 0; y < BMP_HEIGHT; y++) {
+        uint8_t* row = out + BMP_HEADER + (uint32_t)(BMP_HEIGHT - 1 - y) * BMP_ROW;
+        for (uint16_t x = 0; x < BMP_WIDTH; x++) {
+            row[3 * x + 0] = (uint8_t)((x ^ y) * 4);                // B
+            row[3 * x + 1] = (uint8_t)(y * 255 / (BMP_HEIGHT - 1)); // G
+            row[3 * x + 2] = (uint8_t)(x * 255 / (BMP_WIDTH - 1));  // R
+        }
+    }
+}
+
+void decodeBmp(const uint8_t* bmp, uint16_t* pixels)
+{
+    for (uint16_t y = 0; y < BMP_HEIGHT; y++) {
+        const uint8_t* row = bmp + BMP_HEADER + (uint32_t)(BMP_HEIGHT - 1 - y) * BMP_ROW;
+        for (uint16_t x = 0; x < BMP_WIDTH; x++) {
+            uint8_t b = row[3 * x], g = row[3 * x + 1], r = row[3 * x + 2];
+            pixels[y * BMP_WIDTH + x] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+        }
+    }
+}
+
+} // namespace Workload
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * | File        : Workload.h
+ * | Function    : The fixed drawing workload every bench target runs
+ * | Info        : Same shapes, text and image for both display libraries
+ * |
+ * | Numbers are only comparable if the work is. The shapes come from a
+ * | seeded generator, the text is the same screen of printable ASCII and
+ * | the image is a 24-bit BMP built in memory, so every run of every
+ * | target draws exactly the same thing:
+ * |
+ * |   Workload::Random random;
+ * |   for (uint16_t i = 0; i < Workload::LINES; i++) {
+ * |       Workload::Line l = Workload::line(random, 480, 320);
+ * |       lcd.drawLine(l.x0, l.y0, l.x1, l.y1, l.color);
+ * |   }
+ *****************************************************************************/
+
+#ifndef __WORKLOAD_H
+#define __WORKLOAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Workload {
+    constexpr uint16_t LINES = 1000;
+    constexpr uint16_t CIRCLES = 100;
+    constexpr uint16_t TOUCH_SCANS = 100;
+
+    // Text: Font16 (11 x 16), opaque, a full screen of rows
+    constexpr uint16_t TEXT_CHAR_WIDTH = 11;
+    constexpr uint16_t TEXT_CHAR_HEIGHT = 16;
+    constexpr uint16_t TEXT_MAX_COLUMNS = 64;
+
+    // Image: 24 bits per pixel, bottom-up rows padded to 4 bytes
+    constexpr uint16_t BMP_WIDTH = 160;
+    constexpr uint16_t BMP_HEIGHT = 120;
+    constexpr uint16_t BMP_X = 160;
+    constexpr uint16_t BMP_Y = 100;
+    constexpr uint32_t BMP_HEADER = 14 + 40;
+    constexpr uint32_t BMP_ROW = (BMP_WIDTH * 3 + 3) & ~3u;
+    constexpr uint32_t BMP_SIZE = BMP_HEADER + BMP_ROW * BMP_HEIGHT;
+
+    // Linear congruential; the sequence is part of the workload
+    class Random {
+    public:
+        explicit Random(uint32_t seed = 20240601u) : _state(seed) {}
+        uint32_t next() {
+            _state = _state * 1664525u + 1013904223u;
+            return _state >> 8;
+        }
+        uint16_t below(uint16_t limit) { return (uint16_t)(next() % limit); }
+
+    private:
+        uint32_t _state;
+    };
+
+    struct Line {
+        uint16_t x0, y0, x1, y1;
+        uint16_t color;
+    };
+
+    struct Circle {
+        uint16_t x, y, radius;
+        uint16_t color;
+    };
+
+    Line line(Random& random, uint16_t width, uint16_t height);
+
+    // Fully on screen, radius 5..40
+    Circle circle(Random& random, uint16_t width, uint16_t height);
+
+    // Row 'row' of the text screen: 'columns' printable characters
+    void textRow(uint16_t row, uint16_t columns, char* out);
+
+    // The BMP file, BMP_SIZE bytes
+    void makeBmp(uint8_t* out);
+
+    // The BMP as top-down RGB565 rows, converted as the legacy BMP reader does
+    void decodeBmp(const uint8_t* bmp, uint16_t* pixels);
+}
+
+#endif // __WORKLOAD_H
@@ -0,0 +1,213 @@
+/*****************************************************************************
+* | File      	:	LCD_Driver.c
+* | Author      :   Waveshare team
+* | Function    :	ILI9486 Drive function
+* | Info        :
+*   Image scanning
+*      Please use progressive scanning to generate images or fonts
+*----------------
+* |	This version:   V1.0
+* | Date        :   2018-01-11
+* | Info        :   Basic version
+*
+* | Every function forwards to one WaveshareLCD. It owns the command
+* | stream: the init sequence, the window cache and the SPI bus the touch
+* | pad shares.
+*
+******************************************************************************/
+
+/**************************Intermediate driver layer**************************/
+#include "WVSHR_Config.h"
+#include "LCD_Driver.h"
+#include "Debug.h"
+
+LCD_DIS sLCD_DIS;
+
+static WaveshareLCD LCD_Core(LCDPins(LCD_CS, LCD_RST, LCD_DC, LCD_BL));
+
+WaveshareLCD& LCD_Panel(void)
+{
+    return LCD_Core;
+}
+
+/*******************************************************************************
+function:
+		Copy the panel's size and scan direction to sLCD_DIS
+*******************************************************************************/
+static void LCD_SyncDis(void)
+{
+    const LCDInfo& Info = LCD_Core.getInfo();
+    sLCD_DIS.LCD_Dis_Column = Info.width;
+    sLCD_DIS.LCD_Dis_Page = Info.height;
+    sLCD_DIS.LCD_Scan_Dir = (LCD_SCAN_DIR)Info.scanDir;
+}
+
+/*******************************************************************************
+function:
+		Write register address and data
+*******************************************************************************/
+void LCD_WriteReg(uint8_t Reg)
+{
+    LCD_Core.writeReg(Reg);
+}
+
+void LCD_WriteData(uint8_t Data)
+{
+    LCD_Core.writeData(Data);
+}
+
+/********************************************************************************
+function:	Set the display scan and color transfer modes
+parameter:
+		Scan_dir   :   Scan direction
+note:
+		LCD_SCAN_DIR and ScanDir list the directions in the same order
+********************************************************************************/
+void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir)
+{
+    LCD_Core.setScanDirection((ScanDir)Scan_dir);
+    LCD_SyncDis();
+}
+
+/********************************************************************************
+function:
+	initialization
+parameter:
+	LCD_ScanDir 	:   Scan Direction (for example: Up-2-Down Left-2-right)
+    LCD_BLval       :   Backlight Level [0-uses 3V3; 1-255 set with 8-bit PWM]
+********************************************************************************/
+void LCD_Init(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval)
+{
+    LCD_Core.begin((ScanDir)LCD_ScanDir, LCD_BLval, LCDStart::COLD);
+    LCD_SyncDis();
+}
+
+/********************************************************************************
+function:
+	initialization without the hardware reset, for a panel that stayed
+	powered through a restart of the ESP32 (software reset, watchdog)
+********************************************************************************/
+void LCD_WarmInit(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval)
+{
+    LCD_Core.begin((ScanDir)LCD_ScanDir, LCD_BLval, LCDStart::WARM);
+    LCD_SyncDis();
+}
+
+/********************************************************************************
+function:	Sets the start position and size of the display area
+parameter:
+	Xstart 	:   X direction Start coordinates
+	Ystart  :   Y direction Start coordinates
+	Xend    :   X direction end coordinates (exclusive)
+	Yend    :   Y direction end coordinates (exclusive)
+********************************************************************************/
+void LCD_SetWindow(POINT Xstart, POINT Ystart,	POINT Xend, POINT Yend)
+{
+    LCD_Core.setWindow(Xstart, Ystart, Xend, Yend);
+}
+
+/********************************************************************************
+function:	Set the display cursor with a window on a point (Xpoint, Ypoint)
+parameter:
+	Xpoint :   The x coordinate of the point
+	Ypoint :   The y coordinate of the point
+********************************************************************************/
+void LCD_SetCursor(POINT Xpoint, POINT Ypoint)
+{
+    LCD_Core.setCursor(Xpoint, Ypoint);
+}
+
+/********************************************************************************
+function:	Set a window to a color
+parameter:
+		Color   :   Set show color,16-bit depth
+        width   :   Window width
+        hght    :   Window height
+********************************************************************************/
+void LCD_SetWindowColor(COLOR Color, POINT width, POINT hght)
+{
+    LCD_Core.pushColor(Color, (uint32_t)width * (uint32_t)hght);        //If hght>1, first call LCD_setWindow()
+}
+
+/********************************************************************************
+function:	Stream pixels into the current window
+parameter:
+		pData   :   RGB565 pixels, sent high byte first
+        DataLen :   Number of pixels (first call LCD_SetWindow())
+note:
+		Returns once the pixels are out, so pData may be reused
+********************************************************************************/
+void LCD_WritePixels(const COLOR *pData, uint32_t DataLen)
+{
+    LCD_Core.pushPixels(pData, DataLen);
+    LCD_Core.waitIdle();
+}
+
+/********************************************************************************
+function:	set a Point (Xpoint, Ypoint) to a color
+parameter:
+	Xpoint :   The x coordinate of the point
+	Ypoint :   The y coordinate of the point
+	Color  :   color
+********************************************************************************/
+void LCD_SetPoint2Color( POINT Xpoint, POINT Ypoint, COLOR Color)
+{
+    LCD_Core.setPixel(Xpoint, Ypoint, Color);
+}
+
+/********************************************************************************
+function:	Fill an area with the color
+parameter:
+	Xstart :   Start point x coordinate
+	Ystart :   Start point y coordinate
+	Xend   :   End point coordinates (must be larger than Xstart)
+	Yend   :   End point coordinates (must be larger than Ystart)
+	Color  :   color
+********************************************************************************/
+void LCD_SetArea2Color(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,	COLOR Color)
+{
+    LCD_Core.fillArea(Xstart, Ystart, Xend, Yend, Color);
+}
+
+/********************************************************************************
+function:
+			Clear screen
+parameter:
+	Color :   Background Color
+********************************************************************************/
+void LCD_Clear(COLOR  Color)
+{
+    LCD_Core.clear(Color);
+}
+
+/********************************************************************************
+function:	Define the vertical scroll area
+parameter:
+	TopFixed    :   Memory lines fixed above the scroll area
+	BottomFixed :   Memory lines fixed below the scroll area
+Info:
+	The panel scrolls along its 480 memory lines: screen rows in the
+	L2R_* / R2L_* scan directions, screen columns in the U2D_* / D2U_* ones.
+********************************************************************************/
+void LCD_SetScrollArea(LENGTH TopFixed, LENGTH BottomFixed)
+{
+    LCD_Core.setScrollArea(TopFixed, BottomFixed);
+}
+
+/********************************************************************************
+function:	Show memory line Line at the top of the scroll area
+parameter:
+	Line :   TopFixed <= Line < TopFixed + scroll area lines
+********************************************************************************/
+void LCD_ScrollTo(POINT Line)
+{
+    LCD_Core.scrollTo(Line);
+}
+
+/********************************************************************************
+function:	Leave scroll mode (Normal Display Mode On)
+********************************************************************************/
+void LCD_EndScroll(void)
+{
+    LCD_Core.endScroll();
+}
@@ -0,0 +1,241 @@
+/*****************************************************************************
+ * | File        : LCDCanvas.cpp
+ * | Function    : Off-screen RGB565 drawing surface
+ *****************************************************************************/
+
+#include "LCDCanvas.h"
+#include "LCDBlend.h"
+#include <stdlib.h>
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+LCDCanvas::LCDCanvas()
+    : _buffer(nullptr), _ownsBuffer(false), _reader(nullptr), _top(0), _rows(0),
+      _dirty{0, 0, 0, 0},
+      _winX0(0), _winY0(0), _winX1(1), _winY1(1), _curX(0), _curY(0) {
+}
+
+LCDCanvas::LCDCanvas(LENGTH width, LENGTH height, COLOR* buffer)
+    : LCDCanvas() {
+    begin(width, height, buffer);
+}
+
+LCDCanvas::~LCDCanvas() {
+    end();
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+bool LCDCanvas::begin(LENGTH width, LENGTH height, COLOR* buffer) {
+    return beginBand(width, height, height, buffer);
+}
+
+bool LCDCanvas::beginBand(LENGTH width, LENGTH height, LENGTH rows, COLOR* buffer) {
+    end();
+    if (width == 0 || height == 0 || rows == 0) return false;
+    if (rows > height) rows = height;
+
+    if (buffer == nullptr) {
+        buffer = (COLOR*)malloc((size_t)width * rows * sizeof(COLOR));
+        if (buffer == nullptr) return false;
+        _ownsBuffer = true;
+    }
+    _buffer = buffer;
+    _info.width = width;
+    _info.height = height;
+    _top = 0;
+    _rows = rows;
+    setWindow(0, 0, width, height);
+    clearDirty();
+    return true;
+}
+
+void LCDCanvas::end() {
+    waitIdle();
+    if (_ownsBuffer) free(_buffer);
+    _buffer = nullptr;
+    _ownsBuffer = false;
+    _info.width = 0;
+    _info.height = 0;
+    _top = 0;
+    _rows = 0;
+    clearDirty();
+}
+
+void LCDCanvas::setBandTop(POINT top) {
+    // The rows still queued for the panel are about to be overwritten
+    waitIdle();
+    _top = top;
+    clearDirty();
+}
+
+POINT LCDCanvas::bandEnd() const {
+    uint32_t end = (uint32_t)_top + _rows;
+    return (end < _info.height) ? (POINT)end : _info.height;
+}
+
+//------------------------------------------------------------------------------
+// Pixel sink
+//------------------------------------------------------------------------------
+
+void LCDCanvas::setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
+    // Same exclusive end as the panel; an empty window still takes a pixel
+    _winX0 = xStart;
+    _winY0 = yStart;
+    _winX1 = (xEnd > xStart) ? xEnd : xStart + 1;
+    _winY1 = (yEnd > yStart) ? yEnd : yStart + 1;
+    _curX = _winX0;
+    _curY = _winY0;
+}
+
+void LCDCanvas::setPixel(POINT x, POINT y, COLOR color) {
+    if (_buffer == nullptr || x >= _info.width || y < _top || y >= bandEnd()) return;
+
+    waitIdle();
+    rowAt(y)[x] = color;
+    markDirty(x, y, x + 1, y + 1);
+}
+
+void LCDCanvas::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) {
+    if (_buffer == nullptr) return;
+    if (xEnd > _info.width) xEnd = _info.width;
+    if (yStart < _top) yStart = _top;
+    if (yEnd > bandEnd()) yEnd = bandEnd();
+    if (xEnd <= xStart || yEnd <= yStart) return;
+
+    waitIdle();
+    COLOR* row = rowAt(yStart) + xStart;
+    LENGTH w = xEnd - xStart;
+    for (POINT y = yStart; y < yEnd; y++, row += _info.width) {
+        for (LENGTH i = 0; i < w; i++) row[i] = color;
+    }
+    markDirty(xStart, yStart, xEnd, yEnd);
+}
+
+void LCDCanvas::pushPixels(const COLOR* pixels, uint32_t count, bool swapped) {
+    if (_buffer == nullptr || pixels == nullptr || count == 0) return;
+
+    waitIdle();
+    int32_t top = _top, end = bandEnd();
+    while (count > 0) {
+        // Rest of the current window row; the part off the buffer is dropped
+        uint32_t run = _winX1 - _curX;
+        if (run > count) run = count;
+
+        if (_curY >= top && _curY < end && _curX < _info.width) {
+            uint32_t visible = _info.width - _curX;
+            if (visible > run) visible = run;
+            COLOR* dst = rowAt(_curY) + _curX;
+            if (swapped) {
+                for (uint32_t i = 0; i < visible; i++) {
+                    dst[i] = (COLOR)((pixels[i] << 8) | (pixels[i] >> 8));
+                }
+            } else {
+                for (uint32_t i = 0; i < visible; i++) dst[i] = pixels[i];
+            }
+            markDirty(_curX, _curY, _curX + visible, _curY + 1);
+        }
+
+        pixels += run;
+        count -= run;
+        _curX += run;
+        if (_curX == _winX1) {
+            // Wrap like the panel: next row, then back to the top
+            _curX = _winX0;
+            if (++_curY == _winY1) _curY = _winY0;
+        }
+    }
+}
+
+void LCDCanvas::waitIdle() {
+    if (_reader != nullptr) {
+        _reader->waitIdle();
+        _reader = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Blending
+//------------------------------------------------------------------------------
+void LCDCanvas::fillAreaAlpha(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                              COLOR color, uint8_t alpha) {
+    if (_buffer == nullptr || alpha == LCDBlend::TRANSPARENT) return;
+    if (xEnd > _info.width) xEnd = _info.width;
+    if (yStart < _top) yStart = _top;
+    if (yEnd > bandEnd()) yEnd = bandEnd();
+    if (xEnd <= xStart || yEnd <= yStart) return;
+
+    waitIdle();
+    COLOR* row = rowAt(yStart) + xStart;
+    for (POINT y = yStart; y < yEnd; y++, row += _info.width) {
+        LCDBlend::fill(row, xEnd - xStart, color, alpha);
+    }
+    markDirty(xStart, yStart, xEnd, yEnd);
+}
+
+void LCDCanvas::drawMask(POINT x, POINT y, const uint8_t* mask, LENGTH width, LENGTH height,
+                         COLOR color) {
+    if (_buffer == nullptr || mask == nullptr) return;
+    POINT xEnd = (uint32_t)x + width > _info.width ? _info.width : x + width;
+    POINT yStart = y < _top ? _top : y;
+    POINT yEnd = (uint32_t)y + height > bandEnd() ? bandEnd() : y + height;
+    if (xEnd <= x || yEnd <= yStart) return;
+
+    waitIdle();
+    uint32_t stride = (width + 1) / 2;
+    const uint8_t* line = mask + (uint32_t)(yStart - y) * stride;
+    COLOR* row = rowAt(yStart) + x;
+    for (POINT r = yStart; r < yEnd; r++, row += _info.width, line += stride) {
+        LCDBlend::mask(row, line, xEnd - x, color);
+    }
+    markDirty(x, yStart, xEnd, yEnd);
+}
+
+//------------------------------------------------------------------------------
+// Dirty rectangle
+//------------------------------------------------------------------------------
+
+void LCDCanvas::markDirty() {
+    _dirty = {0, _top, _info.width, bandEnd()};
+}
+
+void LCDCanvas::markDirty(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
+    if (xEnd > _info.width) xEnd = _info.width;
+    if (yStart < _top) yStart = _top;
+    if (yEnd > bandEnd()) yEnd = bandEnd();
+    if (xEnd <= xStart || yEnd <= yStart) return;
+
+    if (_dirty.isEmpty()) {
+        _dirty = {xStart, yStart, xEnd, yEnd};
+        return;
+    }
+    if (xStart < _dirty.x0) _dirty.x0 = xStart;
+    if (yStart < _dirty.y0) _dirty.y0 = yStart;
+    if (xEnd > _dirty.x1) _dirty.x1 = xEnd;
+    if (yEnd > _dirty.y1) _dirty.y1 = yEnd;
+}
+
+void LCDCanvas::clearDirty() {
+    _dirty = {0, 0, 0, 0};
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+
+void LCDCanvas::flush(LCDSurface& target, POINT x, POINT y) {
+    if (_buffer == nullptr || _dirty.isEmpty()) return;
+
+    const COLOR* pixels = rowAt(_dirty.y0) + _dirty.x0;
+    target.blitSubRect(x + _dirty.x0, y + _dirty.y0,
+                       _dirty.x1 - _dirty.x0, _dirty.y1 - _dirty.y0,
+                       pixels, _info.width);
+    clearDirty();
+
+    // Queued rows still point into the buffer
+    if (&target != this) _reader = &target;
+}
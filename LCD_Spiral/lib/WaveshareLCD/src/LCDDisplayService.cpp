@@ -0,0 +1,537 @@
+/*****************************************************************************
+ * | File        : LCDDisplayService.cpp
+ * | Function    : Display task fed by a lock-free command queue
+ *****************************************************************************/
+
+#include "LCDDisplayService.h"
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr uint32_t MAX_QUEUE_LENGTH = 4096;
+
+static uint32_t powerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+LCDDisplayService::LCDDisplayService(WaveshareLCD& lcd)
+    : _lcd(lcd), _overflow(Overflow::BLOCK),
+      _ring(nullptr), _mask(0), _head(0), _tail(0),
+      _text(nullptr), _textSize(0), _textHead(0), _textTail(0),
+      _fenceIssued(0), _fenceDone(0),
+      _highWater(0), _stalls(0), _dropped(0)
+#if defined(ESP32)
+      , _task(nullptr), _stopping(false), _progress(nullptr)
+#endif
+{
+}
+
+LCDDisplayService::~LCDDisplayService() {
+    end();
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+bool LCDDisplayService::begin(uint16_t queueLength, size_t textBytes, uint8_t priority) {
+    end();
+    if (queueLength == 0 || textBytes == 0 || queueLength > MAX_QUEUE_LENGTH) {
+        return false;
+    }
+
+    uint32_t length = powerOfTwo(queueLength);
+    uint32_t textSize = powerOfTwo(textBytes);
+    _ring = (Command*)malloc(length * sizeof(Command));
+    _text = (char*)malloc(textSize);
+    if (_ring == nullptr || _text == nullptr) {
+        free(_ring);
+        free(_text);
+        _ring = nullptr;
+        _text = nullptr;
+        return false;
+    }
+
+    _mask = length - 1;
+    _textSize = textSize;
+    _head.store(0);
+    _tail.store(0);
+    _textHead = 0;
+    _textTail.store(0);
+    _fenceIssued = 0;
+    _fenceDone.store(0);
+    _highWater = 0;
+    _stalls = 0;
+    _dropped = 0;
+
+#if defined(ESP32)
+    // Render on the core loop() is not running on
+#if CONFIG_FREERTOS_UNICORE
+    BaseType_t core = 0;
+#else
+    BaseType_t core = xPortGetCoreID() ? 0 : 1;
+#endif
+    _stopping = false;
+    _progress = xSemaphoreCreateBinary();
+    if (_progress == nullptr ||
+        xTaskCreatePinnedToCore(taskMain, "lcdsvc", 4096, this,
+                                priority, &_task, core) != pdPASS) {
+        _task = nullptr;
+        end();
+        return false;
+    }
+#else
+    (void)priority;
+#endif
+    return true;
+}
+
+void LCDDisplayService::end() {
+    if (_ring == nullptr) return;
+
+#if defined(ESP32)
+    if (_task != nullptr) {
+        sync();
+        _stopping = true;
+        xTaskNotifyGive(_task);
+        // The task clears _task as the last thing it does
+        while (_task != nullptr) xSemaphoreTake(_progress, 1);
+    }
+    if (_progress != nullptr) {
+        vSemaphoreDelete(_progress);
+        _progress = nullptr;
+    }
+#endif
+
+    // Whatever is left runs here
+    drain();
+
+    free(_ring);
+    free(_text);
+    _ring = nullptr;
+    _text = nullptr;
+}
+
+bool LCDDisplayService::isThreaded() const {
+#if defined(ESP32)
+    return _task != nullptr;
+#else
+    return false;
+#endif
+}
+
+uint16_t LCDDisplayService::getPending() const {
+    return (uint16_t)(_head.load(std::memory_order_acquire) -
+                      _tail.load(std::memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+// Producer side
+//------------------------------------------------------------------------------
+
+bool LCDDisplayService::waitForSpace(uint32_t textBytes, bool droppable) {
+    bool stalled = false;
+    for (;;) {
+        uint32_t pending = _head.load(std::memory_order_relaxed) -
+                           _tail.load(std::memory_order_acquire);
+        uint32_t textUsed = _textHead - _textTail.load(std::memory_order_acquire);
+        if (pending <= _mask && textUsed + textBytes <= _textSize) return true;
+
+        if (droppable && _overflow == Overflow::DROP) {
+            _dropped++;
+            return false;
+        }
+        if (!stalled) {
+            _stalls++;
+            stalled = true;
+        }
+
+#if defined(ESP32)
+        if (_task != nullptr) {
+            xTaskNotifyGive(_task);
+            xSemaphoreTake(_progress, 1);
+            continue;
+        }
+#endif
+        // No render task: make room by drawing here
+        drain();
+    }
+}
+
+LCDDisplayService::Command* LCDDisplayService::reserve(CommandType type, bool droppable) {
+    if (_ring == nullptr || !waitForSpace(0, droppable)) return nullptr;
+
+    Command* command = &_ring[_head.load(std::memory_order_relaxed) & _mask];
+    command->type = type;
+    command->textEnd = _textHead;
+    return command;
+}
+
+LCDDisplayService::Command* LCDDisplayService::reserveText(CommandType type, const char* text) {
+    if (_ring == nullptr || text == nullptr) return nullptr;
+
+    // A string is kept in one piece: one that would wrap starts over at the
+    // beginning of the ring instead. Up to half the ring always fits then.
+    uint32_t length = strlen(text) + 1;
+    if (length > _textSize / 2) {
+        _dropped++;
+        return nullptr;
+    }
+    uint32_t offset = _textHead & (_textSize - 1);
+    uint32_t skip = (offset + length > _textSize) ? _textSize - offset : 0;
+    if (!waitForSpace(skip + length, true)) return nullptr;
+
+    _textHead += skip;
+    offset = _textHead & (_textSize - 1);
+    memcpy(_text + offset, text, length);
+    _textHead += length;
+
+    Command* command = &_ring[_head.load(std::memory_order_relaxed) & _mask];
+    command->type = type;
+    command->text = offset;
+    command->textEnd = _textHead;
+    return command;
+}
+
+void LCDDisplayService::publish() {
+    uint32_t head = _head.load(std::memory_order_relaxed) + 1;
+    _head.store(head, std::memory_order_release);
+
+    uint16_t pending = (uint16_t)(head - _tail.load(std::memory_order_acquire));
+    if (pending > _highWater) _highWater = pending;
+
+#if defined(ESP32)
+    if (_task != nullptr) xTaskNotifyGive(_task);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Drawing
+//------------------------------------------------------------------------------
+
+bool LCDDisplayService::clear(COLOR color) {
+    Command* command = reserve(CommandType::CLEAR);
+    if (command == nullptr) return false;
+    command->color = color;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) {
+    Command* command = reserve(CommandType::FILL);
+    if (command == nullptr) return false;
+    command->x0 = xStart;
+    command->y0 = yStart;
+    command->x1 = xEnd;
+    command->y1 = yEnd;
+    command->color = color;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawPoint(POINT x, POINT y, COLOR color,
+                                  DotPixel dotSize, DotStyle dotStyle) {
+    Command* command = reserve(CommandType::DOT);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->color = color;
+    command->style[0] = (uint8_t)dotSize;
+    command->style[1] = (uint8_t)dotStyle;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                                 COLOR color, LineStyle lineStyle, DotPixel dotSize) {
+    Command* command = reserve(CommandType::LINE);
+    if (command == nullptr) return false;
+    command->x0 = xStart;
+    command->y0 = yStart;
+    command->x1 = xEnd;
+    command->y1 = yEnd;
+    command->color = color;
+    command->style[0] = (uint8_t)lineStyle;
+    command->style[1] = (uint8_t)dotSize;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                                      COLOR color, DrawFill fill,
+                                      DotPixel dotSize, LineStyle lineStyle) {
+    Command* command = reserve(CommandType::RECT);
+    if (command == nullptr) return false;
+    command->x0 = xStart;
+    command->y0 = yStart;
+    command->x1 = xEnd;
+    command->y1 = yEnd;
+    command->color = color;
+    command->style[0] = (uint8_t)fill;
+    command->style[1] = (uint8_t)dotSize;
+    command->style[2] = (uint8_t)lineStyle;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                                   COLOR color, DrawFill fill, DotPixel dotSize) {
+    Command* command = reserve(CommandType::CIRCLE);
+    if (command == nullptr) return false;
+    command->x0 = xCenter;
+    command->y0 = yCenter;
+    command->x1 = radius;
+    command->color = color;
+    command->style[0] = (uint8_t)fill;
+    command->style[1] = (uint8_t)dotSize;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawChar(POINT x, POINT y, char ch, sFONT* font,
+                                 COLOR bgColor, COLOR fgColor) {
+    Command* command = reserve(CommandType::CHAR);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->number = ch;
+    command->font = font;
+    command->color = fgColor;
+    command->color2 = bgColor;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawString(POINT x, POINT y, const char* str, sFONT* font,
+                                   COLOR bgColor, COLOR fgColor) {
+    Command* command = reserveText(CommandType::STRING, str);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->font = font;
+    command->color = fgColor;
+    command->color2 = bgColor;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawNumber(POINT x, POINT y, int32_t number, sFONT* font,
+                                   COLOR bgColor, COLOR fgColor) {
+    Command* command = reserve(CommandType::NUMBER);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->number = number;
+    command->font = font;
+    command->color = fgColor;
+    command->color2 = bgColor;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                                   POINT width, POINT height) {
+    Command* command = reserve(CommandType::BITMAP);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->x1 = width;
+    command->y1 = height;
+    command->data = bitmap;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::blit(POINT x, POINT y, LENGTH width, LENGTH height,
+                             const COLOR* pixels, bool swapped) {
+    Command* command = reserve(CommandType::BLIT);
+    if (command == nullptr) return false;
+    command->x0 = x;
+    command->y0 = y;
+    command->x1 = width;
+    command->y1 = height;
+    command->data = pixels;
+    command->style[0] = swapped;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::setBacklight(uint16_t value) {
+    Command* command = reserve(CommandType::BACKLIGHT);
+    if (command == nullptr) return false;
+    command->color = value;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::print(Print& out, const char* text) {
+    Command* command = reserveText(CommandType::PRINT, text);
+    if (command == nullptr) return false;
+    command->context = &out;
+    publish();
+    return true;
+}
+
+bool LCDDisplayService::run(Job job, void* context) {
+    if (job == nullptr) return false;
+    Command* command = reserve(CommandType::JOB);
+    if (command == nullptr) return false;
+    command->job = job;
+    command->context = context;
+    publish();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Fences
+//------------------------------------------------------------------------------
+
+LCDDisplayService::Fence LCDDisplayService::fence() {
+    // A fence is never dropped, or a wait on it could not end
+    Command* command = reserve(CommandType::FENCE, false);
+    if (command == nullptr) return _fenceIssued;
+    command->fence = ++_fenceIssued;
+    publish();
+    return _fenceIssued;
+}
+
+bool LCDDisplayService::isComplete(Fence fence) const {
+    return (int32_t)(_fenceDone.load(std::memory_order_acquire) - fence) >= 0;
+}
+
+bool LCDDisplayService::wait(Fence fence, uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (!isComplete(fence)) {
+        if (timeoutMs != UINT32_MAX && millis() - start >= timeoutMs) return false;
+#if defined(ESP32)
+        if (_task != nullptr) {
+            xSemaphoreTake(_progress, 1);
+            continue;
+        }
+#endif
+        if (!drain()) break;
+    }
+    return isComplete(fence);
+}
+
+void LCDDisplayService::sync() {
+    wait(fence());
+}
+
+void LCDDisplayService::poll() {
+    if (!isThreaded()) drain();
+}
+
+//------------------------------------------------------------------------------
+// Consumer side
+//------------------------------------------------------------------------------
+
+bool LCDDisplayService::drain() {
+    if (_ring == nullptr) return false;
+
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t head = _head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+
+    while (tail != head) {
+        // The bus is held for a batch, then let go so touch reads get in
+        _lcd.beginWrite();
+        for (uint16_t n = 0; n < BATCH_COMMANDS && tail != head; n++) {
+            const Command& command = _ring[tail & _mask];
+            execute(command);
+            _textTail.store(command.textEnd, std::memory_order_release);
+            _tail.store(++tail, std::memory_order_release);
+        }
+        _lcd.endWrite();
+
+#if defined(ESP32)
+        if (_progress != nullptr) xSemaphoreGive(_progress);
+#endif
+        head = _head.load(std::memory_order_acquire);
+    }
+    return true;
+}
+
+void LCDDisplayService::execute(const Command& command) {
+    switch (command.type) {
+    case CommandType::CLEAR:
+        _lcd.clear(command.color);
+        break;
+    case CommandType::FILL:
+        _lcd.fillArea(command.x0, command.y0, command.x1, command.y1, command.color);
+        break;
+    case CommandType::DOT:
+        _lcd.drawPoint(command.x0, command.y0, command.color,
+                       (DotPixel)command.style[0], (DotStyle)command.style[1]);
+        break;
+    case CommandType::LINE:
+        _lcd.drawLine(command.x0, command.y0, command.x1, command.y1, command.color,
+                      (LineStyle)command.style[0], (DotPixel)command.style[1]);
+        break;
+    case CommandType::RECT:
+        _lcd.drawRectangle(command.x0, command.y0, command.x1, command.y1, command.color,
+                           (DrawFill)command.style[0], (DotPixel)command.style[1],
+                           (LineStyle)command.style[2]);
+        break;
+    case CommandType::CIRCLE:
+        _lcd.drawCircle(command.x0, command.y0, command.x1, command.color,
+                        (DrawFill)command.style[0], (DotPixel)command.style[1]);
+        break;
+    case CommandType::CHAR:
+        _lcd.drawChar(command.x0, command.y0, (char)command.number, command.font,
+                      command.color2, command.color);
+        break;
+    case CommandType::STRING:
+        _lcd.drawString(command.x0, command.y0, _text + command.text, command.font,
+                        command.color2, command.color);
+        break;
+    case CommandType::NUMBER:
+        _lcd.drawNumber(command.x0, command.y0, command.number, command.font,
+                        command.color2, command.color);
+        break;
+    case CommandType::BITMAP:
+        _lcd.drawBitmap(command.x0, command.y0, (const uint8_t*)command.data,
+                        command.x1, command.y1);
+        break;
+    case CommandType::BLIT:
+        _lcd.blit(command.x0, command.y0, command.x1, command.y1,
+                  (const COLOR*)command.data, command.style[0] != 0);
+        break;
+    case CommandType::BACKLIGHT:
+        _lcd.setBacklight(command.color);
+        break;
+    case CommandType::PRINT:
+        static_cast<Print*>(command.context)->print(_text + command.text);
+        break;
+    case CommandType::JOB:
+        command.job(_lcd, command.context);
+        break;
+    case CommandType::FENCE:
+        // Complete only once the pixels are out, not just queued
+        _lcd.waitIdle();
+        _fenceDone.store(command.fence, std::memory_order_release);
+        break;
+    }
+}
+
+#if defined(ESP32)
+
+void LCDDisplayService::taskMain(void* arg) {
+    LCDDisplayService* self = static_cast<LCDDisplayService*>(arg);
+    while (!self->_stopping) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->drain();
+    }
+
+    // end() frees everything once _task is cleared: nothing after that
+    xSemaphoreGive(self->_progress);
+    self->_task = nullptr;
+    vTaskDelete(nullptr);
+}
+
+#endif // ESP32
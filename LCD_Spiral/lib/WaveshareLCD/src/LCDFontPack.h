@@ -0,0 +1,113 @@
+/*****************************************************************************
+ * | File        : LCDFontPack.h
+ * | Function    : Converts sFONT tables into packed fonts
+ * | Info        : The format is described in LCDGlyphReader.h
+ * |
+ * | pack() builds a packed copy of a table font in caller memory, for use
+ * | at run time or to measure it:
+ * |
+ * |   static uint8_t data[LCDFontPack::maxDataBytes(Font24)];  // or malloc
+ * |   static uint16_t offsets[96];
+ * |   sPACKED packed;
+ * |   LCDFontPack::Stats stats;
+ * |   LCDFontPack::pack(Font24, packed, data, sizeof(data), offsets, stats);
+ * |   sFONT font24p = { nullptr, Font24.Width, Font24.Height, &packed };
+ * |
+ * | writeSource() prints the same thing as a C file for the fonts/ folder;
+ * | fonts/font*p.c were made with it (on the host, through any Print).
+ * |
+ * | Each glyph is stored run-length coded only if that is smaller than its
+ * | raw bits. When the runs save less than the offsets table they need
+ * | (small fonts), every glyph is stored raw and found by index.
+ * |
+ * | The fonts in fonts/, ' '..'~' (decode time: every pixel through
+ * | LCDGlyphReader, x86 host at -O2; the panel transfer dominates either way):
+ * |
+ * |   font     table   packed          decode/glyph
+ * |   Font8     760 B   475 B  (raw)   125 -> 104 ns
+ * |   Font12   1140 B  1045 B  (raw)   166 -> 169 ns
+ * |   Font16   3040 B  1661 B  (runs)  388 -> 181 ns
+ * |   Font20   3800 B  2123 B  (runs)  486 -> 231 ns
+ * |   Font24   6840 B  2772 B  (runs)  617 -> 334 ns
+ * |
+ * | Runs are faster to decode than bits: a run is one nibble, a bit is a
+ * | test each.
+ * |
+ * | Options make a subset (only the characters a screen shows) and/or a
+ * | proportional font (each glyph its ink box plus 'spacing' columns).
+ * | Digits keep one common advance unless tabularDigits is cleared, so
+ * | numbers do not shift sideways as they change:
+ * |
+ * |   LCDFontPack::Options digits;
+ * |   digits.chars = "0123456789.-";
+ * |   digits.proportional = true;
+ * |   LCDFontPack::writeSource(file, Font24, "Digits24", digits);
+ * |
+ * | The calculator's fonts (CalculatorFonts.c), proportional subsets:
+ * |
+ * |   font        from     glyphs  packed  map + metrics  whole font packed
+ * |   Readout24   Font24     19     331 B   73 B + 95 B    2772 B
+ * |   Readout20   Font20     19     270 B   73 B + 95 B    2123 B
+ * |   Readout16   Font16     19     194 B   73 B + 95 B    1661 B
+ * |   Keys20      Font20     31     438 B   88 B + 155 B   2123 B
+ *****************************************************************************/
+
+#ifndef __LCD_FONT_PACK_H
+#define __LCD_FONT_PACK_H
+
+#include <Arduino.h>
+#include "fonts/fonts.h"
+
+namespace LCDFontPack {
+    struct Stats {
+        uint32_t tableBytes;        // The source table, First..Last only
+        uint32_t dataBytes;
+        uint32_t offsetBytes;       // 0 when every glyph is raw
+        uint32_t mapBytes;          // Subsets only
+        uint32_t glyphBytes;        // Proportional metrics only
+        uint16_t glyphs;
+        uint16_t rleGlyphs;
+        uint16_t width;             // The packed sFONT's Width
+    };
+
+    struct Options {
+        char first = ' ';               // Used when 'chars' is not set
+        char last = '~';
+        const char* chars = nullptr;    // Only these characters
+        bool proportional = false;
+        uint8_t spacing = 2;            // Proportional: columns after the ink
+        bool tabularDigits = true;      // Proportional: equal-width digits
+        bool rle = true;
+    };
+
+    // Lowest and highest character 'options' takes
+    bool range(const Options& options, uint8_t& first, uint8_t& last);
+
+    // Data bytes pack() may need: every glyph raw
+    constexpr uint32_t maxDataBytes(const sFONT& font, char first = ' ', char last = '~') {
+        return ((uint32_t)font.Width * font.Height + 7) / 8 * (uint32_t)(last - first + 1);
+    }
+
+    // Pack characters first..last of the table font 'font'. 'offsets'
+    // takes last - first + 2 entries (unused when 'rle' is false). On
+    // success 'packed' points into 'data' and 'offsets'.
+    bool pack(const sFONT& font, sPACKED& packed, uint8_t* data, uint32_t capacity,
+              uint16_t* offsets, Stats& stats,
+              char first = ' ', char last = '~', bool rle = true);
+
+    // The same with Options. 'map' takes last - first + 1 entries for a
+    // subset, 'glyphs' one per character for a proportional font (see
+    // range()); either may be nullptr otherwise. The sFONT to use is
+    // { nullptr, stats.width, font.Height, &packed }.
+    bool pack(const sFONT& font, sPACKED& packed, uint8_t* data, uint32_t capacity,
+              uint16_t* offsets, uint8_t* map, sGLYPH* glyphs,
+              Stats& stats, const Options& options);
+
+    // Print a C file defining sFONT 'name' packed from 'font'
+    bool writeSource(Print& out, const sFONT& font, const char* name,
+                     char first = ' ', char last = '~', bool rle = true);
+    bool writeSource(Print& out, const sFONT& font, const char* name,
+                     const Options& options);
+}
+
+#endif // __LCD_FONT_PACK_H
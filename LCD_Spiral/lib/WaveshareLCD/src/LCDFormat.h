@@ -0,0 +1,34 @@
+/*****************************************************************************
+ * | File        : LCDFormat.h
+ * | Function    : Number to text without snprintf()
+ * | Info        : Integers and fixed-point values for labels and readouts
+ * |
+ * | snprintf() pulls in the whole printf engine, and "%.2f" goes through
+ * | float formatting on every call. Readouts only ever show an integer or
+ * | a value with a fixed number of decimals, so they take it scaled:
+ * |
+ * |   char buf[LCDFormat::MAX_CHARS];
+ * |   LCDFormat::integer(buf, -42);        // "-42"
+ * |   LCDFormat::fixed(buf, 1234, 2);      // "12.34"
+ * |   LCDFormat::fixed(buf, -5, 2);        // "-0.05"
+ * |
+ * | Both write a terminated string and return its length.
+ *****************************************************************************/
+
+#ifndef __LCD_FORMAT_H
+#define __LCD_FORMAT_H
+
+#include <stdint.h>
+
+namespace LCDFormat {
+    // Sign, 10 digits, a point and the terminator
+    constexpr uint8_t MAX_CHARS = 13;
+
+    uint8_t integer(char* out, int32_t value);
+
+    // 'value' / 10^decimals with exactly 'decimals' digits after the point
+    // (at most 9)
+    uint8_t fixed(char* out, int32_t value, uint8_t decimals);
+}
+
+#endif // __LCD_FORMAT_H
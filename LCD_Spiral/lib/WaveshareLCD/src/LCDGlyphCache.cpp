@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * | File        : LCDGlyphCache.cpp
+ * | Function    : LRU cache of rasterized RGB565 glyphs
+ *****************************************************************************/
+
+#include "LCDGlyphCache.h"
+#include "LCDGlyphReader.h"
+#include <Arduino.h>
+#include <stdlib.h>
+
+LCDGlyphCache::LCDGlyphCache(size_t budgetBytes, uint8_t maxEntries)
+    : _entries(nullptr)
+    , _maxEntries(maxEntries < NONE ? maxEntries : NONE - 1)
+    , _count(0)
+    , _head(NONE)
+    , _tail(NONE)
+    , _budget(budgetBytes)
+    , _used(0)
+    , _hits(0)
+    , _misses(0)
+    , _evictions(0)
+{
+}
+
+LCDGlyphCache::~LCDGlyphCache()
+{
+    clear();
+    free(_entries);
+}
+
+void LCDGlyphCache::clear()
+{
+    while (_tail != NONE) evict(_tail);
+}
+
+void LCDGlyphCache::setBudget(size_t budgetBytes)
+{
+    _budget = budgetBytes;
+    while (_used > _budget && _tail != NONE) evict(_tail);
+}
+
+void LCDGlyphCache::resetStats()
+{
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+}
+
+//------------------------------------------------------------------------------
+// Lookup
+//------------------------------------------------------------------------------
+const COLOR* LCDGlyphCache::find(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor)
+{
+    for (uint8_t i = _head; i != NONE; i = _entries[i].next) {
+        Entry& e = _entries[i];
+        if (e.ch == ch && e.font == font && e.fg == fgColor && e.bg == bgColor) {
+            if (i != _head) {
+                unlink(i);
+                pushFront(i);
+            }
+            _hits++;
+            return e.pixels;
+        }
+    }
+    _misses++;
+    return nullptr;
+}
+
+const COLOR* LCDGlyphCache::insert(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor)
+{
+    size_t bytes = (size_t)LCDFont::advance(font, ch) * font->Height * sizeof(COLOR);
+    if (bytes == 0 || bytes > _budget || bytes > 0xFFFF || _maxEntries == 0) return nullptr;
+
+    // Slots are allocated on first use so an unused cache costs nothing
+    if (_entries == nullptr) {
+        _entries = (Entry*)calloc(_maxEntries, sizeof(Entry));
+        if (_entries == nullptr) return nullptr;
+    }
+
+    while (_tail != NONE && (_used + bytes > _budget || _count == _maxEntries)) {
+        evict(_tail);
+    }
+
+    COLOR* pixels = (COLOR*)malloc(bytes);
+    if (pixels == nullptr) return nullptr;
+
+    uint8_t index = 0;
+    while (_entries[index].pixels != nullptr) index++;
+
+    Entry& e = _entries[index];
+    e.font = font;
+    e.ch = ch;
+    e.fg = fgColor;
+    e.bg = bgColor;
+    e.pixels = pixels;
+    e.bytes = (uint16_t)bytes;
+    rasterize(font, ch, fgColor, bgColor, pixels);
+
+    pushFront(index);
+    _count++;
+    _used += bytes;
+    return pixels;
+}
+
+//------------------------------------------------------------------------------
+// Recency list
+//------------------------------------------------------------------------------
+void LCDGlyphCache::unlink(uint8_t index)
+{
+    Entry& e = _entries[index];
+    if (e.prev != NONE) _entries[e.prev].next = e.next; else _head = e.next;
+    if (e.next != NONE) _entries[e.next].prev = e.prev; else _tail = e.prev;
+    e.prev = NONE;
+    e.next = NONE;
+}
+
+void LCDGlyphCache::pushFront(uint8_t index)
+{
+    Entry& e = _entries[index];
+    e.prev = NONE;
+    e.next = _head;
+    if (_head != NONE) _entries[_head].prev = index; else _tail = index;
+    _head = index;
+}
+
+void LCDGlyphCache::evict(uint8_t index)
+{
+    Entry& e = _entries[index];
+    unlink(index);
+    free(e.pixels);
+    e.pixels = nullptr;
+    _used -= e.bytes;
+    _count--;
+    _evictions++;
+}
+
+//------------------------------------------------------------------------------
+// Rasterizer
+//------------------------------------------------------------------------------
+void LCDGlyphCache::rasterize(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor,
+                              COLOR* out)
+{
+    LCDGlyphReader glyph;
+    glyph.begin(font, ch);
+    uint16_t width = glyph.getWidth();
+
+    // Stored big-endian, ready to go out as is
+    uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+    for (uint16_t row = 0; row < font->Height; row++) {
+        for (uint16_t col = 0; col < width; ) {
+            bool set;
+            uint16_t count = glyph.run(width - col, set);
+            COLOR c = set ? fgColor : bgColor;
+            for (col += count; count > 0; count--) {
+                *dst++ = (uint8_t)(c >> 8);
+                *dst++ = (uint8_t)(c & 0xFF);
+            }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * | File        : LCDGlyphCache.h
+ * | Function    : LRU cache of rasterized RGB565 glyphs
+ * | Info        : Keyed by (font, character, foreground, background)
+ * |
+ * | Opaque text is usually the same handful of characters drawn in the same
+ * | colors over and over (digits, units, labels). The cache keeps each
+ * | glyph already expanded to wire-order RGB565, so a hit is sent to the
+ * | panel as a single blit instead of being rasterized bit by bit.
+ * |
+ * | Usage:
+ * |   LCDGlyphCache glyphs(12 * 1024);     // byte budget for pixel data
+ * |   lcd.setGlyphCache(&glyphs);
+ * |
+ * | Entries are evicted least recently used first once the budget or the
+ * | entry limit is reached. Lookups scan the recency list from the most
+ * | recent end, so the glyphs in use are found after a few compares.
+ *****************************************************************************/
+
+#ifndef __LCD_GLYPH_CACHE_H
+#define __LCD_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "LCDTypes.h"
+#include "fonts/fonts.h"
+
+class LCDGlyphCache {
+public:
+    static constexpr size_t DEFAULT_BUDGET = 8 * 1024;
+    static constexpr uint8_t DEFAULT_MAX_ENTRIES = 64;
+
+    explicit LCDGlyphCache(size_t budgetBytes = DEFAULT_BUDGET,
+                           uint8_t maxEntries = DEFAULT_MAX_ENTRIES);
+    ~LCDGlyphCache();
+
+    LCDGlyphCache(const LCDGlyphCache&) = delete;
+    LCDGlyphCache& operator=(const LCDGlyphCache&) = delete;
+
+    // Pixels of a cached glyph (Width x Height, wire byte order) or nullptr.
+    // A hit moves the glyph to the front of the recency list.
+    const COLOR* find(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor);
+
+    // Rasterize a glyph into the cache, evicting old ones to make room.
+    // Returns nullptr if it can never fit the budget. Evicted pixels are
+    // freed, so nothing previously returned may still be in flight.
+    const COLOR* insert(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor);
+
+    void clear();
+    void setBudget(size_t budgetBytes);
+
+    size_t getBudget() const { return _budget; }
+    size_t getBytesUsed() const { return _used; }
+    uint8_t getEntries() const { return _count; }
+
+    // Counters
+    uint32_t getHits() const { return _hits; }
+    uint32_t getMisses() const { return _misses; }
+    uint32_t getEvictions() const { return _evictions; }
+    void resetStats();
+
+private:
+    static constexpr uint8_t NONE = 0xFF;
+
+    struct Entry {
+        const sFONT* font;
+        COLOR fg, bg;
+        char ch;
+        uint8_t prev, next;     // Recency list, most recent at _head
+        COLOR* pixels;          // nullptr = free slot
+        uint16_t bytes;
+    };
+
+    Entry* _entries;
+    uint8_t _maxEntries;
+    uint8_t _count;
+    uint8_t _head, _tail;
+    size_t _budget;
+    size_t _used;
+
+    uint32_t _hits;
+    uint32_t _misses;
+    uint32_t _evictions;
+
+    void unlink(uint8_t index);
+    void pushFront(uint8_t index);
+    void evict(uint8_t index);
+    static void rasterize(const sFONT* font, char ch, COLOR fgColor, COLOR bgColor,
+                          COLOR* out);
+};
+
+#endif // __LCD_GLYPH_CACHE_H
@@ -0,0 +1,196 @@
+/*****************************************************************************
+ * | File        : LCDGlyphReader.h
+ * | Function    : Streaming decoder for table and packed glyphs
+ * | Info        : Hands out a glyph as runs of set / clear pixels
+ * |
+ * | The ST font tables pad every glyph row to whole bytes: Font24 spends 3
+ * | bytes on each 17-pixel row. A packed font (sFONT::Packed, made by
+ * | LCDFontPack) stores Width x Height bits per glyph with no padding, only
+ * | for First..Last, and codes a glyph as runs when that is smaller:
+ * |
+ * |   - raw: the glyph's bits, row after row, most significant bit first
+ * |   - run-length: 4-bit run lengths, high nibble first, alternating
+ * |     clear / set starting with clear. 0-14 is a run followed by a color
+ * |     change; 15 is 15 pixels with the color kept.
+ * |
+ * | The reader decodes either format (and the plain tables) in raster
+ * | order, so the glyph renderers never expand a glyph into a buffer:
+ * |
+ * |   LCDGlyphReader glyph;
+ * |   glyph.begin(font, 'A');
+ * |   for (row...) for (col = 0; col < font->Width; col += n) {
+ * |       bool set;
+ * |       n = glyph.run(font->Width - col, set);   // never past the row
+ * |       ...
+ * |   }
+ * |
+ * | Table and raw glyphs can start at any row; run-length glyphs decode
+ * | from the top, so begin(font, ch, row) skips rows by decoding them.
+ * | Characters a packed font does not have are blank.
+ * |
+ * | A proportional glyph is read as its whole cell, getWidth() wide and
+ * | the font's Height tall: the pixels around its box come out clear.
+ *****************************************************************************/
+
+#ifndef __LCD_GLYPH_READER_H
+#define __LCD_GLYPH_READER_H
+
+#include <Arduino.h>
+#include "fonts/fonts.h"
+#include "LCDFont.h"
+
+class LCDGlyphReader {
+public:
+    // Packed fonts with run-length glyphs can only be read top to bottom
+    static bool isSequential(const sFONT* font) {
+        return font->Packed != nullptr && font->Packed->offsets != nullptr;
+    }
+
+    void begin(const sFONT* font, char ch, uint16_t row = 0) {
+        _width = font->Width;
+        _col = 0;
+        _row = row;
+        _pad = 0;
+        _boxed = false;
+        const sPACKED* packed = font->Packed;
+        if (packed == nullptr) {
+            uint16_t bytesPerRow = font->Width / 8 + (font->Width % 8 ? 1 : 0);
+            _mode = Mode::BITS;
+            _data = &font->table[(ch - ' ') * font->Height * bytesPerRow];
+            _pad = bytesPerRow * 8 - font->Width;
+            _bit = (uint32_t)row * bytesPerRow * 8;
+            return;
+        }
+
+        uint16_t index = LCDFont::glyphIndex(packed, ch);
+        uint16_t stride = font->Width;
+        uint16_t dataRow = row;
+        if (packed->Glyphs != nullptr) {
+            // A cell of its own width; only its box is stored
+            if (index == LCDFont::NO_GLYPH) {
+                _width = 0;
+                _mode = Mode::BLANK;
+                return;
+            }
+            const sGLYPH* glyph = &packed->Glyphs[index];
+            _width = pgm_read_byte(&glyph->Advance);
+            _boxLeft = pgm_read_byte(&glyph->Left);
+            _boxTop = pgm_read_byte(&glyph->Top);
+            stride = pgm_read_byte(&glyph->Width);
+            _boxRight = _boxLeft + stride;
+            _boxBottom = _boxTop + pgm_read_byte(&glyph->Height);
+            _boxed = true;
+            dataRow = (row > _boxTop) ? row - _boxTop : 0;
+        } else if (index == LCDFont::NO_GLYPH) {
+            _mode = Mode::BLANK;
+            return;
+        }
+
+        if (packed->offsets == nullptr) {
+            uint32_t glyphBytes = ((uint32_t)font->Width * font->Height + 7) / 8;
+            _mode = Mode::BITS;
+            _data = packed->data + index * glyphBytes;
+            _bit = (uint32_t)dataRow * stride;
+            return;
+        }
+
+        uint16_t offset = pgm_read_word(&packed->offsets[index]);
+        _data = packed->data + (offset & ~PACKED_RLE_FLAG);
+        if (!(offset & PACKED_RLE_FLAG)) {
+            _mode = Mode::BITS;
+            _bit = (uint32_t)dataRow * stride;
+            return;
+        }
+        _mode = Mode::RLE;
+        _nibble = 0;
+        _runLeft = 0;
+        _runSet = false;
+        _toggle = false;
+        for (_row = 0; _row < row; ) {
+            for (uint16_t col = 0; col < _width; ) {
+                bool set;
+                col += run(_width - col, set);
+            }
+        }
+    }
+
+    // Width of the glyph's cell: the font's Width, or the glyph's advance
+    uint16_t getWidth() const { return _width; }
+
+    // Length (1..max) of the run of equal pixels starting at the current
+    // one, and whether they are set. 'max' must not reach past the row.
+    inline uint16_t run(uint16_t max, bool& set) {
+        uint16_t count;
+        if (_boxed && (_row < _boxTop || _row >= _boxBottom ||
+                       _col < _boxLeft || _col >= _boxRight)) {
+            // Around a proportional glyph's box
+            uint16_t end = _width;
+            if (_row >= _boxTop && _row < _boxBottom && _col < _boxLeft) end = _boxLeft;
+            set = false;
+            count = (end - _col < max) ? end - _col : max;
+        } else {
+            if (_boxed && _boxRight - _col < max) max = _boxRight - _col;
+            count = decode(max, set);
+        }
+
+        _col += count;
+        if (_col >= _width) {
+            _col = 0;
+            _row++;
+            if (_mode == Mode::BITS) _bit += _pad;
+        }
+        return count;
+    }
+
+private:
+    enum class Mode : uint8_t { BITS, RLE, BLANK };
+
+    const uint8_t* _data;
+    uint32_t _bit;                  // BITS: next bit
+    uint16_t _pad;                  // BITS: padding bits after each row
+    uint16_t _width;                // Cell width
+    uint16_t _col, _row;            // Next pixel in the cell
+    Mode _mode;
+
+    bool _boxed;                    // Proportional: bits cover only the box
+    uint8_t _boxLeft, _boxRight, _boxTop, _boxBottom;
+
+    uint16_t _nibble;               // RLE: next nibble
+    uint16_t _runLeft;
+    bool _runSet;
+    bool _toggle;                   // Change color after this run
+
+    inline uint16_t decode(uint16_t max, bool& set) {
+        uint16_t count;
+        switch (_mode) {
+        case Mode::BITS:
+            set = bitAt(_bit);
+            count = 1;
+            while (count < max && bitAt(_bit + count) == set) count++;
+            _bit += count;
+            return count;
+        case Mode::RLE:
+            while (_runLeft == 0) {
+                if (_toggle) _runSet = !_runSet;
+                uint8_t b = pgm_read_byte(_data + _nibble / 2);
+                uint8_t v = (_nibble & 1) ? (b & 0x0F) : (b >> 4);
+                _nibble++;
+                _runLeft = v;
+                _toggle = v != 15;
+            }
+            set = _runSet;
+            count = _runLeft < max ? _runLeft : max;
+            _runLeft -= count;
+            return count;
+        default:
+            set = false;
+            return max;
+        }
+    }
+
+    inline bool bitAt(uint32_t bit) const {
+        return pgm_read_byte(_data + bit / 8) & (0x80 >> (bit % 8));
+    }
+};
+
+#endif // __LCD_GLYPH_READER_H
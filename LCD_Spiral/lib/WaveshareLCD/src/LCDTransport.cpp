@@ -0,0 +1,289 @@
+/*****************************************************************************
+ * | File        : LCDTransport.cpp
+ * | Function    : Line-buffer rotation for the asynchronous LCD transport
+ *****************************************************************************/
+
+#include "LCDTransport.h"
+#include <string.h>
+
+LCDTransferQueue::LCDTransferQueue()
+    : _transport(nullptr)
+    , _bufferPixels(0)
+    , _head(0)
+    , _tail(0)
+    , _inFlight(0)
+    , _job(Job::NONE)
+    , _color(0)
+    , _source(nullptr)
+    , _swapped(false)
+    , _indices(nullptr)
+    , _pairs(nullptr)
+    , _remaining(0)
+    , _refused(false)
+    , _busy(false)
+    , _idleHook(nullptr)
+    , _idleContext(nullptr)
+    , _callback(nullptr)
+    , _callbackContext(nullptr)
+    , _transfers(0)
+    , _bytes(0)
+    , _errors(0)
+{
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+        _buffers[i] = nullptr;
+        _bufferColor[i] = 0;
+        _bufferFilled[i] = 0;
+    }
+}
+
+LCDTransferQueue::~LCDTransferQueue()
+{
+    end();
+}
+
+bool LCDTransferQueue::begin(LCDTransport* transport, size_t bufferBytes)
+{
+    end();
+    if (transport == nullptr || bufferBytes < 4) return false;       // At least a pixel pair
+
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+        _buffers[i] = transport->allocBuffer(bufferBytes);
+        if (_buffers[i] == nullptr) {
+            for (uint8_t j = 0; j < i; j++) transport->freeBuffer(_buffers[j]);
+            for (uint8_t j = 0; j < i; j++) _buffers[j] = nullptr;
+            return false;
+        }
+        _bufferFilled[i] = 0;
+    }
+    _transport = transport;
+    _bufferPixels = bufferBytes / 2;
+
+    if (!_transport->begin(*this)) {
+        end();
+        return false;
+    }
+    return true;
+}
+
+void LCDTransferQueue::end()
+{
+    if (_transport == nullptr) return;
+
+    waitIdle();
+    _transport->end();
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+        _transport->freeBuffer(_buffers[i]);
+        _buffers[i] = nullptr;
+    }
+    _transport = nullptr;
+}
+
+void LCDTransferQueue::setIdleHook(LCDFlushCallback hook, void* context)
+{
+    _idleHook = hook;
+    _idleContext = context;
+}
+
+//------------------------------------------------------------------------------
+// Streams
+//------------------------------------------------------------------------------
+void LCDTransferQueue::pushColor(uint16_t color, uint32_t count)
+{
+    if (count == 0) return;
+    waitIdle();
+    _color = color;
+    _remaining = count;
+    start(Job::FILL);
+}
+
+void LCDTransferQueue::pushPixels(const uint16_t* pixels, uint32_t count, bool swapped)
+{
+    if (pixels == nullptr || count == 0) return;
+    waitIdle();
+    _source = pixels;
+    _swapped = swapped;
+    _remaining = count;
+    start(Job::PIXELS);
+}
+
+void LCDTransferQueue::pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs)
+{
+    if (indices == nullptr || pairs == nullptr || count == 0) return;
+    waitIdle();
+    _indices = indices;
+    _pairs = pairs;
+    _remaining = count;
+    start(Job::INDEXED);
+}
+
+void LCDTransferQueue::start(Job job)
+{
+    _job = job;
+    _refused = false;
+    _busy = true;
+
+    if (_transport->hasWorker()) {
+        _transport->kick();
+    } else {
+        // Get the first buffers onto the wire before returning to the caller
+        pump(false);
+    }
+}
+
+void LCDTransferQueue::flush(LCDFlushCallback callback, void* context)
+{
+    if (callback == nullptr) return;
+    if (!_busy) {
+        callback(context);
+        return;
+    }
+    for (;;) {
+        // finish() takes the callback and clears _busy under the same lock:
+        // a stream ending meanwhile either sees the callback or is seen idle
+        _transport->lock();
+        bool idle = !_busy;
+        bool stored = !idle && _callback == nullptr;
+        if (stored) {
+            _callbackContext = context;
+            _callback = callback;
+        }
+        _transport->unlock();
+
+        if (idle) {
+            callback(context);
+            return;
+        }
+        if (stored) return;
+        // Only one pending callback: let an earlier one fire first
+        waitIdle();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Pumping
+//------------------------------------------------------------------------------
+bool LCDTransferQueue::pump(bool wait)
+{
+    if (!_busy) return false;
+
+    // Block only when nothing else can move: every buffer is in flight,
+    // the transport refused the last one, or all data is queued and we are
+    // waiting for the tail to drain
+    bool stalled = (_inFlight == BUFFER_COUNT) ||
+                   (_inFlight > 0 && (_remaining == 0 || _refused));
+    if (_inFlight > 0) {
+        retire(_transport->reap(wait && stalled));
+    }
+
+    _refused = false;
+    while (_remaining > 0 && _inFlight < BUFFER_COUNT) {
+        if (!refill()) {
+            _refused = true;
+            break;
+        }
+    }
+    // Refused with nothing on the wire, so no completion will make room:
+    // drop the rest of the stream instead of spinning on it
+    if (_remaining > 0 && _inFlight == 0) {
+        _remaining = 0;
+        _errors++;
+    }
+
+    if (_remaining == 0 && _inFlight == 0) {
+        finish();
+        return false;
+    }
+    return true;
+}
+
+void LCDTransferQueue::retire(uint8_t count)
+{
+    if (count > _inFlight) count = _inFlight;
+    _inFlight -= count;
+    _tail = (_tail + count) % BUFFER_COUNT;
+}
+
+bool LCDTransferQueue::refill()
+{
+    uint8_t index = _head;
+    uint8_t* buffer = _buffers[index];
+    size_t pixels = (_remaining < _bufferPixels) ? _remaining : _bufferPixels;
+    // Indexed chunks end on a whole byte, all but the last
+    if (_job == Job::INDEXED && pixels < _remaining) pixels &= ~(size_t)1;
+
+    if (_job == Job::FILL) {
+        // A buffer already holding enough of this color is sent as is
+        if (_bufferColor[index] != _color || _bufferFilled[index] < pixels) {
+            uint8_t hi = (uint8_t)(_color >> 8);
+            uint8_t lo = (uint8_t)(_color & 0xFF);
+            for (size_t i = 0; i < pixels; i++) {
+                buffer[2 * i] = hi;
+                buffer[2 * i + 1] = lo;
+            }
+            _bufferColor[index] = _color;
+            _bufferFilled[index] = pixels;
+        }
+    } else if (_job == Job::INDEXED) {
+        size_t bytes = pixels / 2;
+        for (size_t i = 0; i < bytes; i++) {
+            memcpy(buffer + 4 * i, &_pairs[_indices[i]], 4);
+        }
+        if (pixels & 1) memcpy(buffer + 4 * bytes, &_pairs[_indices[bytes]], 2);
+        _bufferFilled[index] = 0;
+    } else {
+        if (_swapped) {
+            memcpy(buffer, _source, pixels * 2);
+        } else {
+            for (size_t i = 0; i < pixels; i++) {
+                uint16_t c = _source[i];
+                buffer[2 * i] = (uint8_t)(c >> 8);
+                buffer[2 * i + 1] = (uint8_t)(c & 0xFF);
+            }
+        }
+        _bufferFilled[index] = 0;
+    }
+
+    if (!_transport->submit(buffer, pixels * 2)) return false;
+
+    _head = (_head + 1) % BUFFER_COUNT;
+    _inFlight++;
+    _remaining -= pixels;
+    if (_job == Job::PIXELS) _source += pixels;
+    if (_job == Job::INDEXED) _indices += pixels / 2;
+    _transfers++;
+    _bytes += pixels * 2;
+    return true;
+}
+
+void LCDTransferQueue::finish()
+{
+    _job = Job::NONE;
+    _source = nullptr;
+    _indices = nullptr;
+    _pairs = nullptr;
+
+    if (_idleHook != nullptr) _idleHook(_idleContext);
+
+    _transport->lock();
+    LCDFlushCallback callback = _callback;
+    void* context = _callbackContext;
+    _callback = nullptr;
+    _callbackContext = nullptr;
+    _busy = false;
+    _transport->unlock();
+
+    if (callback != nullptr) callback(context);
+    _transport->notifyIdle();
+}
+
+void LCDTransferQueue::waitIdle()
+{
+    if (_transport == nullptr) return;
+    while (_busy) {
+        if (_transport->hasWorker()) {
+            _transport->waitIdle();
+        } else {
+            pump(true);
+        }
+    }
+}
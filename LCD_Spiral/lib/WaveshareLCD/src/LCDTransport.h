@@ -0,0 +1,156 @@
+/*****************************************************************************
+ * | File        : LCDTransport.h
+ * | Function    : Asynchronous pixel transport for WaveshareLCD
+ * | Info        : Double-buffered line buffers feeding a queued bus
+ * |
+ * | LCDTransport is the bus underneath the driver: it owns the memory it
+ * | sends from and a small queue of in-flight transfers. On the ESP32 it is
+ * | backed by the ESP-IDF spi_master DMA driver (LCDDmaTransport); on the
+ * | host any stub that implements the interface can be plugged in.
+ * |
+ * | LCDTransferQueue chops a fill or a pixel stream into line-buffer sized
+ * | chunks and rotates BUFFER_COUNT buffers through the transport, so one
+ * | buffer is refilled while the other is on the wire. It has no Arduino
+ * | dependencies.
+ *****************************************************************************/
+
+#ifndef __LCD_TRANSPORT_H
+#define __LCD_TRANSPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+class LCDTransferQueue;
+
+// Called once the queued pixels have left the wire
+typedef void (*LCDFlushCallback)(void* context);
+
+//------------------------------------------------------------------------------
+// Bus interface
+//------------------------------------------------------------------------------
+class LCDTransport {
+public:
+    virtual ~LCDTransport() {}
+
+    // Bring up the bus. The queue is passed in so transports that run their
+    // own worker can pump it.
+    virtual bool begin(LCDTransferQueue& queue) = 0;
+    virtual void end() {}
+
+    // Memory the transport can send from (DMA-capable on the ESP32)
+    virtual uint8_t* allocBuffer(size_t bytes) = 0;
+    virtual void freeBuffer(uint8_t* buffer) = 0;
+
+    // Queue one transfer. Returns false if it cannot be accepted right now.
+    virtual bool submit(const uint8_t* data, size_t len) = 0;
+
+    // Collect finished transfers (in submit order) and return how many
+    // completed. With wait = true, block until at least one completes.
+    virtual uint8_t reap(bool wait) = 0;
+
+    // Worker hooks. A transport without a worker leaves these alone and the
+    // queue is pumped from WaveshareLCD::poll() / waitIdle() instead.
+    virtual bool hasWorker() const { return false; }
+    virtual void kick() {}
+    virtual void notifyIdle() {}
+    virtual void waitIdle() {}
+
+    // Guard the state the worker shares with the caller's task (a critical
+    // section where there is a second task). Held only for a few stores.
+    virtual void lock() {}
+    virtual void unlock() {}
+};
+
+//------------------------------------------------------------------------------
+// Line-buffer rotation and transfer queuing
+//------------------------------------------------------------------------------
+class LCDTransferQueue {
+public:
+    static constexpr uint8_t BUFFER_COUNT = 2;
+    static constexpr size_t DEFAULT_BUFFER_BYTES = 4096;
+
+    LCDTransferQueue();
+    ~LCDTransferQueue();
+
+    bool begin(LCDTransport* transport, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+    void end();
+    bool isReady() const { return _transport != nullptr; }
+
+    // Start streaming. Both return immediately; a call made while a previous
+    // stream is still running waits for it first. Pixels are native RGB565
+    // and are byte-swapped on the way into the line buffers unless
+    // 'swapped' says the source is already in wire (big-endian) order.
+    // The source of pushPixels must stay valid until the queue is idle.
+    void pushColor(uint16_t color, uint32_t count);
+    void pushPixels(const uint16_t* pixels, uint32_t count, bool swapped = false);
+
+    // 4-bit palette indices, two a byte with the first pixel in the high
+    // nibble. Each byte is expanded straight into the line buffer as
+    // pairs[byte]: its two pixels in wire order. Both arrays must stay
+    // valid until the queue is idle.
+    void pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs);
+
+    // Internal completion hook (used by the driver to release CS)
+    void setIdleHook(LCDFlushCallback hook, void* context);
+
+    // Call 'callback' once everything queued so far is on the panel.
+    // Runs immediately if the queue is already idle.
+    void flush(LCDFlushCallback callback, void* context);
+
+    // Advance the queue: retire finished buffers and refill free ones.
+    // Returns true while a stream is still in progress. A stream the
+    // transport refuses with nothing in flight is dropped (see getErrors()).
+    bool pump(bool wait);
+
+    bool isBusy() const { return _busy; }
+    void waitIdle();
+
+    // Counters
+    uint32_t getTransfers() const { return _transfers; }
+    uint32_t getBytes() const { return _bytes; }
+    uint32_t getErrors() const { return _errors; }
+    size_t getBufferPixels() const { return _bufferPixels; }
+
+private:
+    enum class Job : uint8_t { NONE = 0, FILL, PIXELS, INDEXED };
+
+    LCDTransport* _transport;
+    uint8_t* _buffers[BUFFER_COUNT];
+    size_t _bufferPixels;
+
+    // Ring state: _head is the next buffer to fill, _tail the oldest in flight
+    uint8_t _head;
+    uint8_t _tail;
+    uint8_t _inFlight;
+
+    // What each buffer currently holds, so repeated fills skip the refill
+    uint16_t _bufferColor[BUFFER_COUNT];
+    size_t _bufferFilled[BUFFER_COUNT];
+
+    // Active stream
+    Job _job;
+    uint16_t _color;
+    const uint16_t* _source;
+    bool _swapped;
+    const uint8_t* _indices;
+    const uint32_t* _pairs;
+    uint32_t _remaining;
+    bool _refused;                  // The transport turned the last refill down
+    volatile bool _busy;
+
+    LCDFlushCallback _idleHook;
+    void* _idleContext;
+    LCDFlushCallback _callback;
+    void* _callbackContext;
+
+    uint32_t _transfers;
+    uint32_t _bytes;
+    uint32_t _errors;
+
+    void start(Job job);
+    void retire(uint8_t count);
+    bool refill();
+    void finish();
+};
+
+#endif // __LCD_TRANSPORT_H
@@ -1,379 +0,0 @@
-/*****************************************************************************
-* | File      	:	LCD_Driver.c
-* | Author      :   Waveshare team
-* | Function    :	ILI9486 Drive function
-* | Info        :
-*   Image scanning
-*      Please use progressive scanning to generate images or fonts
-*----------------
-* |	This version:   V1.0
-* | Date        :   2018-01-11
-* | Info        :   Basic version
-*
-******************************************************************************/
-
-/**************************Intermediate driver layer**************************/
-#include "WVSHR_Config.h"
-#include "LCD_Driver.h"
-#include "Debug.h"
-
-LCD_DIS sLCD_DIS;
-/*******************************************************************************
-function:
-	Hardware reset
-*******************************************************************************/
-static void LCD_Reset(void)
-{
-    LCD_RST_1;
-    Driver_Delay_ms(500);
-    LCD_RST_0;
-    Driver_Delay_ms(500);
-    LCD_RST_1;
-    Driver_Delay_ms(500);
-}
-
-static void LCD_SetBackLight(uint16_t value)
-{
-    PWM_SetValue(value);
-}
-
-/*******************************************************************************
-function:
-		Write register address and data
-*******************************************************************************/
-void LCD_WriteReg(uint8_t Reg)
-{
-    LCD_DC_CMD;
-    LCD_CS_0;
-    SPI4W_Write_Byte(Reg);
-    LCD_CS_1;
-}
-
-void LCD_WriteData(uint8_t Data)
-{
-    LCD_DC_DATA;
-    LCD_CS_0;
-    SPI4W_Write_Byte(Data >> 8);
-    SPI4W_Write_Byte(Data & 0XFF);
-    LCD_CS_1;
-}
-
-/*******************************************************************************
-function:
-		Write register data
-*******************************************************************************/
-static void LCD_Write_AllData(uint16_t Data, uint32_t DataLen)
-{
-    uint32_t i;
-    LCD_DC_DATA;
-    LCD_CS_0;
-    for(i = 0; i < DataLen; i++) {
-        // SPI4W_Write_Byte(Data >> 8);
-        // SPI4W_Write_Byte(Data & 0XFF);
-        SPI4W_Write_Word(Data);
-    }
-    LCD_CS_1;
-}
-
-/*******************************************************************************
-function:
-		Common register initialization
-*******************************************************************************/
-static void LCD_InitReg(void)
-{
-    LCD_WriteReg(0XF9);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x08);
-
-    LCD_WriteReg(0xC0);
-    LCD_WriteData(0x19);//VREG1OUT POSITIVE
-    LCD_WriteData(0x1a);//VREG2OUT NEGATIVE
-
-    LCD_WriteReg(0xC1);
-    LCD_WriteData(0x45);//VGH,VGL    VGH>=14V.
-    LCD_WriteData(0x00);
-
-    LCD_WriteReg(0xC2);	//Normal mode, increase can change the display quality, while increasing power consumption
-    LCD_WriteData(0x33);
-
-    LCD_WriteReg(0XC5);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x28);//VCM_REG[7:0]. <=0X80.
-
-    LCD_WriteReg(0xB1);//Sets the frame frequency of full color normal mode
-    LCD_WriteData(0xA0);//0XB0 =70HZ, <=0XB0.0xA0=62HZ
-    LCD_WriteData(0x11);
-
-    LCD_WriteReg(0xB4);
-    LCD_WriteData(0x02); //2 DOT FRAME MODE,F<=70HZ.
-
-    LCD_WriteReg(0xB6);//
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x42);//0 GS SS SM ISC[3:0];
-    LCD_WriteData(0x3B);
-
-    LCD_WriteReg(0xB7);
-    LCD_WriteData(0x07);
-
-    LCD_WriteReg(0xE0);
-    LCD_WriteData(0x1F);
-    LCD_WriteData(0x25);
-    LCD_WriteData(0x22);
-    LCD_WriteData(0x0B);
-    LCD_WriteData(0x06);
-    LCD_WriteData(0x0A);
-    LCD_WriteData(0x4E);
-    LCD_WriteData(0xC6);
-    LCD_WriteData(0x39);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x00);
-
-    LCD_WriteReg(0XE1);
-    LCD_WriteData(0x1F);
-    LCD_WriteData(0x3F);
-    LCD_WriteData(0x3F);
-    LCD_WriteData(0x0F);
-    LCD_WriteData(0x1F);
-    LCD_WriteData(0x0F);
-    LCD_WriteData(0x46);
-    LCD_WriteData(0x49);
-    LCD_WriteData(0x31);
-    LCD_WriteData(0x05);
-    LCD_WriteData(0x09);
-    LCD_WriteData(0x03);
-    LCD_WriteData(0x1C);
-    LCD_WriteData(0x1A);
-    LCD_WriteData(0x00);
-
-    LCD_WriteReg(0XF1);
-    LCD_WriteData(0x36);
-    LCD_WriteData(0x04);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x3C);
-    LCD_WriteData(0x0F);
-    LCD_WriteData(0x0F);
-    LCD_WriteData(0xA4);
-    LCD_WriteData(0x02);
-
-    LCD_WriteReg(0XF2);
-    LCD_WriteData(0x18);
-    LCD_WriteData(0xA3);
-    LCD_WriteData(0x12);
-    LCD_WriteData(0x02);
-    LCD_WriteData(0x32);
-    LCD_WriteData(0x12);
-    LCD_WriteData(0xFF);
-    LCD_WriteData(0x32);
-    LCD_WriteData(0x00);
-
-    LCD_WriteReg(0XF4);
-    LCD_WriteData(0x40);
-    LCD_WriteData(0x00);
-    LCD_WriteData(0x08);
-    LCD_WriteData(0x91);
-    LCD_WriteData(0x04);
-
-    LCD_WriteReg(0XF8);
-    LCD_WriteData(0x21);
-    LCD_WriteData(0x04);
-
-    LCD_WriteReg(0X3A);	//Set Interface Pixel Format
-    LCD_WriteData(0x55);
-
-}
-
-/********************************************************************************
-function:	Set the display scan and color transfer modes
-parameter:
-		Scan_dir   :   Scan direction
-		Colorchose :   RGB or GBR color format
-********************************************************************************/
-void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir)
-{
-    uint16_t MemoryAccessReg_Data = 0; //addr:0x36
-    uint16_t DisFunReg_Data = 0; //addr:0xB6
-
-    // Gets the scan direction of GRAM
-    switch (Scan_dir) {
-    case L2R_U2D:
-        MemoryAccessReg_Data = 0x08;//0x08 | 0X8
-        DisFunReg_Data = 0x22;
-        break;
-    case L2R_D2U:
-        MemoryAccessReg_Data = 0x08;
-        DisFunReg_Data = 0x62;
-        break;
-    case R2L_U2D: //0X4
-        MemoryAccessReg_Data = 0x08;
-        DisFunReg_Data = 0x02;
-        break;
-    case R2L_D2U: //0XC
-        MemoryAccessReg_Data = 0x08;
-        DisFunReg_Data = 0x42;
-        break;
-    case U2D_L2R: //0X2
-        MemoryAccessReg_Data = 0x28;
-        DisFunReg_Data = 0x22;
-        break;
-    case U2D_R2L: //0X6
-        MemoryAccessReg_Data = 0x28;
-        DisFunReg_Data = 0x02;
-        break;
-    case D2U_L2R: //0XA
-        MemoryAccessReg_Data = 0x28;
-        DisFunReg_Data = 0x62;
-        break;
-    case D2U_R2L: //0XE
-        MemoryAccessReg_Data = 0x28;
-        DisFunReg_Data = 0x42;
-        break;
-    }
-
-    //Get the screen scan direction
-    sLCD_DIS.LCD_Scan_Dir = Scan_dir;
-
-    //Get GRAM and LCD width and height
-    if(Scan_dir == L2R_U2D || Scan_dir == L2R_D2U || Scan_dir == R2L_U2D || Scan_dir == R2L_D2U) {
-        sLCD_DIS.LCD_Dis_Column	= LCD_HEIGHT ;
-        sLCD_DIS.LCD_Dis_Page = LCD_WIDTH ;
-    } else {
-        sLCD_DIS.LCD_Dis_Column	= LCD_WIDTH ;
-        sLCD_DIS.LCD_Dis_Page = LCD_HEIGHT ;
-    }
-
-    // Set the read / write scan direction of the frame memory
-    LCD_WriteReg(0xB6);
-    LCD_WriteData(0X00);
-    LCD_WriteData(DisFunReg_Data);
-
-    LCD_WriteReg(0x36);
-    LCD_WriteData(MemoryAccessReg_Data);
-}
-
-/********************************************************************************
-function:
-	initialization
-parameter:
-	LCD_ScanDir 	:   Scan Direction (for example: Up-2-Down Left-2-right)
-    LCD_BLval       :   Backlight Level [0-uses 3V3; 1-255 set with 8-bit PWM]
-********************************************************************************/
-void LCD_Init(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval)
-{
-    //Hardware reset
-    LCD_Reset();
-    
-    if(LCD_BLval > 255)
-        LCD_BLval = 255;
-    if (LCD_BLval > 0)
-        LCD_SetBackLight(LCD_BLval);
-    
-    //Set the initialization registers
-    LCD_InitReg();
-
-    //Set the display scan and color transfer modes
-    LCD_SetGramScanWay( LCD_ScanDir);
-    Driver_Delay_ms(200);
-
-    //sleep out
-    LCD_WriteReg(0x11);
-    Driver_Delay_ms(120);
-
-    //Turn on the LCD display
-    LCD_WriteReg(0x29);
-}
-
-/********************************************************************************
-function:	Sets the start position and size of the display area
-parameter:
-	Xstart 	:   X direction Start coordinates
-	Ystart  :   Y direction Start coordinates
-	Xend    :   X direction end coordinates
-	Yend    :   Y direction end coordinates
-********************************************************************************/
-void LCD_SetWindow(POINT Xstart, POINT Ystart,	POINT Xend, POINT Yend)
-{
-    //set the X coordinates
-    LCD_WriteReg(0x2A);
-    LCD_WriteData(Xstart >> 8);	 				//Set the horizontal starting point to the high octet
-    LCD_WriteData(Xstart & 0xff);	 				//Set the horizontal starting point to the low octet
-    LCD_WriteData((Xend - 1) >> 8);	//Set the horizontal end to the high octet
-    LCD_WriteData((Xend - 1) & 0xff);	//Set the horizontal end to the low octet
-
-    //set the Y coordinates
-    LCD_WriteReg(0x2B);
-    LCD_WriteData(Ystart >> 8);
-    LCD_WriteData(Ystart & 0xff );
-    LCD_WriteData((Yend - 1) >> 8);
-    LCD_WriteData((Yend - 1) & 0xff);
-    LCD_WriteReg(0x2C);
-}
-
-/********************************************************************************
-function:	Set the display cursor with a window on a point (Xpoint, Ypoint)
-parameter:
-	Xpoint :   The x coordinate of the point
-	Ypoint :   The y coordinate of the point
-********************************************************************************/
-void LCD_SetCursor(POINT Xpoint, POINT Ypoint)
-{
-    LCD_SetWindow(Xpoint, Ypoint, Xpoint, Ypoint);
-}
-
-/********************************************************************************
-function:	Set a window to a color
-parameter:
-		Color   :   Set show color,16-bit depth
-        width   :   Window width
-        hght    :   Window height
-********************************************************************************/
-void LCD_SetWindowColor(COLOR Color, POINT width, POINT hght)
-{
-    LCD_Write_AllData(Color , (uint32_t)width * (uint32_t)hght);        //If hght>1, first call LCD_setWindow()
-}
-
-/********************************************************************************
-function:	set a Point (Xpoint, Ypoint) to a color
-parameter:
-	Xpoint :   The x coordinate of the point
-	Ypoint :   The y coordinate of the point
-	Color  :   color
-********************************************************************************/
-void LCD_SetPoint2Color( POINT Xpoint, POINT Ypoint, COLOR Color)
-{
-    if ((Xpoint <= sLCD_DIS.LCD_Dis_Column) && (Ypoint <= sLCD_DIS.LCD_Dis_Page)) {
-        LCD_SetCursor (Xpoint, Ypoint);
-        LCD_SetWindowColor(Color, 1, 1);
-    }
-}
-
-/********************************************************************************
-function:	Fill an area with the color
-parameter:
-	Xstart :   Start point x coordinate
-	Ystart :   Start point y coordinate
-	Xend   :   End point coordinates (must be larger than Xstart)
-	Yend   :   End point coordinates (must be larger than Ystart)
-	Color  :   color
-********************************************************************************/
-void LCD_SetArea2Color(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,	COLOR Color)
-{
-    if((Xend > Xstart) && (Yend > Ystart)) {
-        LCD_SetWindow(Xstart , Ystart , Xend , Yend  );
-        LCD_SetWindowColor ( Color , Xend - Xstart+1, Yend - Ystart+1);
-    }
-}
-
-/********************************************************************************
-function:
-			Clear screen
-parameter:
-	Color :   Background Color
-********************************************************************************/
-void LCD_Clear(COLOR  Color)
-{
-    LCD_SetArea2Color(0, 0, sLCD_DIS.LCD_Dis_Column , sLCD_DIS.LCD_Dis_Page , Color);
-}
@@ -0,0 +1,62 @@
+/*****************************************************************************
+ * | File        : LCDBlend.h
+ * | Function    : RGB565 blending kernels for RAM buffers
+ * | Info        : Constant alpha, 4-bit alpha masks and tints, two pixels
+ * |               per 32-bit operation
+ * |
+ * | Alpha is 0 (keep the destination) .. 255 (the new color). The kernels
+ * | work with 65 levels (0..64): every channel is
+ * | (new * a + old * (64 - a) + 32) / 64, rounded to nearest. That is fine
+ * | enough for 6-bit green: against an exact float blend every channel is
+ * | less than 1 step off, and 0 and 255 give the old and the new pixel
+ * | exactly.
+ * |
+ * | A pair of pixels is one 32-bit word. Each channel of both pixels goes
+ * | into a word of its own with room for the products, so every multiply
+ * | scales one channel of two pixels: three per pair for fill() and
+ * | tint(), whose color is worked out once, six for blend().
+ * |
+ * |   word:  R1 G1 B1 R0 G0 B0         (p1 in the high half)
+ * |   red:   .. R1 .. R0               >> 11 & 0x001F001F
+ * |   green: .. G1 .. G0               >> 5 & 0x003F003F
+ * |   blue:  .. B1 .. B0               & 0x001F001F
+ * |
+ * | Buffers hold native RGB565, like LCDCanvas; 'dst' and 'src' may be the
+ * | same buffer. Masks are 4 bits a pixel, the first pixel in the high
+ * | nibble, 0 = transparent .. 15 = opaque.
+ * |
+ * |   LCDBlend::fill(row, 120, Colors::BLACK, 128);        // Darken a strip
+ * |   LCDBlend::mask(row, glyph, 12, Colors::WHITE);       // AA glyph row
+ *****************************************************************************/
+
+#ifndef __LCD_BLEND_H
+#define __LCD_BLEND_H
+
+#include <stdint.h>
+#include "LCDTypes.h"
+
+namespace LCDBlend {
+    constexpr uint8_t TRANSPARENT = 0;
+    constexpr uint8_t OPAQUE = 255;
+    constexpr uint8_t MASK_OPAQUE = 15;
+
+    // 'fg' over 'bg'
+    COLOR mix(COLOR fg, COLOR bg, uint8_t alpha);
+
+    // dst = src over dst, at one alpha for all pixels
+    void blend(COLOR* dst, const COLOR* src, uint32_t count, uint8_t alpha);
+
+    // dst = src over dst, each pixel at its own alpha from 'mask'
+    void over(COLOR* dst, const COLOR* src, const uint8_t* mask, uint32_t count);
+
+    // dst = color over dst: a translucent fill
+    void fill(COLOR* dst, uint32_t count, COLOR color, uint8_t alpha);
+
+    // dst = color over dst through 'mask': anti-aliased text and shapes
+    void mask(COLOR* dst, const uint8_t* mask, uint32_t count, COLOR color);
+
+    // dst = color over src: 'src' tinted towards 'color'
+    void tint(COLOR* dst, const COLOR* src, uint32_t count, COLOR color, uint8_t alpha);
+}
+
+#endif // __LCD_BLEND_H
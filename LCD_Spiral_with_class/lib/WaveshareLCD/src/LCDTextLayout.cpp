@@ -0,0 +1,183 @@
+/*****************************************************************************
+ * | File        : LCDTextLayout.cpp
+ * | Function    : Word wrap, alignment and clipping of text in a box
+ *****************************************************************************/
+
+#include "LCDTextLayout.h"
+#include <stdlib.h>
+#include <string.h>
+
+LCDTextLayout::LCDTextLayout(uint8_t entries)
+    : _entries(nullptr)
+    , _maxEntries(entries)
+    , _clock(0)
+    , _hits(0)
+    , _misses(0)
+{
+    _uncached.count = 0;
+    _uncached.clipped = false;
+}
+
+LCDTextLayout::~LCDTextLayout()
+{
+    free(_entries);
+}
+
+void LCDTextLayout::clear()
+{
+    if (_entries != nullptr) {
+        memset(_entries, 0, _maxEntries * sizeof(Entry));
+    }
+}
+
+void LCDTextLayout::resetStats()
+{
+    _hits = 0;
+    _misses = 0;
+}
+
+//------------------------------------------------------------------------------
+// Cache
+//------------------------------------------------------------------------------
+const LCDTextLayout::Lines& LCDTextLayout::layout(const char* text, const sFONT* font,
+                                                  LENGTH width)
+{
+    // FNV-1a; the length comes along
+    uint32_t hash = 2166136261u;
+    uint16_t length = 0;
+    for (const char* c = text; *c != '\0'; c++, length++) {
+        hash ^= (uint8_t)*c;
+        hash *= 16777619u;
+    }
+
+    // Entries are allocated on first use so an unused layout costs nothing
+    if (_entries == nullptr && _maxEntries > 0) {
+        _entries = (Entry*)calloc(_maxEntries, sizeof(Entry));
+    }
+    if (_entries == nullptr) {
+        _misses++;
+        breakLines(text, font, width, _uncached);
+        return _uncached;
+    }
+
+    _clock++;
+    Entry* oldest = &_entries[0];
+    for (uint8_t i = 0; i < _maxEntries; i++) {
+        Entry& e = _entries[i];
+        if (e.font == font && e.hash == hash && e.length == length && e.width == width) {
+            e.used = _clock;
+            _hits++;
+            return e.lines;
+        }
+        if (e.used < oldest->used) oldest = &e;
+    }
+
+    _misses++;
+    oldest->hash = hash;
+    oldest->length = length;
+    oldest->width = width;
+    oldest->font = font;
+    oldest->used = _clock;
+    breakLines(text, font, width, oldest->lines);
+    return oldest->lines;
+}
+
+//------------------------------------------------------------------------------
+// Line breaking
+//------------------------------------------------------------------------------
+void LCDTextLayout::breakLines(const char* text, const sFONT* font, LENGTH width, Lines& lines)
+{
+    lines.count = 0;
+    lines.clipped = false;
+
+    uint16_t pos = 0;
+    while (text[pos] != '\0') {
+        if (lines.count == MAX_LINES) {
+            lines.clipped = true;
+            return;
+        }
+
+        // Take characters until one does not fit, remembering where the
+        // last word ended
+        uint16_t start = pos;
+        uint32_t lineWidth = 0;
+        uint16_t breakAt = start;
+        uint32_t breakWidth = 0;
+        bool wrapped = false;
+        while (text[pos] != '\0' && text[pos] != '\n') {
+            char ch = text[pos];
+            uint16_t advance = LCDFont::advance(font, ch);
+            if (ch == ' ' && pos > start && text[pos - 1] != ' ') {
+                breakAt = pos;
+                breakWidth = lineWidth;
+            }
+            if (pos - start >= MAX_LINE_LENGTH || (ch != ' ' && lineWidth + advance > width)) {
+                wrapped = true;
+                break;
+            }
+            lineWidth += advance;
+            pos++;
+        }
+
+        if (wrapped) {
+            if (breakAt > start) {
+                // After the last whole word
+                pos = breakAt;
+                lineWidth = breakWidth;
+            } else if (pos == start) {
+                // A character wider than the box goes on a line of its own
+                lineWidth = LCDFont::advance(font, text[pos]);
+                pos++;
+            }
+        }
+        uint16_t end = pos;
+        while (end > start && text[end - 1] == ' ') {
+            end--;
+            lineWidth -= LCDFont::advance(font, ' ');
+        }
+
+        Line& line = lines.line[lines.count++];
+        line.start = start;
+        line.length = end - start;
+        line.width = lineWidth > 0xFFFF ? 0xFFFF : (uint16_t)lineWidth;
+
+        // The spaces a line was broken at are not shown
+        if (wrapped) {
+            while (text[pos] == ' ') pos++;
+        }
+        if (text[pos] == '\n') pos++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Placement
+//------------------------------------------------------------------------------
+bool LCDTextLayout::place(const Lines& lines, uint8_t index, const sFONT* font,
+                          int32_t x, int32_t y, LENGTH width, LENGTH height, Align align,
+                          int32_t& lineX, int32_t& lineY)
+{
+    // Only whole lines are shown, as a block centered in the box
+    uint16_t visible = lines.count;
+    uint16_t fit = height / font->Height;
+    if (visible > fit) visible = fit;
+    if (index >= visible) return false;
+
+    const Line& line = lines.line[index];
+    lineY = y + (height - visible * font->Height) / 2 + index * font->Height;
+    lineX = x;
+    if (line.width < width) {
+        if (align == Align::RIGHT) {
+            lineX += width - line.width;
+        } else if (align == Align::CENTER) {
+            lineX += (width - line.width) / 2;
+        }
+    }
+    return true;
+}
+
+void LCDTextLayout::copyLine(const char* text, const Line& line, char* out)
+{
+    uint16_t length = line.length > MAX_LINE_LENGTH ? MAX_LINE_LENGTH : line.length;
+    memcpy(out, text + line.start, length);
+    out[length] = '\0';
+}
@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * | File        : SPIBus.cpp
+ * | Function    : Arbiter for the SPI bus shared by the panel and its peers
+ *****************************************************************************/
+
+#include "SPIBus.h"
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+SPIBus::SPIBus(SPIClass& spi)
+    : _spi(spi), _started(false), _devices{}, _count(0),
+      _current(NO_DEVICE), _depth(0), _switches(0), _outer{}, _outerDepth{},
+      _outerSelected{}, _nested(0) {
+#if defined(ESP32)
+    _mutex = nullptr;
+#endif
+}
+
+SPIBus::~SPIBus() {
+#if defined(ESP32)
+    if (_mutex != nullptr) vSemaphoreDelete(_mutex);
+#endif
+}
+
+SPIBus& SPIBus::shared() {
+    static SPIBus bus;
+    return bus;
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+void SPIBus::begin() {
+    if (_started) return;
+
+#if defined(ESP32)
+    _mutex = xSemaphoreCreateRecursiveMutex();
+#endif
+    _spi.begin();
+    _started = true;
+}
+
+SPIBus::Device SPIBus::addDevice(uint8_t cs, const SPISettings& settings,
+                                 IdleHook idleHook, void* context) {
+    if (_count == MAX_DEVICES) return NO_DEVICE;
+
+    lock();
+    Device device = _count;
+    Entry& entry = _devices[_count++];
+    if (cs != NO_CS) entry.cs.begin(cs, OUTPUT, HIGH);
+    entry.managed = true;
+    entry.settings = settings;
+    entry.idleHook = idleHook;
+    entry.context = context;
+    unlock();
+    return device;
+}
+
+SPIBus::Device SPIBus::addDevice(uint8_t cs) {
+    Device device = addDevice(cs, SPISettings());
+    if (device != NO_DEVICE) _devices[device].managed = false;
+    return device;
+}
+
+//------------------------------------------------------------------------------
+// Access
+//------------------------------------------------------------------------------
+
+void SPIBus::lock() {
+#if defined(ESP32)
+    if (_mutex != nullptr) xSemaphoreTakeRecursive(_mutex, portMAX_DELAY);
+#endif
+}
+
+void SPIBus::unlock() {
+#if defined(ESP32)
+    if (_mutex != nullptr) xSemaphoreGiveRecursive(_mutex);
+#endif
+}
+
+bool SPIBus::acquire(Device device) {
+    if (device < 0 || device >= _count) return false;
+
+    lock();
+    Entry& entry = _devices[device];
+    if (_current != device) {
+        if (_depth > 0 && _nested == MAX_DEVICES) {
+            // No room to keep the outer device's place
+            unlock();
+            return false;
+        }
+        // The last owner may still be sending in the background
+        if (_current != NO_DEVICE) {
+            const Entry& last = _devices[_current];
+            if (last.idleHook != nullptr) last.idleHook(last.context);
+        }
+        // Taken inside another device's calls: close its transaction,
+        // deselect it and keep its place for release()
+        if (_depth > 0) {
+            const Entry& outer = _devices[_current];
+            if (outer.managed) _spi.endTransaction();
+            bool selected = outer.cs.getPin() != NO_CS && !outer.cs.isDrivenHigh();
+            if (selected) outer.cs.high();
+            _outer[_nested] = _current;
+            _outerDepth[_nested] = _depth;
+            _outerSelected[_nested] = selected;
+            _nested++;
+            _depth = 0;
+        }
+        _current = device;
+        _switches++;
+    }
+    if (_depth++ == 0 && entry.managed) {
+        _spi.beginTransaction(entry.settings);
+    }
+    return true;
+}
+
+void SPIBus::release(Device device) {
+    if (device != _current || _depth == 0) return;
+
+    if (--_depth == 0) {
+        if (_devices[_current].managed) _spi.endTransaction();
+
+        // Give the bus back to the device this one was taken inside
+        if (_nested > 0) {
+            const Entry& inner = _devices[_current];
+            if (inner.idleHook != nullptr) inner.idleHook(inner.context);
+
+            _nested--;
+            _current = _outer[_nested];
+            _depth = _outerDepth[_nested];
+            _switches++;
+            const Entry& outer = _devices[_current];
+            if (outer.managed) _spi.beginTransaction(outer.settings);
+            if (_outerSelected[_nested]) outer.cs.low();
+        }
+    }
+    unlock();
+}
+
+bool SPIBus::select(Device device) {
+    if (!acquire(device)) return false;
+    _devices[device].cs.low();
+    return true;
+}
+
+void SPIBus::deselect(Device device) {
+    if (device >= 0 && device < _count) _devices[device].cs.high();
+    release(device);
+}
@@ -0,0 +1,133 @@
+/*****************************************************************************
+ * | File        : SPIBus.h
+ * | Function    : Arbiter for the SPI bus shared by the panel and its peers
+ * | Info        : Per-device settings and CS, one owner at a time
+ * |
+ * | The panel, the XPT2046 touch controller and (in RavKavWebGate) the
+ * | MFRC522 card reader sit on the same SPI bus. Each registers here with
+ * | its own CS pin and SPISettings and takes the bus before using it:
+ * |
+ * |   SPIBus& bus = SPIBus::shared();
+ * |   SPIBus::Device touch = bus.addDevice(4, SPISettings(2000000, MSBFIRST, SPI_MODE0));
+ * |   bus.select(touch);                   // bus taken, clock set, CS low
+ * |   SPI.transfer(0xD0);
+ * |   bus.deselect(touch);                 // CS high, bus given back
+ * |
+ * | Access is serialized with a FreeRTOS mutex, so devices may be used from
+ * | different tasks. The outermost acquire() opens an SPI transaction with
+ * | the device's own settings and the matching release() closes it, so
+ * | every device runs at its own clock and nobody restores a global one.
+ * | Calls nest: a batch of transactions to one device (the panel between
+ * | beginWrite() and endWrite()) takes the bus and sets it up once. A
+ * | different device taken inside that batch closes the outer device's
+ * | transaction and raises its CS, so the outer chip ignores what follows;
+ * | the inner device's last release() puts both back. Such a chain is at
+ * | most MAX_DEVICES deep: acquire() refuses a device beyond that.
+ * |
+ * | A device that is still busy after giving the bus back (the panel, with
+ * | a DMA stream in flight) registers an idle hook; the next device waits
+ * | on it before taking over.
+ * |
+ * | CS lines are driven through the GPIO set/clear registers.
+ * |
+ * | A device registered without settings has a driver that runs its own
+ * | SPI transactions (the MFRC522 library). acquire() then only takes the
+ * | bus, and whoever uses it next sets it up again.
+ *****************************************************************************/
+
+#ifndef __SPI_BUS_H
+#define __SPI_BUS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "LCDGpio.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+class SPIBus {
+public:
+    typedef int8_t Device;
+    static constexpr Device NO_DEVICE = -1;
+    static constexpr uint8_t MAX_DEVICES = 4;
+    static constexpr uint8_t NO_CS = 0xFF;
+
+    // Waits until a device has really let go of the bus
+    typedef void (*IdleHook)(void* context);
+
+    explicit SPIBus(SPIClass& spi = SPI);
+    ~SPIBus();
+
+    SPIBus(const SPIBus&) = delete;
+    SPIBus& operator=(const SPIBus&) = delete;
+
+    // The bus on the default SPI pins, shared by every driver in the lib
+    static SPIBus& shared();
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Start the SPI peripheral; later calls do nothing
+    void begin();
+    bool isReady() const { return _started; }
+
+    // Register a device. 'cs' is driven high right away (NO_CS if the
+    // device has none or its driver owns it). Returns NO_DEVICE when full.
+    Device addDevice(uint8_t cs, const SPISettings& settings,
+                     IdleHook idleHook = nullptr, void* context = nullptr);
+
+    // A device whose driver calls SPI.beginTransaction() itself
+    Device addDevice(uint8_t cs);
+
+    //--------------------------------------------------------------------------
+    // Access
+    //--------------------------------------------------------------------------
+    // Take the bus for 'device' and apply its settings. Calls nest within
+    // one task, also for different devices. Returns false, with nothing
+    // taken, for an unknown device or one nested too deep; its release()
+    // is then ignored.
+    bool acquire(Device device);
+    void release(Device device);
+
+    // acquire() and CS low; CS high and release()
+    bool select(Device device);
+    void deselect(Device device);
+
+    // Times the bus went to a different device
+    uint32_t getSwitches() const { return _switches; }
+
+private:
+    struct Entry {
+        LCDGpioPin cs;
+        bool managed;               // settings applied by the bus
+        SPISettings settings;
+        IdleHook idleHook;
+        void* context;
+    };
+
+    SPIClass& _spi;
+    bool _started;
+    Entry _devices[MAX_DEVICES];
+    uint8_t _count;
+    Device _current;                // Last device to take the bus
+    uint8_t _depth;                 // Nesting of _current
+    uint32_t _switches;
+
+    // Devices taken over while they held the bus, their nesting and
+    // whether their CS was low
+    Device _outer[MAX_DEVICES];
+    uint8_t _outerDepth[MAX_DEVICES];
+    bool _outerSelected[MAX_DEVICES];
+    uint8_t _nested;
+
+#if defined(ESP32)
+    SemaphoreHandle_t _mutex;
+#endif
+
+    void lock();
+    void unlock();
+};
+
+#endif // __SPI_BUS_H
@@ -0,0 +1,395 @@
+/* Font24P: 17x24, ' '..'~', packed by LCDFontPack::writeSource().
+   2580 bytes of glyphs and 192 of offsets; the table had 6840.
+   95 of 95 glyphs are run-length coded. */
+
+#include "fonts.h"
+
+const uint8_t Font24P_Data[] =
+{
+	// @0 ' ' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF3,
+	// @14 '!' (runs)
+	0xFF, 0xA3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF0, 0x1F,
+	0x11, 0xFF, 0xF4, 0x3E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF7,
+	// @35 '"' (runs)
+	0xFF, 0xFA, 0x32, 0x39, 0x32, 0x39, 0x32, 0x3A, 0x14, 0x1B, 0x14, 0x1B,
+	0x14, 0x1B, 0x14, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+	// @59 '#' (runs)
+	0xFF, 0x92, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0x8B,
+	0x6B, 0x92, 0x22, 0xA2, 0x22, 0x9B, 0x6B, 0x82, 0x22, 0xB2, 0x22, 0xB2,
+	0x22, 0xB2, 0x22, 0xB2, 0x22, 0xFF, 0xFF, 0xFF, 0xF4,
+	// @92 '$' (runs)
+	0xF9, 0x2F, 0x02, 0xD4, 0x12, 0x98, 0x82, 0x43, 0x82, 0x43, 0x83, 0xF0,
+	0x5D, 0x6E, 0x48, 0x25, 0x28, 0x34, 0x28, 0x33, 0x38, 0x89, 0x21, 0x4E,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xFF, 0xFF, 0xF1,
+	// @124 '%' (runs)
+	0xFF, 0x94, 0xC6, 0xA3, 0x23, 0x92, 0x42, 0x92, 0x42, 0x93, 0x23, 0xA9,
+	0x96, 0x99, 0xA3, 0x23, 0x92, 0x42, 0x92, 0x42, 0x93, 0x23, 0xA6, 0xC4,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+	// @153 '&' (runs)
+	0xFF, 0xFF, 0xE6, 0xA7, 0x92, 0x32, 0xA2, 0xF0, 0x2F, 0x12, 0xF0, 0x3D,
+	0x52, 0x36, 0x31, 0x76, 0x23, 0x48, 0x24, 0x39, 0xA8, 0x51, 0x3F, 0xFF,
+	0xFF, 0xFF, 0xF2,
+	// @180 ''' (runs)
+	0xFF, 0xFC, 0x3E, 0x3E, 0x3F, 0x01, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+	// @199 '(' (runs)
+	0xFF, 0xF0, 0x2E, 0x3D, 0x3D, 0x4D, 0x3E, 0x3D, 0x3E, 0x3E, 0x3E, 0x3E,
+	0x3E, 0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x2F, 0xFF, 0xFC,
+	// @223 ')' (runs)
+	0xFF, 0x72, 0xF0, 0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xE3, 0xE3,
+	0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xD4, 0xD3, 0xD3, 0xE2, 0xFF, 0xFF, 0xF5,
+	// @247 '*' (runs)
+	0xFF, 0xB2, 0xF0, 0x2F, 0x02, 0xB3, 0x12, 0x13, 0x7A, 0x96, 0xC4, 0xD4,
+	0xC2, 0x22, 0xB2, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	// @270 '+' (runs)
+	0xFF, 0xFF, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2A, 0xC5, 0xCA,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+	// @294 ',' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0xE2, 0xE3, 0xE2,
+	0xF0, 0x2E, 0x2F, 0x02, 0xFF, 0xFF,
+	// @312 '-' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0,
+	// @327 '.' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xD4, 0xD4, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x60,
+	// @343 '/' (runs)
+	0xB2, 0xF0, 0x2E, 0x3E, 0x2E, 0x3E, 0x2F, 0x02, 0xE2, 0xF0, 0x2E, 0x2F,
+	0x02, 0xE2, 0xF0, 0x2E, 0x2F, 0x02, 0xE3, 0xE2, 0xE3, 0xE2, 0xF0, 0x2F,
+	0xFF, 0xFF, 0x50,
+	// @370 '0' (runs)
+	0xFF, 0xA4, 0xC6, 0xA2, 0x42, 0x92, 0x42, 0x82, 0x62, 0x72, 0x62, 0x72,
+	0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x82, 0x42, 0x92,
+	0x42, 0xA6, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+	// @402 '1' (runs)
+	0xFF, 0xC1, 0xD4, 0xB6, 0xB3, 0x12, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2B, 0xA7, 0xAF, 0xFF, 0xFF,
+	0xFF, 0xF3,
+	// @428 '2' (runs)
+	0xFF, 0x95, 0xA9, 0x73, 0x52, 0x72, 0x72, 0x62, 0x72, 0xF0, 0x2E, 0x2E,
+	0x2D, 0x3D, 0x3D, 0x2E, 0x2E, 0x2E, 0xB6, 0xBF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// @452 '3' (runs)
+	0xFF, 0xA4, 0xB7, 0xA2, 0x33, 0xF0, 0x2F, 0x02, 0xE2, 0xC4, 0xD5, 0xF0,
+	0x3F, 0x12, 0xF0, 0x2F, 0x02, 0x72, 0x53, 0x79, 0x96, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x60,
+	// @478 '4' (runs)
+	0xFF, 0xC3, 0xD4, 0xD4, 0xC2, 0x12, 0xB2, 0x22, 0xB2, 0x22, 0xA2, 0x32,
+	0xA2, 0x32, 0x92, 0x42, 0x82, 0x52, 0x8B, 0x6B, 0xD2, 0xC7, 0xA7, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x30,
+	// @506 '5' (runs)
+	0xFF, 0x79, 0x89, 0x82, 0xF0, 0x2F, 0x02, 0xF0, 0x21, 0x4A, 0x98, 0x34,
+	0x2F, 0x12, 0xF0, 0x2F, 0x02, 0xF0, 0x26, 0x26, 0x27, 0xA9, 0x6F, 0xFF,
+	0xFF, 0xFF, 0xF6,
+	// @533 '6' (runs)
+	0xFF, 0xC5, 0xA7, 0x93, 0xD3, 0xE2, 0xE2, 0xF0, 0x21, 0x4A, 0x98, 0x34,
+	0x28, 0x26, 0x27, 0x26, 0x27, 0x26, 0x28, 0x24, 0x38, 0x8B, 0x5F, 0xFF,
+	0xFF, 0xFF, 0xF5,
+	// @560 '7' (runs)
+	0xFF, 0x7A, 0x7A, 0x72, 0x62, 0x72, 0x53, 0xE2, 0xF0, 0x2E, 0x3E, 0x2F,
+	0x02, 0xE3, 0xE2, 0xF0, 0x2E, 0x3E, 0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x70,
+	// @585 '8' (runs)
+	0xFF, 0x96, 0xA8, 0x83, 0x43, 0x72, 0x62, 0x72, 0x62, 0x82, 0x42, 0xA6,
+	0xB6, 0xA2, 0x42, 0x82, 0x62, 0x72, 0x62, 0x72, 0x62, 0x73, 0x43, 0x88,
+	0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+	// @615 '9' (runs)
+	0xFF, 0x95, 0xB8, 0x83, 0x42, 0x82, 0x62, 0x72, 0x62, 0x72, 0x62, 0x82,
+	0x43, 0x89, 0xA4, 0x12, 0xF0, 0x2E, 0x2E, 0x3D, 0x39, 0x7A, 0x5F, 0xFF,
+	0xFF, 0xFF, 0xF8,
+	// @642 ':' (runs)
+	0xFF, 0xFF, 0xFF, 0xF3, 0x4D, 0x4D, 0x4F, 0xFF, 0xFF, 0xF8, 0x4D, 0x4D,
+	0x4F, 0xFF, 0xFF, 0xFF, 0xF6,
+	// @659 ';' (runs)
+	0xFF, 0xFF, 0xFF, 0xF5, 0x4D, 0x4D, 0x4F, 0xFF, 0xFF, 0x63, 0xD3, 0xE2,
+	0xF0, 0x2E, 0x2F, 0x01, 0xFF, 0xFF, 0xFF, 0x50,
+	// @679 '<' (runs)
+	0xFF, 0xFF, 0xF4, 0x3D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4F, 0x04, 0xF0,
+	0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+	// @702 '=' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4D, 0xFF, 0x8D, 0x4D, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xA0,
+	// @718 '>' (runs)
+	0xFF, 0xFF, 0x93, 0xE4, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4B,
+	0x4B, 0x4B, 0x4B, 0x4B, 0x4D, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
+	// @740 '?' (runs)
+	0xFF, 0xFB, 0x5B, 0x79, 0x24, 0x38, 0x25, 0x28, 0x25, 0x2E, 0x3D, 0x3C,
+	0x4D, 0x3E, 0x2F, 0xFF, 0x33, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	// @763 '@' (runs)
+	0xFF, 0xA5, 0xB7, 0x93, 0x33, 0x82, 0x52, 0x72, 0x44, 0x72, 0x35, 0x72,
+	0x23, 0x12, 0x72, 0x22, 0x22, 0x72, 0x22, 0x22, 0x72, 0x22, 0x22, 0x72,
+	0x35, 0x72, 0x44, 0x72, 0xF1, 0x2F, 0x03, 0x42, 0x98, 0xA5, 0xFF, 0xFF,
+	0xFF, 0x10,
+	// @801 'A' (runs)
+	0xFF, 0xF9, 0x6B, 0x7E, 0x3D, 0x21, 0x2C, 0x21, 0x2B, 0x23, 0x2A, 0x23,
+	0x29, 0x24, 0x29, 0x97, 0xA7, 0x27, 0x25, 0x28, 0x23, 0x63, 0x71, 0x63,
+	0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
+	// @830 'B' (runs)
+	0xFF, 0xF7, 0xA7, 0xB8, 0x25, 0x37, 0x26, 0x27, 0x26, 0x27, 0x25, 0x37,
+	0x98, 0xA7, 0x26, 0x36, 0x27, 0x26, 0x27, 0x26, 0x27, 0x24, 0xC5, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xF4,
+	// @858 'C' (runs)
+	0xFF, 0xFC, 0x51, 0x27, 0xA6, 0x35, 0x36, 0x27, 0x25, 0x28, 0x25, 0x2F,
+	0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x12, 0x72, 0x63, 0x53, 0x79, 0xA6,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+	// @887 'D' (runs)
+	0xFF, 0xF7, 0x98, 0xB8, 0x25, 0x37, 0x26, 0x27, 0x27, 0x26, 0x27, 0x26,
+	0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x26, 0x27, 0x25, 0x35,
+	0xB6, 0xAF, 0xFF, 0xFF, 0xFF, 0xF5,
+	// @917 'E' (runs)
+	0xFF, 0xF7, 0xC5, 0xC7, 0x26, 0x27, 0x26, 0x27, 0x22, 0x22, 0x27, 0x22,
+	0x2B, 0x6B, 0x6B, 0x22, 0x2B, 0x22, 0x22, 0x27, 0x26, 0x27, 0x26, 0x25,
+	0xC5, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// @947 'F' (runs)
+	0xFF, 0xF8, 0xC5, 0xC7, 0x26, 0x27, 0x26, 0x27, 0x22, 0x22, 0x27, 0x22,
+	0x2B, 0x6B, 0x6B, 0x22, 0x2B, 0x22, 0x2B, 0x2F, 0x02, 0xD8, 0x98, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x60,
+	// @975 'G' (runs)
+	0xFF, 0xFC, 0x51, 0x27, 0xA6, 0x35, 0x36, 0x27, 0x25, 0x28, 0x25, 0x2F,
+	0x02, 0xF0, 0x24, 0x74, 0x24, 0x74, 0x28, 0x25, 0x37, 0x26, 0x35, 0x37,
+	0xA9, 0x6F, 0xFF, 0xFF, 0xFF, 0xF4,
+	// @1005 'H' (runs)
+	0xFF, 0xF7, 0x62, 0x63, 0x62, 0x65, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27,
+	0x26, 0x27, 0xA7, 0xA7, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x25,
+	0x62, 0x63, 0x62, 0x6F, 0xFF, 0xFF, 0xFF, 0xF1,
+	// @1037 'I' (runs)
+	0xFF, 0xF9, 0xA7, 0xAB, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xBA, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x30,
+	// @1062 'J' (runs)
+	0xFF, 0xFB, 0xA7, 0xAC, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x27, 0x26,
+	0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x25, 0x28, 0x9A, 0x5F, 0xFF,
+	0xFF, 0xFF, 0xF7,
+	// @1089 'K' (runs)
+	0xFF, 0xF7, 0x72, 0x53, 0x72, 0x55, 0x25, 0x28, 0x24, 0x29, 0x23, 0x2A,
+	0x22, 0x2B, 0x21, 0x3B, 0x7A, 0x32, 0x39, 0x24, 0x38, 0x25, 0x28, 0x25,
+	0x35, 0x73, 0x52, 0x73, 0x5F, 0xFF, 0xFF, 0xFF, 0xF0,
+	// @1122 'L' (runs)
+	0xFF, 0xF7, 0x89, 0x8C, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x24, 0xD4, 0xDF, 0xFF,
+	0xFF, 0xFF, 0xF2,
+	// @1149 'M' (runs)
+	0xFF, 0xF6, 0x48, 0x41, 0x56, 0x53, 0x36, 0x35, 0x44, 0x45, 0x44, 0x45,
+	0x21, 0x22, 0x21, 0x25, 0x21, 0x22, 0x21, 0x25, 0x22, 0x42, 0x25, 0x22,
+	0x42, 0x25, 0x23, 0x23, 0x25, 0x28, 0x25, 0x28, 0x23, 0x72, 0x71, 0x72,
+	0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
+	// @1190 'N' (runs)
+	0xFF, 0xF7, 0x43, 0x73, 0x43, 0x75, 0x35, 0x27, 0x44, 0x27, 0x53, 0x27,
+	0x21, 0x23, 0x27, 0x21, 0x32, 0x27, 0x22, 0x31, 0x27, 0x23, 0x21, 0x27,
+	0x23, 0x57, 0x24, 0x47, 0x25, 0x35, 0x73, 0x25, 0x73, 0x2F, 0xFF, 0xFF,
+	0xFF, 0xF3,
+	// @1228 'O' (runs)
+	0xFF, 0xFC, 0x4B, 0x88, 0x34, 0x37, 0x26, 0x26, 0x36, 0x35, 0x28, 0x25,
+	0x28, 0x25, 0x28, 0x25, 0x28, 0x25, 0x36, 0x36, 0x26, 0x27, 0x34, 0x38,
+	0x8B, 0x4F, 0xFF, 0xFF, 0xFF, 0xF6,
+	// @1258 'P' (runs)
+	0xFF, 0xF8, 0xA7, 0xB8, 0x25, 0x37, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27,
+	0x25, 0x28, 0x98, 0x7A, 0x2F, 0x02, 0xF0, 0x2D, 0x89, 0x8F, 0xFF, 0xFF,
+	0xFF, 0xF6,
+	// @1284 'Q' (runs)
+	0xFF, 0xFC, 0x4B, 0x88, 0x34, 0x37, 0x26, 0x26, 0x36, 0x35, 0x28, 0x25,
+	0x28, 0x25, 0x28, 0x25, 0x28, 0x25, 0x36, 0x36, 0x26, 0x27, 0x34, 0x38,
+	0x8A, 0x5C, 0x52, 0x27, 0xA7, 0x24, 0x3F, 0xFF, 0xFC,
+	// @1317 'R' (runs)
+	0xFF, 0xF7, 0xA7, 0xB8, 0x25, 0x37, 0x26, 0x27, 0x26, 0x27, 0x25, 0x37,
+	0x98, 0x7A, 0x23, 0x39, 0x24, 0x38, 0x25, 0x28, 0x25, 0x35, 0x73, 0x43,
+	0x74, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1,
+	// @1347 'S' (runs)
+	0xFF, 0xFB, 0x51, 0x28, 0x97, 0x34, 0x37, 0x26, 0x27, 0x26, 0x27, 0x4E,
+	0x6D, 0x6E, 0x47, 0x26, 0x27, 0x26, 0x27, 0x34, 0x37, 0x98, 0x21, 0x5F,
+	0xFF, 0xFF, 0xFF, 0xF5,
+	// @1375 'T' (runs)
+	0xFF, 0xF8, 0xC5, 0xC5, 0x23, 0x23, 0x25, 0x23, 0x23, 0x25, 0x23, 0x23,
+	0x25, 0x23, 0x23, 0x2A, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xC8, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+	// @1406 'U' (runs)
+	0xFF, 0xF7, 0x62, 0x63, 0x62, 0x65, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27,
+	0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x28,
+	0x24, 0x29, 0x8B, 0x4F, 0xFF, 0xFF, 0xFF, 0xF6,
+	// @1438 'V' (runs)
+	0xFF, 0xF7, 0x71, 0x72, 0x71, 0x74, 0x27, 0x27, 0x25, 0x28, 0x25, 0x28,
+	0x25, 0x29, 0x23, 0x2A, 0x23, 0x2B, 0x21, 0x2C, 0x21, 0x2C, 0x21, 0x2D,
+	0x3E, 0x3F, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+	// @1470 'W' (runs)
+	0xFF, 0xF6, 0x73, 0xE3, 0x72, 0x29, 0x24, 0x29, 0x24, 0x24, 0x14, 0x25,
+	0x22, 0x32, 0x26, 0x22, 0x32, 0x26, 0x21, 0x21, 0x21, 0x26, 0x21, 0x21,
+	0x21, 0x26, 0x42, 0x57, 0x33, 0x38, 0x33, 0x38, 0x25, 0x28, 0x25, 0x2F,
+	0xFF, 0xFF, 0xFF, 0xF3,
+	// @1510 'X' (runs)
+	0xFF, 0xF7, 0x62, 0x63, 0x62, 0x65, 0x26, 0x28, 0x24, 0x2A, 0x22, 0x2C,
+	0x4E, 0x2F, 0x02, 0xE4, 0xC2, 0x22, 0xA2, 0x42, 0x82, 0x62, 0x56, 0x26,
+	0x36, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	// @1541 'Y' (runs)
+	0xFF, 0xF7, 0x53, 0x63, 0x53, 0x65, 0x26, 0x28, 0x24, 0x2A, 0x22, 0x2B,
+	0x22, 0x2C, 0x4E, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2C, 0x89, 0x8F,
+	0xFF, 0xFF, 0xFF, 0xF4,
+	// @1569 'Z' (runs)
+	0xFF, 0xF9, 0xA7, 0xA7, 0x26, 0x27, 0x25, 0x28, 0x24, 0x29, 0x23, 0x2E,
+	0x2E, 0x2E, 0x24, 0x28, 0x25, 0x27, 0x26, 0x26, 0x27, 0x26, 0xB6, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xF3,
+	// @1597 '[' (runs)
+	0xFF, 0xB5, 0xC5, 0xC2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+	0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+	0x05, 0xC5, 0xFF, 0xFF, 0xD0,
+	// @1626 '\' (runs)
+	0x32, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x02, 0xF1, 0x2F,
+	0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x3F,
+	0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x2F, 0xFF, 0xFC,
+	// @1658 ']' (runs)
+	0xFF, 0x85, 0xC5, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xC5, 0xC5, 0xFF, 0xFF, 0xF1,
+	// @1687 '^' (runs)
+	0xFA, 0x1F, 0x03, 0xD5, 0xB3, 0x13, 0xA2, 0x32, 0x92, 0x52, 0x72, 0x72,
+	0x61, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// @1710 '_' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xEF, 0x11, 0xF1, 0x10,
+	// @1726 '`' (runs)
+	0xF8, 0x2F, 0x03, 0xF1, 0x3F, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+	// @1743 'a' (runs)
+	0xFF, 0xFF, 0xFF, 0xF1, 0x6A, 0x8F, 0x12, 0xF0, 0x2A, 0x78, 0x97, 0x35,
+	0x27, 0x26, 0x27, 0x25, 0x38, 0xB7, 0x51, 0x4F, 0xFF, 0xFF, 0xFF, 0xF2,
+	// @1767 'b' (runs)
+	0xFF, 0x54, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x21, 0x59, 0xA7, 0x35, 0x27,
+	0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x35, 0x25,
+	0xC5, 0x41, 0x5F, 0xFF, 0xFF, 0xFF, 0xF5,
+	// @1798 'c' (runs)
+	0xFF, 0xFF, 0xFF, 0xF3, 0x51, 0x27, 0xA6, 0x35, 0x35, 0x37, 0x25, 0x28,
+	0x25, 0x2F, 0x02, 0xF0, 0x37, 0x26, 0x35, 0x37, 0x9A, 0x6F, 0xFF, 0xFF,
+	0xFF, 0xF4,
+	// @1824 'd' (runs)
+	0xFF, 0xD4, 0xD4, 0xF0, 0x2F, 0x02, 0x95, 0x12, 0x7A, 0x72, 0x53, 0x62,
+	0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x72, 0x53, 0x7C,
+	0x75, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	// @1855 'e' (runs)
+	0xFF, 0xFF, 0xFF, 0xF2, 0x69, 0xA7, 0x26, 0x26, 0x28, 0x25, 0xC5, 0xC5,
+	0x2F, 0x02, 0xF1, 0x27, 0x26, 0xB8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4,
+	// @1878 'f' (runs)
+	0xFF, 0xB7, 0x98, 0x82, 0xF0, 0x2C, 0xB6, 0xB9, 0x2F, 0x02, 0xF0, 0x2F,
+	0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2C, 0xA7, 0xAF, 0xFF, 0xFF, 0xFF, 0xF4,
+	// @1902 'g' (runs)
+	0xFF, 0xFF, 0xFF, 0xF2, 0x51, 0x45, 0xC5, 0x25, 0x36, 0x27, 0x26, 0x27,
+	0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x27, 0x25, 0x37, 0xA9, 0x51, 0x2F,
+	0x02, 0xF0, 0x2E, 0x38, 0x89, 0x6F, 0xFB,
+	// @1933 'h' (runs)
+	0xFF, 0x54, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x21, 0x59, 0x98, 0x34, 0x37,
+	0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x25,
+	0x62, 0x63, 0x62, 0x6F, 0xFF, 0xFF, 0xFF, 0xF1,
+	// @1965 'i' (runs)
+	0xFF, 0xB2, 0xF0, 0x2F, 0xFF, 0x06, 0xB6, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+	0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2A, 0xC5, 0xCF, 0xFF, 0xFF, 0xFF, 0xF2,
+	// @1989 'j' (runs)
+	0xFF, 0xC2, 0xF0, 0x2F, 0xFE, 0x98, 0x9F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE3,
+	0x88, 0x96, 0xFF, 0xC0,
+	// @2017 'k' (runs)
+	0xFF, 0x64, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x22, 0x58, 0x22, 0x58, 0x22,
+	0x2B, 0x21, 0x2C, 0x5C, 0x4D, 0x5C, 0x21, 0x3B, 0x22, 0x38, 0x43, 0x55,
+	0x43, 0x5F, 0xFF, 0xFF, 0xFF, 0xF2,
+	// @2047 'l' (runs)
+	0xFF, 0x76, 0xB6, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2A, 0xC5, 0xCF, 0xFF, 0xFF,
+	0xFF, 0xF2,
+	// @2073 'm' (runs)
+	0xFF, 0xFF, 0xFF, 0xC4, 0x13, 0x14, 0x4E, 0x53, 0x23, 0x22, 0x52, 0x32,
+	0x32, 0x52, 0x32, 0x32, 0x52, 0x32, 0x32, 0x52, 0x32, 0x32, 0x52, 0x32,
+	0x32, 0x52, 0x32, 0x32, 0x36, 0x14, 0x14, 0x16, 0x14, 0x14, 0xFF, 0xFF,
+	0xFF, 0xFF,
+	// @2111 'n' (runs)
+	0xFF, 0xFF, 0xFF, 0xD4, 0x15, 0x7B, 0x83, 0x43, 0x72, 0x62, 0x72, 0x62,
+	0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x56, 0x26, 0x36, 0x26,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	// @2140 'o' (runs)
+	0xFF, 0xFF, 0xFF, 0xF3, 0x4B, 0x88, 0x34, 0x36, 0x36, 0x35, 0x28, 0x25,
+	0x28, 0x25, 0x28, 0x25, 0x36, 0x36, 0x34, 0x38, 0x8B, 0x4F, 0xFF, 0xFF,
+	0xFF, 0xF6,
+	// @2166 'p' (runs)
+	0xFF, 0xFF, 0xFF, 0xD4, 0x15, 0x7C, 0x73, 0x52, 0x72, 0x72, 0x62, 0x72,
+	0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x63, 0x52, 0x7A, 0x72, 0x15, 0x92,
+	0xF0, 0x2F, 0x02, 0xD7, 0xA7, 0xFF, 0xD0,
+	// @2197 'q' (runs)
+	0xFF, 0xFF, 0xFF, 0xF2, 0x51, 0x45, 0xC5, 0x25, 0x36, 0x27, 0x26, 0x27,
+	0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x27, 0x25, 0x37, 0xA9, 0x51, 0x2F,
+	0x02, 0xF0, 0x2F, 0x02, 0xC7, 0xA7, 0xFF, 0x60,
+	// @2229 'r' (runs)
+	0xFF, 0xFF, 0xFF, 0xE5, 0x24, 0x65, 0x16, 0x85, 0x22, 0x83, 0xE2, 0xF0,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xCA, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+	// @2253 's' (runs)
+	0xFF, 0xFF, 0xFF, 0xF2, 0x88, 0x97, 0x26, 0x27, 0x26, 0x27, 0x6C, 0x8D,
+	0x57, 0x26, 0x27, 0x25, 0x37, 0x98, 0x8F, 0xFF, 0xFF, 0xFF, 0xF5,
+	// @2276 't' (runs)
+	0xFF, 0x82, 0xF0, 0x2F, 0x02, 0xF0, 0x2D, 0xA7, 0xA9, 0x2F, 0x02, 0xF0,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x25, 0x38, 0x99, 0x6F, 0xFF, 0xFF,
+	0xFF, 0xF4,
+	// @2302 'u' (runs)
+	0xFF, 0xFF, 0xFF, 0xD4, 0x44, 0x54, 0x44, 0x72, 0x62, 0x72, 0x62, 0x72,
+	0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x53, 0x8B, 0x75, 0x14,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+	// @2331 'v' (runs)
+	0xFF, 0xFF, 0xFF, 0xD5, 0x45, 0x35, 0x45, 0x52, 0x62, 0x72, 0x62, 0x82,
+	0x42, 0x92, 0x42, 0xA2, 0x22, 0xB2, 0x22, 0xB6, 0xC4, 0xD4, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x60,
+	// @2358 'w' (runs)
+	0xFF, 0xFF, 0xFF, 0xD4, 0x54, 0x44, 0x54, 0x52, 0x31, 0x32, 0x62, 0x23,
+	0x22, 0x62, 0x23, 0x22, 0x72, 0x11, 0x11, 0x12, 0x84, 0x14, 0x84, 0x14,
+	0x83, 0x32, 0xA2, 0x32, 0xA2, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+	// @2393 'x' (runs)
+	0xFF, 0xFF, 0xFF, 0xE5, 0x25, 0x55, 0x25, 0x72, 0x42, 0xA2, 0x22, 0xC4,
+	0xE2, 0xE4, 0xC2, 0x22, 0xA2, 0x42, 0x75, 0x25, 0x55, 0x25, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x20,
+	// @2420 'y' (runs)
+	0xFF, 0xFF, 0xFF, 0xD6, 0x45, 0x26, 0x45, 0x42, 0x72, 0x72, 0x52, 0x82,
+	0x52, 0x92, 0x32, 0xA2, 0x32, 0xB2, 0x12, 0xC5, 0xD3, 0xF0, 0x2E, 0x2F,
+	0x02, 0xE2, 0xB8, 0x98, 0xFF, 0xB0,
+	// @2450 'z' (runs)
+	0xFF, 0xFF, 0xFF, 0xF0, 0xA7, 0xA7, 0x25, 0x28, 0x24, 0x2E, 0x2E, 0x2E,
+	0x2E, 0x24, 0x28, 0x25, 0x27, 0xA7, 0xAF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// @2473 '{' (runs)
+	0xFF, 0xC3, 0xD4, 0xD2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2E,
+	0x3D, 0x3F, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x04,
+	0xE3, 0xFF, 0xFF, 0xE0,
+	// @2501 '|' (runs)
+	0xFF, 0xB2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+	0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+	0x2F, 0x02, 0xF0, 0x2F, 0xFF, 0xFF, 0x10,
+	// @2532 '}' (runs)
+	0xFF, 0x93, 0xE4, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+	0xF0, 0x3F, 0x03, 0xD3, 0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xD4,
+	0xD3, 0xFF, 0xFF, 0xF2,
+	// @2560 '~' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x3D, 0x53, 0x26, 0x31, 0x31, 0x36, 0x23,
+	0x5D, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+};
+
+const uint16_t Font24P_Offsets[] =
+{
+	0x8000, 0x800E, 0x8023, 0x803B, 0x805C, 0x807C, 0x8099, 0x80B4,
+	0x80C7, 0x80DF, 0x80F7, 0x810E, 0x8126, 0x8138, 0x8147, 0x8157,
+	0x8172, 0x8192, 0x81AC, 0x81C4, 0x81DE, 0x81FA, 0x8215, 0x8230,
+	0x8249, 0x8267, 0x8282, 0x8293, 0x82A7, 0x82BE, 0x82CE, 0x82E4,
+	0x82FB, 0x8321, 0x833E, 0x835A, 0x8377, 0x8395, 0x83B3, 0x83CF,
+	0x83ED, 0x840D, 0x8426, 0x8441, 0x8462, 0x847D, 0x84A6, 0x84CC,
+	0x84EA, 0x8504, 0x8525, 0x8543, 0x855F, 0x857E, 0x859E, 0x85BE,
+	0x85E6, 0x8605, 0x8621, 0x863D, 0x865A, 0x867A, 0x8697, 0x86AE,
+	0x86BE, 0x86CF, 0x86E7, 0x8706, 0x8720, 0x873F, 0x8756, 0x876E,
+	0x878D, 0x87AD, 0x87C5, 0x87E1, 0x87FF, 0x8819, 0x883F, 0x885C,
+	0x8876, 0x8895, 0x88B5, 0x88CD, 0x88E4, 0x88FE, 0x891B, 0x8936,
+	0x8959, 0x8974, 0x8992, 0x89A9, 0x89C5, 0x89E4, 0x8A00, 0x0A14,
+};
+
+const sPACKED Font24P_Packed = {
+  Font24P_Data,
+  Font24P_Offsets,
+  32, /* First */
+  126, /* Last */
+};
+
+sFONT Font24P = {
+  0,
+  17, /* Width */
+  24, /* Height */
+  &Font24P_Packed,
+};
@@ -69,33 +69,8 @@ static void drawEdge(int x1, int y1, int x2, int y2, COLOR color) {
 
 // Direct SPI read from touch controller (bypasses IRQ check)
 static bool readTouchDirect(int& outX, int& outY) {
-    uint16_t rawX = 0, rawY = 0;
-
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-
-    digitalWrite(4, LOW);  // TP_CS low
-
-    // Read X (command 0xD0)
-    SPI.transfer(0xD0);
-    delayMicroseconds(200);
-    rawX = SPI.transfer(0x00);
-    rawX <<= 8;
-    rawX |= SPI.transfer(0x00);
-    rawX >>= 3;
-
-    // Read Y (command 0x90)
-    SPI.transfer(0x90);
-    delayMicroseconds(200);
-    rawY = SPI.transfer(0x00);
-    rawY <<= 8;
-    rawY |= SPI.transfer(0x00);
-    rawY >>= 3;
-
-    digitalWrite(4, HIGH);  // TP_CS high
-
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+    POINT rawX = 0, rawY = 0;
+    touch.readRaw(rawX, rawY);
 
     // Check if touch is valid (values in reasonable range)
     if (rawX > 100 && rawX < 4000 && rawY > 100 && rawY < 4000) {
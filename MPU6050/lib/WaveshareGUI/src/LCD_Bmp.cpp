@@ -0,0 +1,144 @@
+/*****************************************************************************
+* | File        :   LCD_Bmp.c
+* | Author      :   Amit Resh, May 2025
+* |                 
+* | Function    :   Display BMP file pics on WaveShare LCD 
+* | Info        :   Accepts BMP files with 24, 16 or 8 Bits/Pixel
+*   Image scanning
+*      Please use progressive scanning to generate images or fonts
+*---------------- Based On -------------
+* | Waveshare team (Basic version)
+* | version     :   V1.0
+* | Date        :   2018-01-11
+******************************************************************************/
+// #include <SD.h>
+// #include <SPI.h>
+
+#include "LCD_Bmp.h"
+#include "Debug.h"
+#include <string.h>
+
+#define BUFFPIXEL_X3(__val)    ( (__val) * 3)                 // BUFFPIXELx3
+#define RGB24TORGB565(R,G,B) (( (R) >> 3 ) << 11 ) | (( (G) >> 2 ) << 5) | ( (B) >> 3)
+#define RGB555TORGB565(L,H)  (((H)<<9) | (((L)&0xC0)<<1) | ((L)&0x1F))
+
+
+/// @brief Convert one BMP raster line to RGB565, each pixel zoom times
+/// @param rasterLine - The line as stored in the file
+/// @param pixLine - Receives BMPhdr.Width*zoom pixels
+/// @param LUT - Color palette (BMPhdr.ColorsUsed entries), NULL without one
+/// @param ARGB_Format - Palette entries are ARGB rather than BGR0
+static void LCD_BmpLine(const uint8_t *rasterLine, COLOR *pixLine, const uint32_t *LUT,
+                        bool ARGB_Format, int8_t zoom)
+{
+  uint16_t bytePerPix = BMPhdr.bitCount/8;
+  for (uint16_t pix=0 ; pix<BMPhdr.Width ; ++pix) {
+    uint16_t k=pix*bytePerPix;
+    COLOR Color = 0;
+    switch (bytePerPix) {
+      case 1:
+        if (BMPhdr.ColorsUsed) {                                          //This BMP using a color pallette?
+          uint8_t lutIdx = rasterLine[k];
+          if (ARGB_Format)                                                //Using ARGB:
+            Color = RGB24TORGB565((LUT[lutIdx]>>16)&0xFF, (LUT[lutIdx]>>8)&0xFF, LUT[lutIdx]&0xFF);
+          else                                                            //Using BGR0:
+            Color = RGB24TORGB565((LUT[lutIdx]>>8)&0xFF, (LUT[lutIdx]>>16)&0xFF, (LUT[lutIdx]>>24)&0xFF);
+        }                                                                 //Using Monochrome (256 shades)
+        else
+          Color = RGB24TORGB565(rasterLine[k], rasterLine[k], rasterLine[k]);
+        break;
+      case 2:
+        Color = RGB555TORGB565(rasterLine[k], rasterLine[k+1]);
+        break;
+      case 3:
+        Color = RGB24TORGB565(rasterLine[k + 2], rasterLine[k + 1], rasterLine[k]);
+        break;
+    }
+    for (int i=0 ; i<zoom ; ++i)
+      *pixLine++ = Color;
+  }
+}
+
+/// @author Amit Resh May 2025
+/// @brief Display a BMP on WaveShare LCD
+/// @param bmpFile - FILE* to open BMP file (on ESP32 FileSystem, like SPIFFS)
+/// @param xOffset - Leftmost column
+/// @param yOffset - Top most line
+void LCD_DrawBmp( File bmpFile, uint16_t xOffset, uint16_t yOffset, int8_t zoom)
+{
+  uint16_t bytePerPix = BMPhdr.bitCount/8;
+  uint16_t rasterWidth = BMPhdr.Width*bytePerPix;
+  if (rasterWidth%4)
+    rasterWidth += 4-(rasterWidth%4);
+  uint8_t rasterLine[rasterWidth];                       //Buffer for one full raster line
+  COLOR pixLine[BMPhdr.Width*zoom];                      //The same line as it goes to the LCD
+
+  uint32_t LUT[BMPhdr.ColorsUsed ? BMPhdr.ColorsUsed : 1];   //Color palette, if the BMP has one
+  const uint32_t *pLUT = BMPhdr.ColorsUsed ? LUT : NULL;
+  bool ARGB_Format=true;
+
+  if (BMPhdr.ColorsUsed) {
+    bmpFile.seek(14+40);                                 //Skip Headers to Color Pallette
+    bmpFile.readBytes((char*)LUT, BMPhdr.ColorsUsed*4);
+    for (uint32_t i=0 ; i<BMPhdr.ColorsUsed; ++i)
+      ARGB_Format &= (LUT[i]>>24)==0xFF;
+    Serial.printf("Using a color palette Format: %s\n", ARGB_Format ? "ARGB":"BGR0");
+  }
+
+  bmpFile.seek( BMPhdr.dataOffset);
+
+  for ( uint16_t line = 0; line < BMPhdr.Height*zoom; line+=zoom) {  //Loop for all Raster lines
+    size_t got = bmpFile.read(rasterLine, rasterWidth);
+    if (got < rasterWidth)                               //Truncated file: the rest of the line is black
+      memset(rasterLine + got, 0, rasterWidth - got);
+
+    //  ======  Copy BMP line to LCD, one window per screen row   ==========================
+    LCD_BmpLine(rasterLine, pixLine, pLUT, ARGB_Format, zoom);
+    for (int r=0 ; r<zoom; ++r) {
+      LCD_SetWindow( xOffset, line+yOffset+r, xOffset + BMPhdr.Width*zoom, line+yOffset+r+1);
+      LCD_WritePixels(pixLine, BMPhdr.Width*zoom);
+    }
+  }
+}
+
+/// @author Amit Resh June 2025
+/// @brief Display a BMP on WaveShare LCD
+/// @param BmpMF - a BMP Memory File object
+/// @param xOffset - Leftmost column
+/// @param yOffset - Top most line
+void LCD_DrawBmp( BmpMF& BmpMF, uint16_t xOffset, uint16_t yOffset, int8_t zoom)
+{
+  uint16_t bytePerPix = BMPhdr.bitCount/8;
+  uint16_t rasterWidth = BMPhdr.Width*bytePerPix;
+  if (rasterWidth%4)
+    rasterWidth += 4-(rasterWidth%4);
+  uint8_t rasterLine[rasterWidth];                       //Buffer for one full raster line
+  COLOR pixLine[BMPhdr.Width*zoom];                      //The same line as it goes to the LCD
+
+  uint32_t LUT[BMPhdr.ColorsUsed ? BMPhdr.ColorsUsed : 1];   //Color palette, if the BMP has one
+  const uint32_t *pLUT = BMPhdr.ColorsUsed ? LUT : NULL;
+  bool ARGB_Format=true;
+
+  if (BMPhdr.ColorsUsed) {
+    BmpMF.BmpMFseek(14+40);                                 //Skip Headers to Color Pallette
+    BmpMF.BmpMFread((unsigned char*)LUT, BMPhdr.ColorsUsed*4);
+    for (uint32_t i=0 ; i<BMPhdr.ColorsUsed; ++i)
+      ARGB_Format &= (LUT[i]>>24)==0xFF;
+    Serial.printf("Using a color palette Format: %s\n", ARGB_Format ? "ARGB":"BGR0");
+  }
+
+  BmpMF.BmpMFseek(BMPhdr.dataOffset);
+
+  for ( uint16_t line = 0; line < BMPhdr.Height*zoom; line+=zoom) {  //Loop for all Raster lines
+    size_t got = BmpMF.BmpMFread(rasterLine, rasterWidth);
+    if (got < rasterWidth)                               //Truncated file: the rest of the line is black
+      memset(rasterLine + got, 0, rasterWidth - got);
+
+    //  ======  Copy BMP line to LCD, one window per screen row   ==========================
+    LCD_BmpLine(rasterLine, pixLine, pLUT, ARGB_Format, zoom);
+    for (int r=0 ; r<zoom; ++r) {
+      LCD_SetWindow( xOffset, line+yOffset+r, xOffset + BMPhdr.Width*zoom, line+yOffset+r+1);
+      LCD_WritePixels(pixLine, BMPhdr.Width*zoom);
+    }
+  }
+}
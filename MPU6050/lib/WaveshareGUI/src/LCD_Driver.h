@@ -10,6 +10,10 @@
 * | Date        :   2018-01-11
 * | Info        :   Basic version
 *
+* | The LCD_* functions keep their names and arguments, but the panel is
+* | driven by one WaveshareLCD object (the class library): CS held across a
+* | command, cached address windows and DMA fills. sLCD_DIS follows it.
+*
 ******************************************************************************/
 
 /**************************Intermediate driver layer**************************/
@@ -17,23 +21,14 @@
 #ifndef __LCD_DRIVER_H
 #define __LCD_DRIVER_H
 
+#include "WaveshareLCD.h"
 #include "WVSHR_Config.h"
 
-#define	COLOR				uint16_t		//The variable type of the color (unsigned short) 
-#define	POINT				uint16_t		//The type of coordinate (unsigned short) 
-#define	LENGTH				uint16_t		//The type of coordinate (unsigned short) 
-
 /********************************************************************************
 function:
-		Define the full screen height length of the display
+		COLOR, POINT, LENGTH and the screen size (LCD_X_MAXPIXEL, LCD_WIDTH,
+		LCD_HEIGHT ...) come from LCDTypes.h of the WaveshareLCD library
 ********************************************************************************/
-#define LCD_X_MAXPIXEL  480  //LCD width maximum memory 
-#define LCD_Y_MAXPIXEL  320 //LCD height maximum memory
-#define LCD_X	 0
-#define LCD_Y	 0
-
-#define LCD_WIDTH  (LCD_X_MAXPIXEL - 2 * LCD_X)  //LCD width
-#define LCD_HEIGHT  LCD_Y_MAXPIXEL //LCD height
 
 /********************************************************************************
 function:
@@ -71,6 +66,7 @@ function:
 			Macro definition variable name
 ********************************************************************************/
 void LCD_Init(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval);
+void LCD_WarmInit(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval);
 void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir);
 
 void LCD_WriteReg(uint8_t Reg);
@@ -79,9 +75,17 @@ void LCD_WriteData(uint8_t Data);
 void LCD_SetWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend);
 void LCD_SetCursor(POINT Xpoint, POINT Ypoint);
 void LCD_SetWindowColor(COLOR Color, POINT width, POINT hght);
+void LCD_WritePixels(const COLOR *pData, uint32_t DataLen);
 void LCD_SetPoint2Color(POINT Xpoint, POINT Ypoint, COLOR Color);
 void LCD_SetArea2Color(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend, COLOR  Color);
 void LCD_Clear(COLOR  Color);
+
+void LCD_SetScrollArea(LENGTH TopFixed, LENGTH BottomFixed);
+void LCD_ScrollTo(POINT Line);
+void LCD_EndScroll(void);
+
+//The panel behind these functions, for code that mixes in the class API
+WaveshareLCD& LCD_Panel(void);
 #endif
 
 
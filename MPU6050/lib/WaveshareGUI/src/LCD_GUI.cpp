@@ -0,0 +1,245 @@
+/*****************************************************************************
+  | File      	:	LCD_GUI.c
+  | Author      : Amit Resh
+  | Date        : May 2025
+  |
+  | Function    :	Achieve drawing: draw points, lines, boxes, circles
+                    with: size, solid dotted line, solid rectangle, hollow
+					          rectangle, solid circle, hollow circle.
+                  Achieve display characters: Display a single character,
+                    string, number
+  |------------------------------------------------------------------------
+  | based on    :   Waveshare team
+  |	version     :   V1.0
+  | Date        :   2017-08-16
+  | Info        :   Basic version
+  |
+  | The drawing itself is WaveshareLCD's (LCDSurface): spans and glyph runs
+  | through one window each, the same pixels the GUI_* functions always
+  | drew. The enums here have the values of the class ones.
+
+******************************************************************************/
+#include "LCD_GUI.h"
+#include "LCDFormat.h"
+#include "Debug.h"
+
+/******************************************************************************
+function:	Clear Display
+parameter:
+  color - Background color
+******************************************************************************/
+void GUI_Clear(COLOR Color)
+{
+  LCD_Clear(Color);
+}
+
+/******************************************************************************
+function:	Draw Point(Xpoint, Ypoint) Fill the color
+parameter:
+	Xpoint		  :   The x coordinate of the point
+	Ypoint		  :   The y coordinate of the point
+	Color		    :   Set color
+	Dot_Pixel	  :	  point size
+  Dot_FillWay :   dot fill style
+******************************************************************************/
+void GUI_DrawPoint(POINT Xpoint, POINT Ypoint, COLOR Color,
+                   DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay)
+{
+  LCD_Panel().drawPoint(Xpoint, Ypoint, Color, (DotPixel)Dot_Pixel, (DotStyle)Dot_FillWay);
+}
+
+/******************************************************************************
+  function:	Draw a line of arbitrary slope
+  parameter:
+	Xstart ：Starting x point coordinates
+	Ystart ：Starting y point coordinates
+	Xend   ：End point x coordinate
+	Yend   ：End point y coordinate
+	Color  ：The color of the line segment
+  Line_Style  : LINE_SOLID | LINE_DOTTED
+  Dot_Pixel   : Pixels per Dot [1X1] ... [8X8]
+******************************************************************************/
+void GUI_DrawLine(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                  COLOR Color, LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel)
+{
+  LCD_Panel().drawLine(Xstart, Ystart, Xend, Yend, Color,
+                       (LineStyle)Line_Style, (DotPixel)Dot_Pixel);
+}
+
+/******************************************************************************
+  function:	Draw an anti-aliased line (Wu's algorithm)
+  parameter:
+	Xstart ：Starting x point coordinates
+	Ystart ：Starting y point coordinates
+	Xend   ：End point x coordinate
+	Yend   ：End point y coordinate
+	Color  ：The color of the line segment
+	Color_Background ：Color the line is blended against
+******************************************************************************/
+void GUI_DrawLineAA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                    COLOR Color, COLOR Color_Background)
+{
+  LCD_Panel().drawLineAA(Xstart, Ystart, Xend, Yend, Color, Color_Background);
+}
+
+/******************************************************************************
+  function:	Draw a rectangle
+  parameter:
+	Xstart ：Rectangular  Starting x point coordinates
+	Ystart ：Rectangular  Starting x point coordinates
+	Xend   ：Rectangular  End point x coordinate
+	Yend   ：Rectangular  End point y coordinate
+	Color  ：The color of the Rectangular segment
+	Filled : Whether it is filled--- 1 solid 0：empty
+  Dot_Pixel   : Pixels per Dot [1X1] ... [8X8]
+  Line_Style  : LINE_SOLID (default) | LINE_DOTTED -- irrelevant if Solid-Fill
+******************************************************************************/
+void GUI_DrawRectangle(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       COLOR Color, DRAW_FILL Filled, DOT_PIXEL Dot_Pixel, LINE_STYLE Line_Style)
+{
+  LCD_Panel().drawRectangle(Xstart, Ystart, Xend, Yend, Color,
+                            (DrawFill)Filled, (DotPixel)Dot_Pixel, (LineStyle)Line_Style);
+}
+
+/******************************************************************************
+  function:	Use the 8-point method to draw a circle of the
+				specified size at the specified position.
+  parameter:
+	X_Center  ：Center X coordinate
+	Y_Center  ：Center Y coordinate
+	Radius    ：circle Radius
+	Color     ：The color of the ：circle segment
+	Filled    : Whether it is filled: 1 filling 0：Do not
+******************************************************************************/
+void GUI_DrawCircle(POINT X_Center, POINT Y_Center, LENGTH Radius,
+                    COLOR Color, DRAW_FILL  Draw_Fill , DOT_PIXEL Dot_Pixel)
+{
+  LCD_Panel().drawCircle(X_Center, Y_Center, Radius, Color,
+                         (DrawFill)Draw_Fill, (DotPixel)Dot_Pixel);
+}
+
+/******************************************************************************
+  function:	Use the midpoint method to draw an ellipse of the
+				specified size at the specified position.
+  parameter:
+	X_Center  ：Center X coordinate
+	Y_Center  ：Center Y coordinate
+	X_Radius  ：Horizontal radius
+	Y_Radius  ：Vertical radius
+	Color     ：The color of the ellipse
+	Filled    : Whether it is filled: 1 filling 0：Do not
+******************************************************************************/
+void GUI_DrawEllipse(POINT X_Center, POINT Y_Center, LENGTH X_Radius, LENGTH Y_Radius,
+                     COLOR Color, DRAW_FILL Draw_Fill, DOT_PIXEL Dot_Pixel)
+{
+  LCD_Panel().drawEllipse(X_Center, Y_Center, X_Radius, Y_Radius, Color,
+                          (DrawFill)Draw_Fill, (DotPixel)Dot_Pixel);
+}
+
+/******************************************************************************
+  function:	Display ASCII character
+  parameter:
+	Xpoint           ：X coordinate
+	Ypoint           ：Y coordinate
+	Acsii_Char       ：ASCII of character
+	Font             ：A structure pointer that displays a character size
+	Color_Background : Select the background color of the English character
+	Color_Foreground : Select the foreground color of the English character
+******************************************************************************/
+void GUI_DisChar(POINT Xpoint, POINT Ypoint, const char Acsii_Char,
+                 sFONT* Font, COLOR Color_Background, COLOR Color_Foreground)
+{
+  LCD_Panel().drawChar(Xpoint, Ypoint, Acsii_Char, Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+  function:	Display a string
+  parameter:
+	Xstart           ：X coordinate
+	Ystart           ：Y coordinate
+	pString          ：Pointer to char string to be displayed
+	Font             ：A structure pointer that displays a character size
+	Color_Background : Select the background color of the English character
+	Color_Foreground : Select the foreground color of the English character
+******************************************************************************/
+void GUI_DisString_EN(POINT Xstart, POINT Ystart, const char * pString,
+                      sFONT* Font, COLOR Color_Background, COLOR Color_Foreground )
+{
+  LCD_Panel().drawString(Xstart, Ystart, pString, Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+  function:	Display a (int) Number
+  parameter:
+	Xstart           ：X coordinate
+	Ystart           : Y coordinate
+	Nummber          : The number displayed
+	Font             ：A structure pointer that displays a character size
+	Color_Background : Select the background color of the English character
+	Color_Foreground : Select the foreground color of the English character
+******************************************************************************/
+void GUI_DisNum(POINT Xpoint, POINT Ypoint, int32_t Nummber,
+                sFONT* Font, COLOR Color_Background, COLOR Color_Foreground )
+{
+  LCD_Panel().drawNumber(Xpoint, Ypoint, Nummber, Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+  function:	Format a number without snprintf
+  parameter:
+	pOut     : Receives the string, GUI_NUM_LEN bytes
+	Nummber  : Number to format
+	Decimals : Digits after the point; Nummber is the value * 10^Decimals
+	           (GUI_FormatFixed(pOut, -105, 2) writes "-1.05")
+  return:   Length of the string
+******************************************************************************/
+uint8_t GUI_FormatNum(char *pOut, int32_t Nummber)
+{
+  return LCDFormat::integer(pOut, Nummber);
+}
+
+uint8_t GUI_FormatFixed(char *pOut, int32_t Nummber, uint8_t Decimals)
+{
+  return LCDFormat::fixed(pOut, Nummber, Decimals);
+}
+
+/******************************************************************************
+  function:	Display the bit map,1 byte = 8bit = 8 points
+  parameter:
+	Xpoint ：X coordinate
+	Ypoint : Y coordinate
+	pMap   : Pointing to the picture
+	Width  ：Bitmap Width
+	Height : Bitmap Height
+  note:
+	This function is suitable for bitmap, because a 16-bit data accounted for 16 points
+******************************************************************************/
+void GUI_Disbitmap(POINT Xpoint, POINT Ypoint, const unsigned char *pMap,
+                   POINT Width, POINT Height)
+{
+  LCD_Panel().drawBitmap(Xpoint, Ypoint, pMap, Width, Height);
+}
+
+/******************************************************************************
+  function:	Display the Gray map,1 byte = 8bit = 2 points
+  parameter:
+	Xpoint ：X coordinate
+	Ypoint : Y coordinate
+	pMap   : Pointing to the picture
+  note:
+	This function is suitable for bitmap, because a 4-bit data accounted for 1 points
+	Please use the Image2lcd generated array
+******************************************************************************/
+void GUI_DisGrayMap(POINT Xpoint, POINT Ypoint, const unsigned char *pBmp)
+{
+  LCD_Panel().drawGrayMap(Xpoint, Ypoint, pBmp);
+}
+
+sFONT *GUI_GetFontSize(POINT Dx, POINT Dy)
+{
+  sFONT *Font = LCD_Panel().getFontForSize(Dx, Dy);
+  if (Font == NULL) {
+    DEBUG("Please change the display area size, or add a larger font to modify\r\n");
+  }
+  return Font;
+}
@@ -0,0 +1,178 @@
+/*****************************************************************************
+* | File      	:	LCD_Label.cpp
+* | Function    :	Text readout that redraws only the characters that changed
+* | Info        :   See LCD_Label.h
+******************************************************************************/
+#include "LCD_Label.h"
+#include <string.h>
+
+/******************************************************************************
+  function:	Clear Count cells of a label's font at (Xpoint, Ypoint)
+******************************************************************************/
+static void GUI_LabelClear(const GUI_LABEL *pLabel, int32_t Xpoint, int32_t Ypoint,
+                           sFONT *Font, uint8_t Count)
+{
+  if (Count == 0)
+    return;
+
+  //A character at (Xpoint, Ypoint) covers Xpoint-1 .. Xpoint-1+Width
+  int32_t Left = Xpoint - 1, Top = Ypoint - 1;
+  LCD_SetArea2Color(Left < 0 ? 0 : Left, Top < 0 ? 0 : Top,
+                    Left + Count * Font->Width, Top + Font->Height, pLabel->Color_Background);
+}
+
+/******************************************************************************
+  function:	Draw Count characters of pString at (Xpoint, Ypoint)
+******************************************************************************/
+static void GUI_LabelDraw(const GUI_LABEL *pLabel, int32_t Xpoint, int32_t Ypoint,
+                          const char *pString, uint8_t Count)
+{
+  char Run[LABEL_MAX_LEN + 1];
+
+  if (Count == 0)
+    return;
+
+  //Transparent text only adds pixels: clear the cells first
+  if (FONT_BACKGROUND == pLabel->Color_Background)
+    GUI_LabelClear(pLabel, Xpoint, Ypoint, pLabel->Font, Count);
+
+  memcpy(Run, pString, Count);
+  Run[Count] = '\0';
+  GUI_DisString_EN(Xpoint, Ypoint, Run, pLabel->Font,
+                   pLabel->Color_Background, pLabel->Color_Foreground);
+}
+
+/******************************************************************************
+  function:	Show Len characters of pString, redrawing only what changed
+******************************************************************************/
+static void GUI_LabelShow(GUI_LABEL *pLabel, const char *pString, uint8_t Len)
+{
+  sFONT *Font = pLabel->Font;
+  if (Font == NULL)
+    return;
+
+  int32_t W = Font->Width, H = Font->Height;
+  int32_t Extent = Len * W;
+
+  //Where the text goes; text wider than the box starts at its left edge
+  int32_t Xpoint = pLabel->Xstart;
+  if (Extent < pLabel->Width) {
+    if (pLabel->Align == LABEL_RIGHT)
+      Xpoint += pLabel->Width - Extent;
+    else if (pLabel->Align == LABEL_CENTER)
+      Xpoint += (pLabel->Width - Extent) / 2;
+  }
+  int32_t Ypoint = pLabel->Ystart;
+  if (H < pLabel->Height)
+    Ypoint += (pLabel->Height - H) / 2;
+
+  if (!pLabel->Valid) {
+    //Nothing known on screen
+    GUI_LabelDraw(pLabel, Xpoint, Ypoint, pString, Len);
+  } else if (pLabel->Shown_Font != Font || Ypoint != pLabel->Shown_Y ||
+             (Xpoint - pLabel->Shown_X) % W != 0 ||
+             pLabel->Shown_Background != pLabel->Color_Background ||
+             pLabel->Shown_Foreground != pLabel->Color_Foreground) {
+    //The cells moved or changed color: clear the old ones, draw everything
+    GUI_LabelClear(pLabel, pLabel->Shown_X, pLabel->Shown_Y, pLabel->Shown_Font, pLabel->Shown_Len);
+    GUI_LabelDraw(pLabel, Xpoint, Ypoint, pString, Len);
+  } else {
+    //Same cells: walk both strings and draw or clear runs that differ
+    int32_t Base = Xpoint < pLabel->Shown_X ? Xpoint : pLabel->Shown_X;
+    int32_t Old_First = (pLabel->Shown_X - Base) / W, New_First = (Xpoint - Base) / W;
+    int32_t Old_Last = Old_First + pLabel->Shown_Len, New_Last = New_First + Len;
+    int32_t Cells = Old_Last > New_Last ? Old_Last : New_Last;
+    int32_t Run = -1;
+    bool Run_Draws = false;
+
+    for (int32_t i = 0; i <= Cells; i++) {
+      bool Has_New = i >= New_First && i < New_Last;
+      bool Has_Old = i >= Old_First && i < Old_Last;
+      bool Draws = Has_New && (!Has_Old || pString[i - New_First] != pLabel->Shown[i - Old_First]);
+      bool Changed = i < Cells && (Draws || (Has_Old && !Has_New));
+
+      if (Run >= 0 && (!Changed || Draws != Run_Draws)) {
+        if (Run_Draws)
+          GUI_LabelDraw(pLabel, Base + Run * W, Ypoint, pString + (Run - New_First), i - Run);
+        else
+          GUI_LabelClear(pLabel, Base + Run * W, Ypoint, Font, i - Run);
+        Run = -1;
+      }
+      if (Changed && Run < 0) {
+        Run = i;
+        Run_Draws = Draws;
+      }
+    }
+  }
+
+  memcpy(pLabel->Shown, pString, Len);
+  pLabel->Shown[Len] = '\0';
+  pLabel->Shown_Len = Len;
+  pLabel->Shown_X = Xpoint;
+  pLabel->Shown_Y = Ypoint;
+  pLabel->Shown_Font = Font;
+  pLabel->Shown_Background = pLabel->Color_Background;
+  pLabel->Shown_Foreground = pLabel->Color_Foreground;
+  pLabel->Valid = true;
+}
+
+/******************************************************************************
+  function:	Place a label; nothing is drawn until the first value
+  parameter:
+	Xstart, Ystart   : Top left of the box
+	Width, Height    : Size of the box
+	Font             : Font of the text
+	Color_Background : Background of the text (FONT_BACKGROUND: transparent)
+	Color_Foreground : Color of the text
+	Align            : LABEL_LEFT, LABEL_CENTER or LABEL_RIGHT in the box
+******************************************************************************/
+void GUI_LabelInit(GUI_LABEL *pLabel, POINT Xstart, POINT Ystart, LENGTH Width, LENGTH Height,
+                   sFONT* Font, COLOR Color_Background, COLOR Color_Foreground, LABEL_ALIGN Align)
+{
+  memset(pLabel, 0, sizeof(GUI_LABEL));
+  pLabel->Xstart = Xstart;
+  pLabel->Ystart = Ystart;
+  pLabel->Width = Width;
+  pLabel->Height = Height;
+  pLabel->Font = Font;
+  pLabel->Color_Background = Color_Background;
+  pLabel->Color_Foreground = Color_Foreground;
+  pLabel->Align = Align;
+}
+
+/******************************************************************************
+  function:	The screen no longer shows the last value
+******************************************************************************/
+void GUI_LabelInvalidate(GUI_LABEL *pLabel)
+{
+  pLabel->Valid = false;
+}
+
+/******************************************************************************
+  function:	Show a string, a number, or Nummber / 10^Decimals
+  parameter:
+	pSuffix : Appended to the number (a unit), or NULL
+******************************************************************************/
+void GUI_LabelString(GUI_LABEL *pLabel, const char *pString)
+{
+  size_t Len = strlen(pString);
+  GUI_LabelShow(pLabel, pString, Len > LABEL_MAX_LEN ? LABEL_MAX_LEN : (uint8_t)Len);
+}
+
+void GUI_LabelNum(GUI_LABEL *pLabel, int32_t Nummber, const char *pSuffix)
+{
+  GUI_LabelFixed(pLabel, Nummber, 0, pSuffix);
+}
+
+void GUI_LabelFixed(GUI_LABEL *pLabel, int32_t Nummber, uint8_t Decimals, const char *pSuffix)
+{
+  char Str_Array[LABEL_MAX_LEN + 1];
+  uint8_t Len = GUI_FormatFixed(Str_Array, Nummber, Decimals);
+
+  if (pSuffix != NULL) {
+    while (*pSuffix != '\0' && Len < LABEL_MAX_LEN)
+      Str_Array[Len++] = *pSuffix++;
+    Str_Array[Len] = '\0';
+  }
+  GUI_LabelShow(pLabel, Str_Array, Len);
+}
@@ -0,0 +1,167 @@
+/*****************************************************************************
+* | File      	:	LCD_TextBox.cpp
+* | Function    :	Word wrapped, aligned text clipped to a box
+* | Info        :   See LCD_TextBox.h
+******************************************************************************/
+#include "LCD_TextBox.h"
+#include <string.h>
+
+typedef struct {
+  uint16_t Start;
+  uint8_t Len;		//Trailing spaces left out
+} TEXTBOX_LINE;
+
+typedef struct {
+  uint32_t Hash;
+  uint16_t Len;
+  LENGTH Width;
+  sFONT *Font;		//NULL: free
+  uint32_t Used;	//Clock of the last lookup
+  uint8_t Count;
+  TEXTBOX_LINE Line[TEXTBOX_MAX_LINES];
+} TEXTBOX_ENTRY;
+
+static TEXTBOX_ENTRY TextBox_Cache[TEXTBOX_CACHE];
+static uint32_t TextBox_Clock, TextBox_Hits, TextBox_Misses;
+
+/******************************************************************************
+  function:	Break pString into lines of at most Width pixels
+******************************************************************************/
+static void GUI_TextBoxBreak(const char *pString, sFONT *Font, LENGTH Width, TEXTBOX_ENTRY *pEntry)
+{
+  //Whole characters per line; a character wider than the box still gets one
+  uint16_t Fit = Width / Font->Width;
+  if (Fit == 0)
+    Fit = 1;
+  if (Fit > TEXTBOX_MAX_LEN)
+    Fit = TEXTBOX_MAX_LEN;
+
+  uint16_t Pos = 0;
+  pEntry->Count = 0;
+  while (pString[Pos] != '\0' && pEntry->Count < TEXTBOX_MAX_LINES) {
+    uint16_t Start = Pos, Break_At = Start;
+    bool Wrapped = false;
+
+    //Take characters until one does not fit, remembering where the last word ended
+    while (pString[Pos] != '\0' && pString[Pos] != '\n') {
+      if (pString[Pos] == ' ' && Pos > Start && pString[Pos - 1] != ' ')
+        Break_At = Pos;
+      if (pString[Pos] != ' ' && Pos - Start >= Fit) {
+        Wrapped = true;
+        break;
+      }
+      Pos++;
+    }
+    if (Wrapped && Break_At > Start)
+      Pos = Break_At;
+
+    uint16_t End = Pos;
+    while (End > Start && pString[End - 1] == ' ')
+      End--;
+    if (End - Start > TEXTBOX_MAX_LEN)
+      End = Start + TEXTBOX_MAX_LEN;
+
+    TEXTBOX_LINE *pLine = &pEntry->Line[pEntry->Count++];
+    pLine->Start = Start;
+    pLine->Len = End - Start;
+
+    //The spaces a line was broken at are not shown
+    if (Wrapped)
+      while (pString[Pos] == ' ')
+        Pos++;
+    if (pString[Pos] == '\n')
+      Pos++;
+  }
+}
+
+/******************************************************************************
+  function:	Lines of pString in Width, from the cache when seen before
+******************************************************************************/
+static const TEXTBOX_ENTRY *GUI_TextBoxLayout(const char *pString, sFONT *Font, LENGTH Width)
+{
+  //FNV-1a; the length comes along
+  uint32_t Hash = 2166136261u;
+  uint16_t Len = 0;
+  for (const char *p = pString; *p != '\0'; p++, Len++) {
+    Hash ^= (uint8_t)*p;
+    Hash *= 16777619u;
+  }
+
+  TextBox_Clock++;
+  TEXTBOX_ENTRY *pOldest = &TextBox_Cache[0];
+  for (uint8_t i = 0; i < TEXTBOX_CACHE; i++) {
+    TEXTBOX_ENTRY *pEntry = &TextBox_Cache[i];
+    if (pEntry->Font == Font && pEntry->Hash == Hash && pEntry->Len == Len && pEntry->Width == Width) {
+      pEntry->Used = TextBox_Clock;
+      TextBox_Hits++;
+      return pEntry;
+    }
+    if (pEntry->Used < pOldest->Used)
+      pOldest = pEntry;
+  }
+
+  TextBox_Misses++;
+  pOldest->Hash = Hash;
+  pOldest->Len = Len;
+  pOldest->Width = Width;
+  pOldest->Font = Font;
+  pOldest->Used = TextBox_Clock;
+  GUI_TextBoxBreak(pString, Font, Width, pOldest);
+  return pOldest;
+}
+
+/******************************************************************************
+  function:	Show a string word wrapped in a box
+  parameter:
+	Xstart, Ystart   : Top left of the box
+	Width, Height    : Size of the box; lines below it are left out
+	pString          : Text; '\n' starts a new line
+	Font             : Font of the text
+	Color_Background : Background of the text (FONT_BACKGROUND: transparent)
+	Color_Foreground : Color of the text
+	Align            : LABEL_LEFT, LABEL_CENTER or LABEL_RIGHT in the box
+******************************************************************************/
+void GUI_DisString_Box(POINT Xstart, POINT Ystart, LENGTH Width, LENGTH Height,
+                       const char *pString, sFONT* Font,
+                       COLOR Color_Background, COLOR Color_Foreground, LABEL_ALIGN Align)
+{
+  const TEXTBOX_ENTRY *pEntry = GUI_TextBoxLayout(pString, Font, Width);
+
+  //Only whole lines are shown, as a block centered in the box
+  uint8_t Visible = pEntry->Count;
+  if (Visible > Height / Font->Height)
+    Visible = Height / Font->Height;
+  int32_t Ypoint = Ystart + (Height - Visible * Font->Height) / 2;
+
+  for (uint8_t i = 0; i < Visible; i++, Ypoint += Font->Height) {
+    const TEXTBOX_LINE *pLine = &pEntry->Line[i];
+    if (pLine->Len == 0)
+      continue;
+
+    int32_t Extent = pLine->Len * Font->Width;
+    int32_t Xpoint = Xstart;
+    if (Extent < Width) {
+      if (Align == LABEL_RIGHT)
+        Xpoint += Width - Extent;
+      else if (Align == LABEL_CENTER)
+        Xpoint += (Width - Extent) / 2;
+    }
+
+    char Str_Array[TEXTBOX_MAX_LEN + 1];
+    memcpy(Str_Array, pString + pLine->Start, pLine->Len);
+    Str_Array[pLine->Len] = '\0';
+    GUI_DisString_EN(Xpoint, Ypoint, Str_Array, Font, Color_Background, Color_Foreground);
+  }
+}
+
+void GUI_TextBoxStats(uint32_t *pHits, uint32_t *pMisses)
+{
+  *pHits = TextBox_Hits;
+  *pMisses = TextBox_Misses;
+}
+
+void GUI_TextBoxReset(void)
+{
+  TextBox_Hits = 0;
+  TextBox_Misses = 0;
+}
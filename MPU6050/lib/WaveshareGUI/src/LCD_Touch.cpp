@@ -19,6 +19,8 @@
 
 TP_DEV sTP_DEV;
 TP_DRAW sTP_Draw;
+static SPIBus::Device TP_Device = SPIBus::NO_DEVICE;  //Registered by TP_Init()
+
 /*******************************************************************************
   function:
         Read the ADC of X/Y coordinates
@@ -31,10 +33,9 @@ static TP_COORDINATE TP_Read_ADC(void)
   POINT Data = 0;
   TP_COORDINATE tp_xy;
 
-  SPI.endTransaction();                                                       //Release SPI Semaphore
-  SPI.beginTransaction(SPISettings(2 * 1000 * 1000, MSBFIRST, SPI_MODE0));    //Lower SPI clock
-
-  TP_CS_0;
+  //Waits out a panel fill still on the bus and switches to the touch clock
+  SPIBus& Bus = LCD_Panel().getBus();
+  Bus.select(TP_Device);
 
 //  ======  X Ordinate  ====================================================================================================
   SPI4W_Write_Byte(0xd0);           //0xd0: Read channel x +, select the ADC resolution is 12 bits, set to differential mode
@@ -56,10 +57,7 @@ static TP_COORDINATE TP_Read_ADC(void)
   Data >>= 3;//5bit
   tp_xy.Ypoint = Data;
 
-  TP_CS_1;
-
-  SPI.endTransaction();                                                       //Release SPI Semaphore
-  SPI.beginTransaction(SPISettings(8 * 1000 * 1000, MSBFIRST, SPI_MODE0));    //Restore SPI clock
+  Bus.deselect(TP_Device);
 
   return tp_xy;
 }
@@ -271,7 +269,9 @@ static void TP_GetAdFac(void)
 *******************************************************************************/
 void TP_Init(void)
 {
-  TP_CS_1;
+  //CS is set up by the bus
+  if (TP_Device == SPIBus::NO_DEVICE)
+    TP_Device = LCD_Panel().getBus().addDevice(TP_CS, SPISettings(TOUCH_SPI_CLOCK, MSBFIRST, SPI_MODE0));
 
   sTP_DEV.TP_Scan_Dir =  sLCD_DIS.LCD_Scan_Dir;
   // TP_Read_ADC_XY(sTP_DEV.Xpoint, sTP_DEV.Ypoint);
@@ -73,7 +73,7 @@ size_t BmpMF::BmpMFread(unsigned char *data, size_t len)
 
   int16_t currRecLen = RdRec->len - RdOffset;
     //If current record has enough data to retrieve
-  if (currRecLen > len) {
+  if ((size_t)currRecLen > len) {
     memmove(data, RdRec->record+RdOffset, len);
     RdOffset += len;
     return len;
@@ -103,7 +103,7 @@ void BmpMF::BmpMFseek(size_t pos, enum _mode mode)
     BmpMFrewind();
   int16_t currRecLen = RdRec->len - RdOffset;
     //If current record has enough data to retrieve
-  if (currRecLen > pos) {
+  if ((size_t)currRecLen > pos) {
     RdOffset += pos;
     return;
   }
@@ -199,7 +199,7 @@ void dump_bmp(char *fileName)
     if (BMPhdr.ColorsUsed) {
         bmpFile.seek(14+40);                                 //Skip Headers to Color Pallette
         bmpFile.readBytes((char*)LUT, BMPhdr.ColorsUsed*4);
-        for (int i=0 ; i<BMPhdr.ColorsUsed; ++i)
+        for (uint32_t i=0 ; i<BMPhdr.ColorsUsed; ++i)
             ARGB_Format &= (LUT[i]>>24)==0xFF;
         Serial.printf("Using a color palette Format: %s\n", ARGB_Format ? "ARGB":"BGR0");
     }
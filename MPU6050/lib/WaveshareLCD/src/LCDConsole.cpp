@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * | File        : LCDConsole.cpp
+ * | Function    : Scrolling text console on the panel
+ *****************************************************************************/
+
+#include "LCDConsole.h"
+#include <stdlib.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+LCDConsole::LCDConsole(WaveshareLCD& lcd)
+    : _lcd(lcd), _font(&Font16), _fgColor(Colors::WHITE), _bgColor(Colors::BLACK),
+      _top(0), _cols(0), _lines(0), _hardware(false),
+      _text(nullptr), _lengths(nullptr), _first(0), _row(0), _col(0) {
+}
+
+LCDConsole::~LCDConsole() {
+    end();
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+bool LCDConsole::begin(POINT top, LENGTH height, sFONT* font,
+                       COLOR fgColor, COLOR bgColor) {
+    end();
+    if (font == nullptr || top >= _lcd.getHeight()) return false;
+    if (height > _lcd.getHeight() - top) height = _lcd.getHeight() - top;
+
+    LENGTH lines = height / font->Height;
+    LENGTH cols = _lcd.getWidth() / font->Width;
+    if (lines == 0 || cols == 0) return false;
+
+    _text = (char*)malloc((size_t)lines * cols);
+    _lengths = (uint16_t*)malloc(lines * sizeof(uint16_t));
+    if (_text == nullptr || _lengths == nullptr) {
+        free(_text);
+        free(_lengths);
+        _text = nullptr;
+        _lengths = nullptr;
+        return false;
+    }
+
+    _font = font;
+    _fgColor = fgColor;
+    _bgColor = bgColor;
+    _top = top;
+    _cols = cols;
+    _lines = lines;
+
+    // The scroll area covers whole lines; leftover rows stay fixed below
+    _hardware = _lcd.isScrollVertical();
+    if (_hardware) {
+        POINT end = top + lines * font->Height;
+        _lcd.setScrollArea(top, WaveshareLCD::SCROLL_LINES - end);
+    }
+
+    clear();
+    return true;
+}
+
+void LCDConsole::end() {
+    if (_text == nullptr) return;
+
+    if (_hardware) _lcd.endScroll();
+    free(_text);
+    free(_lengths);
+    _text = nullptr;
+    _lengths = nullptr;
+    _hardware = false;
+}
+
+POINT LCDConsole::rowTop(uint16_t row) const {
+    // In hardware mode a display line sits wherever its text line was
+    // drawn; the scroll start rotates it into place
+    uint16_t line = _hardware ? lineAt(row) : row;
+    return _top + line * _font->Height;
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+
+void LCDConsole::clear() {
+    if (_text == nullptr) return;
+
+    memset(_lengths, 0, _lines * sizeof(uint16_t));
+    _first = 0;
+    _row = 0;
+    _col = 0;
+
+    _lcd.fillArea(0, _top, _lcd.getWidth(), _top + _lines * _font->Height, _bgColor);
+    if (_hardware) _lcd.scrollTo(_top);
+}
+
+size_t LCDConsole::write(uint8_t ch) {
+    if (_text == nullptr) return 0;
+
+    putChar((char)ch);
+    return 1;
+}
+
+size_t LCDConsole::write(const uint8_t* buffer, size_t size) {
+    if (_text == nullptr) return 0;
+
+    _lcd.beginWrite();
+    for (size_t i = 0; i < size; i++) {
+        putChar((char)buffer[i]);
+    }
+    _lcd.endWrite();
+    return size;
+}
+
+void LCDConsole::putChar(char ch) {
+    if (ch == '\r') return;
+    if (ch == '\n') {
+        newLine();
+        return;
+    }
+    if (_col == _cols) newLine();
+
+    uint16_t line = lineAt(_row);
+    _text[line * _cols + _col] = ch;
+    _lengths[line] = _col + 1;
+
+    // Drawn right away, so a line shows up as it is printed
+    _lcd.drawChar(_col * _font->Width + 1, rowTop(_row) + 1, ch,
+                  _font, _bgColor, _fgColor);
+    _col++;
+}
+
+void LCDConsole::newLine() {
+    _col = 0;
+    if (_row + 1 < _lines) {
+        _row++;
+    } else {
+        scroll();
+    }
+}
+
+void LCDConsole::scroll() {
+    // The oldest line is reused as the new bottom line
+    uint16_t oldest = _first;
+    _lengths[oldest] = 0;
+    _first = (_first + 1) % _lines;
+
+    if (_hardware) {
+        POINT y = _top + oldest * _font->Height;
+        _lcd.beginWrite();
+        _lcd.fillArea(0, y, _lcd.getWidth(), y + _font->Height, _bgColor);
+        _lcd.scrollTo(_top + _first * _font->Height);
+        _lcd.endWrite();
+        return;
+    }
+
+    _lcd.beginWrite();
+    for (uint16_t row = 0; row < _lines; row++) {
+        redrawLine(row);
+    }
+    _lcd.endWrite();
+}
+
+void LCDConsole::redrawLine(uint16_t row) {
+    uint16_t line = lineAt(row);
+    POINT y = rowTop(row);
+    const char* text = _text + line * _cols;
+
+    // Opaque glyphs cover their own cells; only the rest of the line is
+    // cleared. A white background draws transparent, so it clears it all.
+    POINT clearFrom = (_bgColor == FONT_BACKGROUND) ? 0 : _lengths[line] * _font->Width;
+    _lcd.fillArea(clearFrom, y, _lcd.getWidth(), y + _font->Height, _bgColor);
+    for (uint16_t col = 0; col < _lengths[line]; col++) {
+        _lcd.drawChar(col * _font->Width + 1, y + 1, text[col],
+                      _font, _bgColor, _fgColor);
+    }
+}
@@ -0,0 +1,102 @@
+/*****************************************************************************
+ * | File        : LCDGpio.h
+ * | Function    : Control lines driven through the ESP32 GPIO registers
+ * | Info        : One register store per edge instead of digitalWrite()
+ * |
+ * | digitalWrite() looks the pin up and checks it on every call, and the
+ * | panel toggles D/C around every command. The ESP32 has write-1-to-set
+ * | and write-1-to-clear registers for its outputs (GPIO.out_w1ts/w1tc for
+ * | pins 0-31, out1_w1ts/w1tc above), so a line changes with one store.
+ * |
+ * |   LCDGpioPin dc;
+ * |   dc.begin(17);                        // pinMode() and register lookup
+ * |   dc.low();                            // GPIO.out_w1tc = 1 << 17
+ * |
+ * | The register and the mask are found once, in begin(); an edge is then
+ * | two loads and a store. A pin fixed at compile time would save nothing:
+ * | on the Xtensa core a register address and a mask that do not fit an
+ * | immediate are loads as well.
+ * |
+ * | Host builds have no GPIO registers and fall back to digitalWrite().
+ *****************************************************************************/
+
+#ifndef __LCD_GPIO_H
+#define __LCD_GPIO_H
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include <soc/gpio_struct.h>
+#endif
+
+// GPIO 34-39 are inputs only, and there is no GPIO above 39
+#define LCD_GPIO_IS_PIN(pin)    ((pin) < 40)
+#define LCD_GPIO_IS_OUTPUT(pin) ((pin) < 34)
+
+class LCDGpioPin {
+public:
+    static constexpr uint8_t NO_PIN = 0xFF;
+
+    LCDGpioPin() : _pin(NO_PIN) {
+#if defined(ESP32)
+        _set = &GPIO.out_w1ts;
+        _clear = &GPIO.out_w1tc;
+        _in = &GPIO.in;
+        _out = &GPIO.out;
+        _mask = 0;                  // Stores of 0 change nothing
+#endif
+    }
+
+    // Set the pin up and find its registers. An output is driven to
+    // 'level' before it starts driving.
+    void begin(uint8_t pin, uint8_t mode = OUTPUT, uint8_t level = HIGH) {
+        _pin = pin;
+        if (pin == NO_PIN || !LCD_GPIO_IS_PIN(pin)) return;
+#if defined(ESP32)
+        bool high = pin >= 32;
+        _set = high ? &GPIO.out1_w1ts.val : &GPIO.out_w1ts;
+        _clear = high ? &GPIO.out1_w1tc.val : &GPIO.out_w1tc;
+        _in = high ? &GPIO.in1.val : &GPIO.in;
+        _out = high ? &GPIO.out1.val : &GPIO.out;
+        _mask = 1UL << (pin & 31);
+#endif
+        if (mode == OUTPUT) {
+            write(level);
+        }
+        pinMode(pin, mode);
+    }
+
+    uint8_t getPin() const { return _pin; }
+
+#if defined(ESP32)
+    inline void high() const { *_set = _mask; }
+    inline void low() const { *_clear = _mask; }
+    inline bool read() const { return (*_in & _mask) != 0; }
+    inline bool isDrivenHigh() const { return (*_out & _mask) != 0; }
+#else
+    inline void high() const { if (_pin != NO_PIN) digitalWrite(_pin, HIGH); }
+    inline void low() const { if (_pin != NO_PIN) digitalWrite(_pin, LOW); }
+    inline bool read() const { return _pin != NO_PIN && digitalRead(_pin) == HIGH; }
+    inline bool isDrivenHigh() const { return read(); }
+#endif
+
+    inline void write(uint8_t level) const {
+        if (level) {
+            high();
+        } else {
+            low();
+        }
+    }
+
+private:
+    uint8_t _pin;
+#if defined(ESP32)
+    volatile uint32_t* _set;
+    volatile uint32_t* _clear;
+    const volatile uint32_t* _in;
+    const volatile uint32_t* _out;      // Output latch: an output's level
+    uint32_t _mask;
+#endif
+};
+
+#endif // __LCD_GPIO_H
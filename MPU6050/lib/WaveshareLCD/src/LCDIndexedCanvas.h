@@ -0,0 +1,134 @@
+/*****************************************************************************
+ * | File        : LCDIndexedCanvas.h
+ * | Function    : Off-screen drawing surface with 4-bit palette colors
+ * | Info        : A whole 480x320 frame in 75 KB of internal RAM
+ * |
+ * | An RGB565 frame is 300 KB; the screens here use a dozen colors. This
+ * | canvas keeps an index into a 16-color palette for every pixel, two
+ * | pixels a byte, so a full frame fits next to the rest of the app and
+ * | a screen can be drawn completely before any of it is shown.
+ * |
+ * | Usage:
+ * |   LCDIndexedCanvas frame(480, 320);    // 75 KB from the heap
+ * |   frame.clear(Colors::BLACK);
+ * |   frame.drawString(10, 10, "42", &Font24, Colors::BLACK, Colors::WHITE);
+ * |   frame.flush(lcd, 0, 0);              // the changed rows
+ * |
+ * |   frame.setPaletteColor(3, Colors::RED);   // Rows using entry 3 redrawn
+ * |   frame.flush(lcd, 0, 0);
+ * |
+ * | Every LCDSurface primitive works with plain colors. A color that is in
+ * | the palette draws as its entry; any other as the nearest one. The
+ * | default palette holds the twelve different Colors:: values, then four
+ * | blacks to be replaced with setPaletteColor().
+ * |
+ * | The canvas keeps which rows changed and which palette entries each row
+ * | uses. flush() sends every run of changed rows as one window, full
+ * | width. The panel driver expands the indices through the palette into
+ * | its DMA line buffers on the way out, so no RGB565 copy of the frame is
+ * | ever made. Changing a palette entry is a 32-byte table update that
+ * | marks just the rows using it: flashing one color on a screen costs a
+ * | flush of those rows.
+ * |
+ * | The panel may still be reading the buffer and the palette after flush()
+ * | returns. The canvas waits for it before either changes.
+ *****************************************************************************/
+
+#ifndef __LCD_INDEXED_CANVAS_H
+#define __LCD_INDEXED_CANVAS_H
+
+#include <stdint.h>
+#include "LCDSurface.h"
+
+class LCDIndexedCanvas : public LCDSurface {
+public:
+    static constexpr uint8_t PALETTE_SIZE = 16;
+    static constexpr LENGTH MAX_HEIGHT = LCD_X_MAXPIXEL;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+    LCDIndexedCanvas();
+    LCDIndexedCanvas(LENGTH width, LENGTH height, uint8_t* buffer = nullptr);
+    ~LCDIndexedCanvas();
+
+    LCDIndexedCanvas(const LCDIndexedCanvas&) = delete;
+    LCDIndexedCanvas& operator=(const LCDIndexedCanvas&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Use 'buffer' (getRowBytes() * height bytes) or allocate one when it is
+    // nullptr. Returns false if the allocation failed or height is over
+    // MAX_HEIGHT. The frame starts as palette entry 0 and dirty.
+    bool begin(LENGTH width, LENGTH height, uint8_t* buffer = nullptr);
+    void end();
+
+    bool isReady() const { return _buffer != nullptr; }
+    uint8_t* getBuffer() { return _buffer; }
+    uint32_t getRowBytes() const { return ((uint32_t)_info.width + 1) / 2; }
+
+    //--------------------------------------------------------------------------
+    // Palette
+    //--------------------------------------------------------------------------
+    void setPalette(const COLOR* colors, uint8_t count);
+    void setPaletteColor(uint8_t index, COLOR color);
+    COLOR getPaletteColor(uint8_t index) const { return _palette[index & 0x0F]; }
+
+    // The entry 'color' draws as: the first equal one, or the nearest
+    uint8_t findColor(COLOR color);
+
+    //--------------------------------------------------------------------------
+    // Pixel sink
+    //--------------------------------------------------------------------------
+    void setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) override;
+    void setPixel(POINT x, POINT y, COLOR color) override;
+    void fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) override;
+    void pushPixels(const COLOR* pixels, uint32_t count, bool swapped = false) override;
+
+    // Wait until the last flush target is done with the buffer
+    void waitIdle() override;
+
+    //--------------------------------------------------------------------------
+    // Dirty rows
+    //--------------------------------------------------------------------------
+    bool isDirty() const;
+    bool isRowDirty(POINT y) const { return (_dirtyRows[y >> 5] >> (y & 31)) & 1; }
+    void markDirty();
+    void markDirty(POINT yStart, POINT yEnd);
+    void clearDirty();
+
+    //--------------------------------------------------------------------------
+    // Output
+    //--------------------------------------------------------------------------
+    // Send the dirty rows to 'target', with the canvas origin at (x, y),
+    // and clear them
+    void flush(LCDSurface& target, POINT x, POINT y);
+
+private:
+    uint8_t* _buffer;
+    bool _ownsBuffer;
+    LCDSurface* _reader;            // Last flush target, may still be sending
+
+    COLOR _palette[PALETTE_SIZE];
+    // Both pixels of every index byte in wire order, what flush() sends
+    uint32_t _pairs[256];
+    // Last color findColor() looked up
+    COLOR _lastColor;
+    uint8_t _lastIndex;
+
+    uint32_t _dirtyRows[(MAX_HEIGHT + 31) / 32];
+    // Palette entries each row has been drawn with since its last full fill
+    uint16_t _rowEntries[MAX_HEIGHT];
+
+    // Window opened by setWindow(); may extend past the buffer
+    int32_t _winX0, _winY0, _winX1, _winY1;
+    int32_t _curX, _curY;
+
+    uint8_t* rowAt(POINT y) { return _buffer + y * getRowBytes(); }
+    void writeIndex(POINT x, POINT y, uint8_t index);
+    void fillRow(POINT y, POINT xStart, POINT xEnd, uint8_t index);
+    void updatePairs(uint8_t index);
+};
+
+#endif // __LCD_INDEXED_CANVAS_H
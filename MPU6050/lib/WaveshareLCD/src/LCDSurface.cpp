@@ -0,0 +1,894 @@
+/*****************************************************************************
+ * | File        : LCDSurface.cpp
+ * | Function    : Drawing primitives shared by the panel and RAM canvases
+ *****************************************************************************/
+
+#include "LCDSurface.h"
+#include "LCDFont.h"
+#include "LCDFormat.h"
+#include <Arduino.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Constructor
+//------------------------------------------------------------------------------
+
+LCDSurface::LCDSurface()
+    : _info{0}, _stageCount(0), _glyphCache(nullptr) {
+}
+
+//------------------------------------------------------------------------------
+// Screen control
+//------------------------------------------------------------------------------
+
+void LCDSurface::clear(COLOR color) {
+    fillArea(0, 0, _info.width, _info.height, color);
+}
+
+//------------------------------------------------------------------------------
+// Bulk pixel transfer
+//------------------------------------------------------------------------------
+
+void LCDSurface::flushStage() {
+    if (_stageCount > 0) {
+        pushPixels(_stage, _stageCount);
+        _stageCount = 0;
+    }
+}
+
+void LCDSurface::pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs) {
+    if (indices == nullptr || pairs == nullptr) return;
+
+    // Under ASYNC_MIN_PIXELS like the staging buffer, so 'chunk' can be reused
+    COLOR chunk[STAGE_PIXELS];
+    while (count > 0) {
+        uint32_t n = (count < STAGE_PIXELS) ? count : STAGE_PIXELS;
+        for (uint32_t i = 0; i < n; i += 2) memcpy(chunk + i, &pairs[indices[i / 2]], 4);
+        pushPixels(chunk, n, true);
+        indices += n / 2;
+        count -= n;
+    }
+}
+
+void LCDSurface::blit(POINT x, POINT y, LENGTH width, LENGTH height,
+                      const COLOR* pixels, bool swapped) {
+    blitSubRect(x, y, width, height, pixels, width, swapped);
+}
+
+void LCDSurface::blitSubRect(POINT x, POINT y, LENGTH width, LENGTH height,
+                             const COLOR* pixels, LENGTH stride, bool swapped) {
+    if (pixels == nullptr || x >= _info.width || y >= _info.height) {
+        return;
+    }
+
+    LENGTH w = (x + width > _info.width) ? _info.width - x : width;
+    LENGTH h = (y + height > _info.height) ? _info.height - y : height;
+    if (w == 0 || h == 0) return;
+
+    beginWrite();
+    setWindow(x, y, x + w, y + h);
+    if (w == stride) {
+        pushPixels(pixels, (uint32_t)w * h, swapped);
+    } else {
+        for (LENGTH row = 0; row < h; row++) {
+            pushPixels(pixels + (uint32_t)row * stride, w, swapped);
+        }
+    }
+    endWrite();
+}
+
+//------------------------------------------------------------------------------
+// Drawing primitives
+//------------------------------------------------------------------------------
+
+void LCDSurface::swapPoints(POINT& p1, POINT& p2) {
+    POINT temp = p1;
+    p1 = p2;
+    p2 = temp;
+}
+
+void LCDSurface::drawPoint(POINT x, POINT y, COLOR color,
+                            DotPixel dotSize, DotStyle dotStyle) {
+    if (x > _info.width || y > _info.height) {
+        return;
+    }
+
+    // The dot is a square: (2*size-1) wide centred one pixel up/left of
+    // (x, y) for FILL_AROUND, size wide from (x-1, y-1) otherwise
+    int32_t size = static_cast<uint8_t>(dotSize);
+    int32_t x0, y0, x1, y1;
+    if (dotStyle == DotStyle::FILL_AROUND) {
+        x0 = (int32_t)x - size;
+        y0 = (int32_t)y - size;
+        x1 = (int32_t)x + size - 1;
+        y1 = (int32_t)y + size - 1;
+    } else {
+        x0 = (int32_t)x - 1;
+        y0 = (int32_t)y - 1;
+        x1 = x0 + size;
+        y1 = y0 + size;
+    }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+
+    if (x1 - x0 == 1 && y1 - y0 == 1) {
+        setPixel(x0, y0, color);
+        return;
+    }
+    if (x1 > _info.width) x1 = _info.width;
+    if (y1 > _info.height) y1 = _info.height;
+    fillArea(x0, y0, x1, y1, color);
+}
+
+void LCDSurface::drawHorizontalLine(POINT xStart, POINT xEnd, POINT y,
+                                     COLOR color, LineStyle style,
+                                     DotPixel dotSize) {
+    uint8_t size = static_cast<uint8_t>(dotSize);
+    if (style == LineStyle::SOLID) {
+        fillArea(xStart, y, xEnd, y + size, color);
+    } else {
+        POINT x;
+        for (x = xStart; x <= xEnd - size; x += 2 * size) {
+            fillArea(x, y, x + size, y + size, color);
+        }
+        if (x < xEnd) {
+            fillArea(x, y, xEnd, y + size, color);
+        }
+    }
+}
+
+void LCDSurface::drawVerticalLine(POINT x, POINT yStart, POINT yEnd,
+                                   COLOR color, LineStyle style,
+                                   DotPixel dotSize) {
+    uint8_t size = static_cast<uint8_t>(dotSize);
+    if (style == LineStyle::SOLID) {
+        fillArea(x, yStart, x + size, yEnd, color);
+    } else {
+        POINT y;
+        for (y = yStart; y <= yEnd - size; y += 2 * size) {
+            fillArea(x, y, x + size, y + size, color);
+        }
+        if (y < yEnd) {
+            fillArea(x, y, x + size, yEnd, color);
+        }
+    }
+}
+
+void LCDSurface::drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                           COLOR color, LineStyle lineStyle, DotPixel dotSize) {
+    if (xStart > _info.width || yStart > _info.height ||
+        xEnd > _info.width || yEnd > _info.height) {
+        return;
+    }
+
+    beginWrite();
+
+    if (yStart == yEnd) {
+        if (xStart > xEnd) swapPoints(xStart, xEnd);
+        drawHorizontalLine(xStart, xEnd, yStart, color, lineStyle, dotSize);
+        endWrite();
+        return;
+    }
+
+    if (xStart == xEnd) {
+        if (yStart > yEnd) swapPoints(yStart, yEnd);
+        drawVerticalLine(xStart, yStart, yEnd, color, lineStyle, dotSize);
+        endWrite();
+        return;
+    }
+
+    // Walk diagonal lines downwards; the endpoints are swapped as a pair
+    // so lines rising to the right keep their direction
+    if (yStart > yEnd) {
+        swapPoints(xStart, xEnd);
+        swapPoints(yStart, yEnd);
+    }
+
+    if (lineStyle == LineStyle::SOLID) {
+        drawThickLine(xStart, yStart, xEnd, yEnd, color, dotSize);
+        endWrite();
+        return;
+    }
+
+    // Bresenham's line algorithm, one dot per step
+    POINT xPoint = xStart;
+    POINT yPoint = yStart;
+    int dx = (int)xEnd - (int)xStart >= 0 ? xEnd - xStart : xStart - xEnd;
+    int dy = (int)yEnd - (int)yStart <= 0 ? yEnd - yStart : yStart - yEnd;
+
+    int xAddWay = xStart < xEnd ? 1 : -1;
+    int yAddWay = yStart < yEnd ? 1 : -1;
+
+    int esp = dx + dy;
+    char lineStyleTemp = 0;
+
+    for (;;) {
+        lineStyleTemp++;
+        if (lineStyle == LineStyle::DOTTED && lineStyleTemp % 3 == 0) {
+            drawPoint(xPoint, yPoint, LCD_BACKGROUND, dotSize, DOT_STYLE_DEFAULT);
+            lineStyleTemp = 0;
+        } else {
+            drawPoint(xPoint, yPoint, color, dotSize, DOT_STYLE_DEFAULT);
+        }
+
+        if (2 * esp >= dy) {
+            if (xPoint == xEnd) break;
+            esp += dy;
+            xPoint += xAddWay;
+        }
+        if (2 * esp <= dx) {
+            if (yPoint == yEnd) break;
+            esp += dx;
+            yPoint += yAddWay;
+        }
+    }
+
+    endWrite();
+}
+
+// A thick solid line is the union of the dotSize squares drawPoint() would
+// paint at each Bresenham step. The path moves at most one pixel per step
+// and is monotonic, so every screen row of that union is one span: from
+// the leftmost to the rightmost square whose rows cover it. Only the
+// x-extent of the last (2 * size - 1) path rows is needed to produce it.
+
+void LCDSurface::drawThickLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                               COLOR color, DotPixel dotSize) {
+    int32_t size = static_cast<uint8_t>(dotSize);
+    StrokeRows rows;
+    rows.size = size;
+    rows.color = color;
+    rows.rightward = xEnd >= xStart;
+    rows.first = yStart;
+    rows.last = yStart - 1;
+
+    int32_t dx = (xEnd >= xStart) ? xEnd - xStart : xStart - xEnd;
+    int32_t dy = (int32_t)yStart - (int32_t)yEnd;
+    int32_t xAddWay = rows.rightward ? 1 : -1;
+    int32_t esp = dx + dy;
+    int32_t x = xStart, y = yStart;
+    int32_t lo = x, hi = x;
+
+    for (;;) {
+        if (x < lo) lo = x;
+        if (x > hi) hi = x;
+
+        if (2 * esp >= dy) {
+            if (x == xEnd) break;
+            esp += dy;
+            x += xAddWay;
+        }
+        if (2 * esp <= dx) {
+            if (y == yEnd) break;
+            esp += dx;
+            // Path row y is complete: the screen row 'size' above it
+            // has now seen every square that reaches it
+            pushStrokeRow(rows, lo, hi);
+            drawStrokeRow(rows, y - size);
+            y++;
+            lo = hi = x;
+        }
+    }
+
+    pushStrokeRow(rows, lo, hi);
+    for (int32_t r = y - size; r <= y + size - 2; r++) {
+        drawStrokeRow(rows, r);
+    }
+}
+
+void LCDSurface::pushStrokeRow(StrokeRows& rows, int32_t lo, int32_t hi) {
+    rows.last++;
+    uint8_t slot = (rows.last - rows.first) % (2 * rows.size - 1);
+    rows.lo[slot] = lo;
+    rows.hi[slot] = hi;
+}
+
+void LCDSurface::drawStrokeRow(const StrokeRows& rows, int32_t row) {
+    if (row < 0 || row >= _info.height) return;
+
+    // Path rows whose squares cover this screen row
+    int32_t first = row - rows.size + 2;
+    int32_t last = row + rows.size;
+    if (first < rows.first) first = rows.first;
+    if (last > rows.last) last = rows.last;
+    if (first > last) return;
+
+    uint8_t ring = 2 * rows.size - 1;
+    uint8_t firstSlot = (first - rows.first) % ring;
+    uint8_t lastSlot = (last - rows.first) % ring;
+    int32_t lo = rows.rightward ? rows.lo[firstSlot] : rows.lo[lastSlot];
+    int32_t hi = rows.rightward ? rows.hi[lastSlot] : rows.hi[firstSlot];
+
+    int32_t xs = lo - rows.size;
+    int32_t xe = hi + rows.size - 1;
+    if (xs < 0) xs = 0;
+    if (xe > _info.width) xe = _info.width;
+    if (xe > xs) {
+        fillArea(xs, row, xe, row + 1, rows.color);
+    }
+}
+
+// Wu's algorithm in 16.16 fixed point. Each step along the major axis
+// covers two pixels across the line, weighted by the fractional position.
+// Steps that share the same pixel pair position go out through one
+// two-pixel-wide window.
+
+static inline COLOR blendColor(COLOR fg, COLOR bg, uint8_t alpha) {
+    uint32_t a = alpha + (alpha >> 7);          // 0..256
+    uint32_t r = ((fg >> 11) * a + (bg >> 11) * (256 - a)) >> 8;
+    uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (256 - a)) >> 8;
+    uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (256 - a)) >> 8;
+    return (COLOR)((r << 11) | (g << 5) | b);
+}
+
+void LCDSurface::drawLineAA(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                             COLOR color, COLOR bgColor) {
+    if (xStart > _info.width || yStart > _info.height ||
+        xEnd > _info.width || yEnd > _info.height) {
+        return;
+    }
+    if (xStart == xEnd || yStart == yEnd) {
+        drawLine(xStart, yStart, xEnd, yEnd, color);
+        return;
+    }
+
+    int32_t dx = (int32_t)xEnd - xStart;
+    int32_t dy = (int32_t)yEnd - yStart;
+    bool steep = (dy < 0 ? -dy : dy) > (dx < 0 ? -dx : dx);
+
+    // Major axis 'm' always increases; 'n' is the minor axis
+    int32_t m0, m1, n0, n1;
+    if (steep) {
+        m0 = yStart; m1 = yEnd; n0 = xStart; n1 = xEnd;
+    } else {
+        m0 = xStart; m1 = xEnd; n0 = yStart; n1 = yEnd;
+    }
+    if (m0 > m1) {
+        int32_t t = m0; m0 = m1; m1 = t;
+        t = n0; n0 = n1; n1 = t;
+    }
+
+    int32_t gradient = ((n1 - n0) << 16) / (m1 - m0);
+    int32_t inter = n0 << 16;
+
+    beginWrite();
+    int32_t m = m0;
+    while (m <= m1) {
+        // Gather the steps that stay on the same pixel pair
+        int32_t pair = inter >> 16;
+        int32_t count = 0;
+        COLOR lead[STAGE_PIXELS / 2], trail[STAGE_PIXELS / 2];
+        while (m + count <= m1 && count < STAGE_PIXELS / 2 && (inter >> 16) == pair) {
+            uint8_t frac = (uint8_t)(inter >> 8);
+            lead[count] = blendColor(color, bgColor, 255 - frac);
+            trail[count] = blendColor(color, bgColor, frac);
+            inter += gradient;
+            count++;
+        }
+        drawAAPairs(steep, m, pair, count, lead, trail);
+        m += count;
+    }
+    endWrite();
+}
+
+void LCDSurface::drawAAPairs(bool steep, int32_t m, int32_t n, int32_t count,
+                             const COLOR* lead, const COLOR* trail) {
+    // Same one-pixel offset as the solid line's 1x1 drawPoint()
+    int32_t x = (steep ? n : m) - 1;
+    int32_t y = (steep ? m : n) - 1;
+    int32_t w = steep ? 2 : count;
+    int32_t h = steep ? count : 2;
+
+    if (x >= 0 && y >= 0 && x + w <= _info.width && y + h <= _info.height) {
+        setWindow(x, y, x + w, y + h);
+        if (steep) {
+            for (int32_t i = 0; i < count; i++) {
+                stagePixel(lead[i]);
+                stagePixel(trail[i]);
+            }
+            flushStage();
+        } else {
+            pushPixels(lead, count);
+            pushPixels(trail, count);
+        }
+        return;
+    }
+
+    // At the screen edge: pixel by pixel, dropping what is off screen
+    for (int32_t i = 0; i < count; i++) {
+        for (int32_t k = 0; k < 2; k++) {
+            int32_t px = steep ? x + k : x + i;
+            int32_t py = steep ? y + i : y + k;
+            if (px >= 0 && py >= 0 && px < _info.width && py < _info.height) {
+                setPixel(px, py, k ? trail[i] : lead[i]);
+            }
+        }
+    }
+}
+
+void LCDSurface::drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                                COLOR color, DrawFill fill,
+                                DotPixel dotSize, LineStyle lineStyle) {
+    if (xStart > _info.width || yStart > _info.height ||
+        xEnd > _info.width || yEnd > _info.height) {
+        return;
+    }
+
+    if (xStart > xEnd) swapPoints(xStart, xEnd);
+    if (yStart > yEnd) swapPoints(yStart, yEnd);
+
+    uint8_t size = static_cast<uint8_t>(dotSize);
+
+    beginWrite();
+    if (fill == DrawFill::FULL) {
+        fillArea(xStart, yStart, xEnd, yEnd, color);
+    } else {
+        drawLine(xStart, yStart, xEnd + size, yStart, color, lineStyle, dotSize);
+        drawLine(xStart, yStart, xStart, yEnd + size, color, lineStyle, dotSize);
+        drawLine(xEnd, yEnd + size, xEnd, yStart, color, lineStyle, dotSize);
+        drawLine(xEnd + size, yEnd, xStart, yEnd, color, lineStyle, dotSize);
+    }
+    endWrite();
+}
+
+void LCDSurface::drawSpan(int32_t xLeft, int32_t xRight, int32_t y, COLOR color) {
+    // Same clipping and one-pixel offset as a 1x1 drawPoint()
+    if (y < 1 || y > _info.height) return;
+    if (xLeft < 1) xLeft = 1;
+    if (xRight > _info.width) xRight = _info.width;
+    if (xRight < xLeft) return;
+    fillArea(xLeft - 1, y - 1, xRight, y, color);
+}
+
+void LCDSurface::drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                             COLOR color, DrawFill fill, DotPixel dotSize) {
+    if (xCenter > _info.width || yCenter >= _info.height) {
+        return;
+    }
+
+    int32_t xCurrent = 0;
+    int32_t yCurrent = radius;
+    int32_t esp = 3 - ((int32_t)radius << 1);
+
+    beginWrite();
+    if (fill == DrawFill::FULL) {
+        // Midpoint circle, one span per row: rows +-x are as wide as the
+        // current y, and rows +-y are emitted once, at the widest x they reach
+        while (xCurrent <= yCurrent) {
+            drawSpan(xCenter - yCurrent, xCenter + yCurrent, yCenter + xCurrent, color);
+            if (xCurrent != 0) {
+                drawSpan(xCenter - yCurrent, xCenter + yCurrent, yCenter - xCurrent, color);
+            }
+            if (esp < 0) {
+                esp += 4 * xCurrent + 6;
+            } else {
+                if (yCurrent > xCurrent) {
+                    drawSpan(xCenter - xCurrent, xCenter + xCurrent, yCenter + yCurrent, color);
+                    drawSpan(xCenter - xCurrent, xCenter + xCurrent, yCenter - yCurrent, color);
+                }
+                esp += 10 + 4 * (xCurrent - yCurrent);
+                yCurrent--;
+            }
+            xCurrent++;
+        }
+    } else {
+        while (xCurrent <= yCurrent) {
+            drawPoint(xCenter + xCurrent, yCenter + yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter - xCurrent, yCenter + yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter - yCurrent, yCenter + xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter - yCurrent, yCenter - xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter - xCurrent, yCenter - yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter + xCurrent, yCenter - yCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter + yCurrent, yCenter - xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+            drawPoint(xCenter + yCurrent, yCenter + xCurrent, color, dotSize, DOT_STYLE_DEFAULT);
+
+            if (esp < 0) {
+                esp += 4 * xCurrent + 6;
+            } else {
+                esp += 10 + 4 * (xCurrent - yCurrent);
+                yCurrent--;
+            }
+            xCurrent++;
+        }
+    }
+    endWrite();
+}
+
+void LCDSurface::drawEllipse(POINT xCenter, POINT yCenter, LENGTH xRadius, LENGTH yRadius,
+                              COLOR color, DrawFill fill, DotPixel dotSize) {
+    if (xCenter > _info.width || yCenter >= _info.height) {
+        return;
+    }
+
+    // Midpoint ellipse; the decision terms outgrow 32 bits for large radii
+    int64_t rx2 = (int64_t)xRadius * xRadius;
+    int64_t ry2 = (int64_t)yRadius * yRadius;
+    int32_t x = 0;
+    int32_t y = yRadius;
+    int64_t px = 0;
+    int64_t py = 2 * rx2 * y;
+    int64_t p = ry2 - rx2 * yRadius + rx2 / 4;
+    bool full = (fill == DrawFill::FULL);
+
+    beginWrite();
+    if (yRadius == 0) {
+        // Flat: region 1 never runs, so draw the line directly
+        if (full) {
+            drawSpan(xCenter - xRadius, xCenter + xRadius, yCenter, color);
+        } else {
+            for (x = 0; x <= xRadius; x++) {
+                drawEllipsePoints(xCenter, yCenter, x, 0, color, dotSize);
+            }
+        }
+        endWrite();
+        return;
+    }
+
+    // Region 1: slope under 1, x steps every time
+    while (px < py) {
+        if (!full) {
+            drawEllipsePoints(xCenter, yCenter, x, y, color, dotSize);
+        } else if (p >= 0) {
+            // Last x on this row
+            drawSpan(xCenter - x, xCenter + x, yCenter + y, color);
+            drawSpan(xCenter - x, xCenter + x, yCenter - y, color);
+        }
+        x++;
+        px += 2 * ry2;
+        if (p < 0) {
+            p += ry2 + px;
+        } else {
+            y--;
+            py -= 2 * rx2;
+            p += ry2 + px - py;
+        }
+    }
+
+    // Region 2: y steps every time
+    p = ry2 * ((int64_t)x * x + x) + ry2 / 4 + rx2 * (int64_t)(y - 1) * (y - 1) - rx2 * ry2;
+    while (y >= 0) {
+        if (!full) {
+            drawEllipsePoints(xCenter, yCenter, x, y, color, dotSize);
+        } else {
+            drawSpan(xCenter - x, xCenter + x, yCenter + y, color);
+            if (y != 0) drawSpan(xCenter - x, xCenter + x, yCenter - y, color);
+        }
+        y--;
+        py -= 2 * rx2;
+        if (p > 0) {
+            p += rx2 - py;
+        } else {
+            x++;
+            px += 2 * ry2;
+            p += rx2 - py + px;
+        }
+    }
+    endWrite();
+}
+
+void LCDSurface::drawEllipsePoints(int32_t xCenter, int32_t yCenter, int32_t x, int32_t y,
+                                   COLOR color, DotPixel dotSize) {
+    // Points off the top/left wrap to large POINTs and are dropped by drawPoint()
+    drawPoint(xCenter + x, yCenter + y, color, dotSize, DOT_STYLE_DEFAULT);
+    drawPoint(xCenter - x, yCenter + y, color, dotSize, DOT_STYLE_DEFAULT);
+    drawPoint(xCenter + x, yCenter - y, color, dotSize, DOT_STYLE_DEFAULT);
+    drawPoint(xCenter - x, yCenter - y, color, dotSize, DOT_STYLE_DEFAULT);
+}
+
+//------------------------------------------------------------------------------
+// Text and numbers
+//------------------------------------------------------------------------------
+
+// Glyph pixel (col, row) lands at (x + col - 1, y + row - 1), where the
+// per-pixel drawPoint() the text code used to be built on put it.
+
+void LCDSurface::drawChar(POINT x, POINT y, char ch,
+                           sFONT* font, COLOR bgColor, COLOR fgColor) {
+    if (x > _info.width || y > _info.height) {
+        return;
+    }
+
+    // A white background means "transparent", as it always has
+    if (FONT_BACKGROUND == bgColor) {
+        drawGlyphTransparent(x, y, ch, font, fgColor);
+    } else {
+        drawGlyphsOpaque(x, y, &ch, 1, font, bgColor, fgColor);
+    }
+}
+
+void LCDSurface::drawGlyphsOpaque(POINT x, POINT y, const char* str, uint16_t count,
+                                  sFONT* font, COLOR bgColor, COLOR fgColor) {
+    if (_glyphCache != nullptr) {
+        // One blit per cached glyph; clipped or uncacheable ones are
+        // rasterized below one at a time
+        beginWrite();
+        POINT gx = x;
+        for (uint16_t i = 0; i < count; i++) {
+            uint16_t advance = LCDFont::advance(font, str[i]);
+            if (advance == 0) continue;
+            if (!drawGlyphCached((int32_t)gx - 1, (int32_t)y - 1, str[i], font, bgColor, fgColor)) {
+                streamGlyphs(gx, y, str + i, 1, font, bgColor, fgColor);
+            }
+            gx += advance;
+        }
+        endWrite();
+        return;
+    }
+    streamGlyphs(x, y, str, count, font, bgColor, fgColor);
+}
+
+bool LCDSurface::drawGlyphCached(int32_t left, int32_t top, char ch,
+                                 sFONT* font, COLOR bgColor, COLOR fgColor) {
+    uint16_t width = LCDFont::advance(font, ch);
+    if (left < 0 || top < 0 ||
+        left + width > _info.width || top + font->Height > _info.height) {
+        return false;
+    }
+
+    const COLOR* pixels = _glyphCache->find(font, ch, fgColor, bgColor);
+    if (pixels == nullptr) {
+        // Inserting may free an evicted glyph the queue is still sending
+        waitIdle();
+        pixels = _glyphCache->insert(font, ch, fgColor, bgColor);
+        if (pixels == nullptr) return false;
+    }
+    blit(left, top, width, font->Height, pixels, true);
+    return true;
+}
+
+void LCDSurface::streamGlyphs(POINT x, POINT y, const char* str, uint16_t count,
+                              sFONT* font, COLOR bgColor, COLOR fgColor) {
+    // Run-length glyphs are read top to bottom, each with its own reader:
+    // long runs of them go out a few glyphs per window
+    bool sequential = LCDGlyphReader::isSequential(font);
+    if (sequential && count > GLYPH_READERS) {
+        beginWrite();
+        POINT pen = x;
+        for (uint16_t i = 0; i < count; i += GLYPH_READERS) {
+            uint16_t n = (count - i < GLYPH_READERS) ? count - i : GLYPH_READERS;
+            streamGlyphs(pen, y, str + i, n, font, bgColor, fgColor);
+            pen += LCDFont::measure(font, str + i, n);
+        }
+        endWrite();
+        return;
+    }
+
+    // Cell edges; proportional glyphs (always sequential) have their own
+    // widths, the others sit at index * width
+    int32_t width = font->Width;
+    int32_t edges[GLYPH_READERS + 1];
+    edges[0] = 0;
+    if (sequential) {
+        for (uint16_t i = 0; i < count; i++) {
+            edges[i + 1] = edges[i] + LCDFont::advance(font, str[i]);
+        }
+    }
+
+    // Visible part of the run, in run coordinates
+    int32_t left = (int32_t)x - 1;
+    int32_t top = (int32_t)y - 1;
+    int32_t colStart = (left < 0) ? -left : 0;
+    int32_t rowStart = (top < 0) ? -top : 0;
+    int32_t colEnd = sequential ? edges[count] : (int32_t)count * width;
+    int32_t rowEnd = font->Height;
+    if (left + colEnd > _info.width) colEnd = _info.width - left;
+    if (top + rowEnd > _info.height) rowEnd = _info.height - top;
+    if (colEnd <= colStart || rowEnd <= rowStart) return;
+
+    LCDGlyphReader readers[GLYPH_READERS];
+    if (sequential) {
+        for (uint16_t i = 0; i < count; i++) {
+            readers[i].begin(font, str[i], rowStart);
+        }
+    }
+
+    // One window for the whole run, streamed a row at a time
+    beginWrite();
+    setWindow(left + colStart, top + rowStart, left + colEnd, top + rowEnd);
+    for (int32_t row = rowStart; row < rowEnd; row++) {
+        for (int32_t index = sequential ? 0 : colStart / width; index < count; index++) {
+            int32_t col = sequential ? edges[index] : index * width;
+            int32_t glyphEnd = sequential ? edges[index + 1] : col + width;
+            if (col >= colEnd) break;
+            if (glyphEnd <= colStart) continue;
+            LCDGlyphReader& glyph = sequential ? readers[index] : readers[0];
+            if (!sequential) glyph.begin(font, str[index], row);
+
+            // Whole glyph rows are read; only the visible columns go out
+            while (col < glyphEnd) {
+                bool set;
+                int32_t runEnd = col + glyph.run(glyphEnd - col, set);
+                int32_t from = (col < colStart) ? colStart : col;
+                int32_t to = (runEnd > colEnd) ? colEnd : runEnd;
+                for (; from < to; from++) {
+                    stagePixel(set ? fgColor : bgColor);
+                }
+                col = runEnd;
+            }
+        }
+    }
+    flushStage();
+    endWrite();
+}
+
+void LCDSurface::drawGlyphTransparent(POINT x, POINT y, char ch,
+                                      sFONT* font, COLOR fgColor) {
+    LCDGlyphReader glyph;
+    glyph.begin(font, ch);
+    POINT width = glyph.getWidth();
+
+    // One fill per horizontal run of set bits
+    beginWrite();
+    for (POINT row = 0; row < font->Height; row++) {
+        int32_t py = (int32_t)y + row - 1;
+        if (py >= _info.height) break;
+
+        POINT col = 0;
+        while (col < width) {
+            bool set;
+            POINT runStart = col;
+            col += glyph.run(width - col, set);
+            if (!set || py < 0) continue;
+
+            int32_t xs = (int32_t)x + runStart - 1;
+            int32_t xe = (int32_t)x + col - 1;
+            if (xs < 0) xs = 0;
+            if (xe > _info.width) xe = _info.width;
+            if (xe > xs) {
+                fillArea(xs, py, xe, py + 1, fgColor);
+            }
+        }
+    }
+    endWrite();
+}
+
+void LCDSurface::drawString(POINT x, POINT y, const char* str,
+                             sFONT* font, COLOR bgColor, COLOR fgColor) {
+    POINT xPoint = x;
+    POINT yPoint = y;
+
+    if (x > _info.width || y > _info.height) {
+        return;
+    }
+
+    beginWrite();
+    while (*str != '\0') {
+        if ((xPoint + LCDFont::advance(font, *str)) > _info.width) {
+            xPoint = x;
+            yPoint += font->Height;
+        }
+        if ((yPoint + font->Height) > _info.height) {
+            xPoint = x;
+            yPoint = y;
+        }
+
+        // Characters that fit on this line go out together. A start row
+        // too low for the font sends every character back to (x, y).
+        uint16_t count = 1;
+        uint32_t end = xPoint + LCDFont::advance(font, str[0]);
+        bool overflow = (yPoint + font->Height) > _info.height;
+        while (!overflow && str[count] != '\0' &&
+               end + LCDFont::advance(font, str[count]) <= _info.width) {
+            end += LCDFont::advance(font, str[count]);
+            count++;
+        }
+
+        if (FONT_BACKGROUND == bgColor) {
+            POINT gx = xPoint;
+            for (uint16_t i = 0; i < count; i++) {
+                drawGlyphTransparent(gx, yPoint, str[i], font, fgColor);
+                gx += LCDFont::advance(font, str[i]);
+            }
+        } else {
+            drawGlyphsOpaque(xPoint, yPoint, str, count, font, bgColor, fgColor);
+        }
+        str += count;
+        xPoint = end;
+    }
+    endWrite();
+}
+
+void LCDSurface::drawNumber(POINT x, POINT y, int32_t number,
+                             sFONT* font, COLOR bgColor, COLOR fgColor) {
+    if (x > _info.width || y > _info.height) {
+        return;
+    }
+
+    char text[LCDFormat::MAX_CHARS];
+    LCDFormat::integer(text, number);
+    drawString(x, y, text, font, bgColor, fgColor);
+}
+
+//------------------------------------------------------------------------------
+// Bitmap display
+//------------------------------------------------------------------------------
+
+// Both maps land one pixel up and left of (x, y), where the 1x1
+// drawPoint() they used to be built on put them.
+
+void LCDSurface::drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                             POINT width, POINT height) {
+    POINT byteWidth = (width + 7) / 8;
+    beginWrite();
+    for (POINT j = 0; j < height; j++) {
+        int32_t py = (int32_t)y + j - 1;
+        if (py < 0) continue;
+        if (py >= _info.height) break;
+
+        // One fill per run of set bits
+        const uint8_t* row = bitmap + j * byteWidth;
+        POINT i = 0;
+        while (i < width) {
+            if (!(row[i / 8] & (128 >> (i & 7)))) {
+                i++;
+                continue;
+            }
+            POINT runStart = i;
+            while (i < width && (row[i / 8] & (128 >> (i & 7)))) i++;
+
+            int32_t xs = (int32_t)x + runStart - 1;
+            int32_t xe = (int32_t)x + i - 1;
+            if (xs < 0) xs = 0;
+            if (xe > _info.width) xe = _info.width;
+            if (xe > xs) {
+                fillArea(xs, py, xe, py + 1, Colors::WHITE);
+            }
+        }
+    }
+    endWrite();
+}
+
+void LCDSurface::drawGrayMap(POINT x, POINT y, const uint8_t* graymap) {
+    char gray = *(graymap + 1);
+    POINT width = (*(graymap + 3) << 8) | (*(graymap + 2));
+    POINT height = (*(graymap + 5) << 8) | (*(graymap + 4));
+
+    if (gray != 0x04) return;
+    graymap = graymap + 6;
+
+    // Visible part of the map, in map coordinates
+    POINT bytesPerRow = width / 2;
+    int32_t colStart = (x == 0) ? 1 : 0;
+    int32_t rowStart = (y == 0) ? 1 : 0;
+    int32_t colEnd = bytesPerRow * 2;
+    int32_t rowEnd = height;
+    if ((int32_t)x - 1 + colEnd > _info.width) colEnd = _info.width - (int32_t)x + 1;
+    if ((int32_t)y - 1 + rowEnd > _info.height) rowEnd = _info.height - (int32_t)y + 1;
+    if (colEnd <= colStart || rowEnd <= rowStart) return;
+
+    beginWrite();
+    setWindow(x - 1 + colStart, y - 1 + rowStart, x - 1 + colEnd, y - 1 + rowEnd);
+
+    for (int32_t j = rowStart; j < rowEnd; j++) {
+        const uint8_t* row = graymap + (uint32_t)j * bytesPerRow;
+        for (int32_t i = colStart; i < colEnd; i++) {
+            uint8_t b = row[i / 2];
+            stagePixel((i & 1) ? (COLOR)~b : (COLOR)~(b >> 4));
+        }
+    }
+    flushStage();
+    endWrite();
+}
+
+//------------------------------------------------------------------------------
+// Utility functions
+//------------------------------------------------------------------------------
+
+sFONT* LCDSurface::getFontForSize(POINT dx, POINT dy) {
+    if (dx > Font24.Width && dy > Font24.Height) {
+        return &Font24;
+    } else if (dx > Font20.Width && dx < Font24.Width &&
+               dy > Font20.Height && dy < Font24.Height) {
+        return &Font20;
+    } else if (dx > Font16.Width && dx < Font20.Width &&
+               dy > Font16.Height && dy < Font20.Height) {
+        return &Font16;
+    } else if (dx > Font12.Width && dx < Font16.Width &&
+               dy > Font12.Height && dy < Font16.Height) {
+        return &Font12;
+    } else if (dx > Font8.Width && dx < Font12.Width &&
+               dy > Font8.Height && dy < Font12.Height) {
+        return &Font8;
+    }
+    return nullptr;
+}
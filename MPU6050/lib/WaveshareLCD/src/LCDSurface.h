@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * | File        : LCDSurface.h
+ * | Function    : Drawing primitives shared by the panel and RAM canvases
+ * | Info        : Base class of WaveshareLCD and LCDCanvas
+ * |
+ * | Every primitive (lines, rectangles, circles, text, bitmaps) is built on
+ * | the small pixel sink below: fillArea(), setPixel(), and setWindow()
+ * | followed by pushPixels(). WaveshareLCD implements the sink with the
+ * | ILI9486 command stream, LCDCanvas with a RAM buffer, so a widget drawn
+ * | on either looks the same pixel for pixel.
+ * |
+ * | Coordinates follow the panel driver: fillArea()/setWindow() take
+ * | exclusive end points, and the point-based primitives (drawPoint, the
+ * | diagonal lines, circles, text and bitmaps) land one pixel up and left
+ * | of the given position, as they always have.
+ *****************************************************************************/
+
+#ifndef __LCD_SURFACE_H
+#define __LCD_SURFACE_H
+
+#include <stdint.h>
+#include "LCDTypes.h"
+#include "LCDGlyphCache.h"
+#include "LCDGlyphReader.h"
+#include "fonts/fonts.h"
+
+class LCDSurface {
+public:
+    virtual ~LCDSurface() {}
+
+    //--------------------------------------------------------------------------
+    // Surface properties
+    //--------------------------------------------------------------------------
+    LENGTH getWidth() const { return _info.width; }
+    LENGTH getHeight() const { return _info.height; }
+
+    //--------------------------------------------------------------------------
+    // Pixel sink
+    //--------------------------------------------------------------------------
+    virtual void setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) = 0;
+    virtual void setPixel(POINT x, POINT y, COLOR color) = 0;
+    virtual void fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) = 0;
+
+    // Stream pixels into the window opened by setWindow(). Pixels are native
+    // RGB565 unless 'swapped' says they are already in wire (big-endian)
+    // order.
+    virtual void pushPixels(const COLOR* pixels, uint32_t count, bool swapped = false) = 0;
+
+    // Stream 4-bit palette indices, two a byte (first pixel in the high
+    // nibble); pairs[byte] holds the byte's two pixels in wire order. The
+    // default sends them through pushPixels() a few at a time.
+    virtual void pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs);
+
+    // Batch brackets around a group of sink calls (calls nest)
+    virtual void beginWrite() {}
+    virtual void endWrite() {}
+
+    // Wait until nothing queued still reads from caller memory
+    virtual void waitIdle() {}
+
+    //--------------------------------------------------------------------------
+    // Screen control
+    //--------------------------------------------------------------------------
+    void clear(COLOR color = LCD_BACKGROUND);
+
+    //--------------------------------------------------------------------------
+    // Bulk pixel transfer
+    //--------------------------------------------------------------------------
+    // Copy a width x height block to (x, y) through a single window
+    void blit(POINT x, POINT y, LENGTH width, LENGTH height,
+              const COLOR* pixels, bool swapped = false);
+
+    // Same, for a sub-rectangle of a larger image; 'stride' is the source
+    // row pitch in pixels. Clipped to the surface.
+    void blitSubRect(POINT x, POINT y, LENGTH width, LENGTH height,
+                     const COLOR* pixels, LENGTH stride, bool swapped = false);
+
+    //--------------------------------------------------------------------------
+    // Drawing primitives
+    //--------------------------------------------------------------------------
+    void drawPoint(POINT x, POINT y, COLOR color,
+                   DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                   DotStyle dotStyle = DOT_STYLE_DEFAULT);
+
+    void drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                  COLOR color,
+                  LineStyle lineStyle = LineStyle::SOLID,
+                  DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    // Wu anti-aliased 1-pixel line, blended against a known background
+    void drawLineAA(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                    COLOR color, COLOR bgColor = LCD_BACKGROUND);
+
+    void drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                       COLOR color,
+                       DrawFill fill = DrawFill::EMPTY,
+                       DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                       LineStyle lineStyle = LineStyle::SOLID);
+
+    void drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                    COLOR color,
+                    DrawFill fill = DrawFill::EMPTY,
+                    DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    void drawEllipse(POINT xCenter, POINT yCenter, LENGTH xRadius, LENGTH yRadius,
+                     COLOR color,
+                     DrawFill fill = DrawFill::EMPTY,
+                     DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    //--------------------------------------------------------------------------
+    // Text and numbers
+    //--------------------------------------------------------------------------
+    void drawChar(POINT x, POINT y, char ch,
+                  sFONT* font,
+                  COLOR bgColor, COLOR fgColor);
+
+    void drawString(POINT x, POINT y, const char* str,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    void drawNumber(POINT x, POINT y, int32_t number,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    // Cache opaque glyphs as RGB565 (nullptr = rasterize every time)
+    void setGlyphCache(LCDGlyphCache* cache) { _glyphCache = cache; }
+    LCDGlyphCache* getGlyphCache() const { return _glyphCache; }
+
+    //--------------------------------------------------------------------------
+    // Bitmap display
+    //--------------------------------------------------------------------------
+    void drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                    POINT width, POINT height);
+
+    void drawGrayMap(POINT x, POINT y, const uint8_t* graymap);
+
+    //--------------------------------------------------------------------------
+    // Utility functions
+    //--------------------------------------------------------------------------
+    sFONT* getFontForSize(POINT dx, POINT dy);
+
+protected:
+    LCDSurface();
+
+    LCDInfo _info;
+
+    //--------------------------------------------------------------------------
+    // Staging buffer for pixels generated on the fly. It stays under the
+    // panel driver's ASYNC_MIN_PIXELS, so each flush is sent before the
+    // buffer is reused.
+    //--------------------------------------------------------------------------
+    static constexpr uint8_t STAGE_PIXELS = 32;
+    COLOR _stage[STAGE_PIXELS];
+    uint8_t _stageCount;
+
+    LCDGlyphCache* _glyphCache;
+
+    // Run-length glyphs decoded side by side in one window
+    static constexpr uint8_t GLYPH_READERS = 8;
+
+    inline void stagePixel(COLOR color) {
+        _stage[_stageCount++] = color;
+        if (_stageCount == STAGE_PIXELS) flushStage();
+    }
+    void flushStage();
+
+private:
+    //--------------------------------------------------------------------------
+    // Helper functions
+    //--------------------------------------------------------------------------
+    void drawHorizontalLine(POINT xStart, POINT xEnd, POINT y,
+                            COLOR color, LineStyle style, DotPixel dotSize);
+    void drawVerticalLine(POINT x, POINT yStart, POINT yEnd,
+                          COLOR color, LineStyle style, DotPixel dotSize);
+    // Thick line rasterizer: x-extent of the most recent path rows
+    struct StrokeRows {
+        int32_t size;
+        COLOR color;
+        bool rightward;                 // x grows as the path goes down
+        int32_t first, last;            // First and latest finished path row
+        int16_t lo[2 * 8 - 1];          // Ring of 2 * size - 1 rows
+        int16_t hi[2 * 8 - 1];
+    };
+    void drawThickLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                       COLOR color, DotPixel dotSize);
+    void drawAAPairs(bool steep, int32_t m, int32_t n, int32_t count,
+                     const COLOR* lead, const COLOR* trail);
+    void pushStrokeRow(StrokeRows& rows, int32_t lo, int32_t hi);
+    void drawStrokeRow(const StrokeRows& rows, int32_t row);
+    void drawSpan(int32_t xLeft, int32_t xRight, int32_t y, COLOR color);
+    void drawEllipsePoints(int32_t xCenter, int32_t yCenter, int32_t x, int32_t y,
+                           COLOR color, DotPixel dotSize);
+    void drawGlyphsOpaque(POINT x, POINT y, const char* str, uint16_t count,
+                          sFONT* font, COLOR bgColor, COLOR fgColor);
+    void streamGlyphs(POINT x, POINT y, const char* str, uint16_t count,
+                      sFONT* font, COLOR bgColor, COLOR fgColor);
+    bool drawGlyphCached(int32_t left, int32_t top, char ch,
+                         sFONT* font, COLOR bgColor, COLOR fgColor);
+    void drawGlyphTransparent(POINT x, POINT y, char ch,
+                              sFONT* font, COLOR fgColor);
+    static void swapPoints(POINT& p1, POINT& p2);
+};
+
+#endif // __LCD_SURFACE_H
@@ -20,6 +20,7 @@
 
 #include <Arduino.h>
 #include "WaveShareDemo.h"   // LCD_Driver / LCD_GUI / LCD_Touch
+#include "LCD_Label.h"
 #include "I2Cdev.h"
 #include "MPU6050.h"
 
@@ -82,6 +83,9 @@ static int cx, cy;                                 // Center coordinates for arr
 static int zx = 60;                                // X position for Z axis display (left side)
 static int xyBoxLeft, xyBoxRight, xyBoxTop, xyBoxBottom;  // Boundaries for display areas
 
+// Readouts: each redraws only the characters that changed
+static GUI_LABEL magXYLabel, magZLabel, tempLabel;
+
 // Temperature update timing
 static unsigned long lastTempUpdate = 0;
 static const unsigned long TEMP_UPDATE_INTERVAL = 1000;  // Update temperature every 1 second
@@ -258,7 +262,9 @@ void setup() {
   // ---- LCD ----
   Wvshr_Init();
   LCD_SCAN_DIR Lcd_ScanDir = SCAN_DIR_DFT;
+  unsigned long lcdStart = micros();
   LCD_Init(Lcd_ScanDir, 200);
+  unsigned long lcdInit = micros() - lcdStart;
   LCD_Clear(WHITE);
   TP_Init();
 
@@ -275,9 +281,20 @@ void setup() {
   cx = (xyBoxLeft + xyBoxRight) / 2;
   cy = (xyBoxTop + xyBoxBottom) / 2;
 
+  // Transparent text over the white screen
+  GUI_LabelInit(&magXYLabel, xyBoxRight - 48, xyBoxBottom + 7, 48, Font12.Height,
+                &Font12, WHITE, BLUE, LABEL_LEFT);
+  GUI_LabelInit(&magZLabel, zx - 25, xyBoxBottom + 7, 55, Font12.Height,
+                &Font12, WHITE, BLUE, LABEL_LEFT);
+  GUI_LabelInit(&tempLabel, W - 75, 10, 70, Font16.Height,
+                &Font16, WHITE, BLACK, LABEL_LEFT);
+
   // Draw static UI elements once
   DrawStaticUI();
 
+  // Boot-to-first-frame; millis() counts from the chip reset
+  Serial.printf("[BOOT] LCD init %lu us, first frame at %lu ms\n", lcdInit, millis());
+
   // Initialize filtered values from first read
   accelgyro.getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
   fax = ax;
@@ -376,13 +393,9 @@ void loop() {
       // Divide by ~16384 to convert to g's, but using 1000 for display scaling
       // Result shows combined acceleration magnitude (e.g., 1.0g when tilted 45°)
       float magXY = sqrtf(fax * fax + fay * fay) / 1000.0f;  // in g's (approx)
-      char buf[16];
-      snprintf(buf, sizeof(buf), "%.2fg", magXY);
 
-      // Clear previous magnitude text area
-      GUI_DrawRectangle(xyBoxRight - 50, xyBoxBottom + 5, xyBoxRight, xyBoxBottom + 20,
-                        WHITE, DRAW_FULL, DOT_PIXEL_1X1);
-      GUI_DisString_EN(xyBoxRight - 48, xyBoxBottom + 7, buf, &Font12, WHITE, BLUE);
+      // Shown in hundredths, e.g. 123 -> "1.23g"
+      GUI_LabelFixed(&magXYLabel, lroundf(magXY * 100.0f), 2, "g");
 
       #ifdef OUTPUT_READABLE_ACCELGYRO
         Serial.print("[XY moved] px=");
@@ -413,13 +426,7 @@ void loop() {
       // Positive = facing up, Negative = facing down
       // At rest flat on table: magZ ≈ +1.0g (gravity pulling down on sensor)
       float magZ = faz / 1000.0f;  // in g's (approx)
-      char buf[16];
-      snprintf(buf, sizeof(buf), "%.2fg", magZ);
-
-      // Clear previous magnitude text area
-      GUI_DrawRectangle(zx - 30, xyBoxBottom + 5, zx + 30, xyBoxBottom + 20,
-                        WHITE, DRAW_FULL, DOT_PIXEL_1X1);
-      GUI_DisString_EN(zx - 25, xyBoxBottom + 7, buf, &Font12, WHITE, BLUE);
+      GUI_LabelFixed(&magZLabel, lroundf(magZ * 100.0f), 2, "g");
 
       #ifdef OUTPUT_READABLE_ACCELGYRO
         Serial.print("[Z moved] zy=");
@@ -436,12 +443,8 @@ void loop() {
       int16_t tRaw = accelgyro.getTemperature();
       float tempC = (tRaw / 340.0f) + 36.53f;  // MPU6050 datasheet formula
 
-      char buf[20];
-      snprintf(buf, sizeof(buf), "%.1f C", tempC);
-
-      // Clear previous temperature area
-      GUI_DrawRectangle(W - 80, 5, W - 5, 25, WHITE, DRAW_FULL, DOT_PIXEL_1X1);
-      GUI_DisString_EN(W - 75, 10, buf, &Font16, WHITE, BLACK);
+      // Shown in tenths, e.g. 235 -> "23.5 C"
+      GUI_LabelFixed(&tempLabel, lroundf(tempC * 10.0f), 1, " C");
 
       #ifdef OUTPUT_READABLE_ACCELGYRO
           // display tab-separated accel/gyro x/y/z values
@@ -0,0 +1,61 @@
+#include "GateScreen.h"
+
+GateScreen::GateScreen(WaveShare& screen)
+    : _screen(screen)
+    , _log(screen.getLCD())
+{
+}
+
+void GateScreen::begin(const char* address) {
+    _screen.fillScreen(Colors::WHITE);
+    _screen.drawTextBox(0, 20, _screen.getWidth(), 30,
+                        "READY", &Font24,
+                        Colors::WHITE, Colors::BLACK);
+    _screen.drawTextBox(0, 60, _screen.getWidth(), 30,
+                        "Load budget at:", &Font24,
+                        Colors::WHITE, Colors::BLACK);
+    _screen.drawTextBox(0, 100, _screen.getWidth(), 30,
+                        address, &Font24,
+                        Colors::WHITE, Colors::BLACK);
+
+    // Gate events scroll by under the status message
+    _log.begin(STATUS_HEIGHT, _screen.getHeight() - STATUS_HEIGHT, &Font16,
+               Colors::WHITE, Colors::BLACK);
+}
+
+// The scene is retained, so only the text that differs from the last
+// status goes to the panel. Long messages wrap at spaces; the same few
+// statuses come back all the time and are laid out only once. With the
+// display task running the scene is sent from there and loop() goes on.
+void GateScreen::showStatus(const char* text) {
+    _screen.beginScene(true);
+    _screen.fillRect(0, 0, _screen.getWidth(), STATUS_HEIGHT, Colors::WHITE);
+    _screen.drawTextBox(0, 0, _screen.getWidth(), STATUS_HEIGHT / 2,
+                        text, &Font24,
+                        Colors::WHITE, Colors::BLACK);
+    _screen.endScene();
+}
+
+void GateScreen::showLeft(int budget) {
+    _screen.fillScreen(Colors::WHITE);
+
+    _screen.drawTextCentered(0, 60, _screen.getWidth(), 80,
+                             "LEFT", &Font24,
+                             Colors::WHITE, Colors::BLACK);
+
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%d", budget);
+
+    _screen.drawTextCentered(0, 150, _screen.getWidth(), 100,
+                             buf, &Font24,
+                             Colors::WHITE, Colors::BLACK);
+}
+
+// Once the display task runs, the log is written from there too
+void GateScreen::log(const char* line) {
+    if (_screen.getDisplay().isReady()) {
+        _screen.getDisplay().print(_log, line);
+    } else {
+        _log.print(line);
+    }
+}
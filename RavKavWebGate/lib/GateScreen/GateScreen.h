@@ -0,0 +1,41 @@
+#ifndef GATE_SCREEN_H
+#define GATE_SCREEN_H
+
+#include <Arduino.h>
+#include "WaveShare.h"
+#include "LCDConsole.h"
+
+/**
+ * GateScreen - What the gate shows on the LCD
+ *
+ * The ready banner with the address to load a budget at, the status of
+ * the last card on top and a log of gate events scrolling by below it.
+ * Drawing only: the screen is begun, and its display task run, by the
+ * application.
+ */
+class GateScreen {
+public:
+    // Status area at the top; the gate log takes the rest
+    static constexpr int16_t STATUS_HEIGHT = 160;
+
+    explicit GateScreen(WaveShare& screen);
+    ~GateScreen() = default;
+
+    // Ready banner and an empty gate log, after screen.begin()
+    void begin(const char* address);
+
+    // Redraw the status area above the gate log
+    void showStatus(const char* text);
+
+    // Whole screen: the budget left on the card
+    void showLeft(int budget);
+
+    // Append a line to the gate log
+    void log(const char* line);
+
+private:
+    WaveShare& _screen;
+    LCDConsole _log;
+};
+
+#endif // GATE_SCREEN_H
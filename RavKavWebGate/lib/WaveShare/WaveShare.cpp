@@ -1,17 +1,21 @@
 #include "WaveShare.h"
-#include <SPI.h>
-
-// Touch controller chip select pin
-static constexpr uint8_t TOUCH_CS_PIN = 4;
 
 WaveShare::WaveShare()
     : _lcd()
     , _touch(_lcd)
+    , _glyphs(GLYPH_CACHE_BYTES)
+    , _recording(false)
+    , _retained(false)
+    , _sceneSent(0)
+    , _display(_lcd)
 {
 }
 
 void WaveShare::begin() {
-    _lcd.begin();
+    _lcd.setGlyphCache(&_glyphs);
+
+    // After a software or watchdog restart the panel is still set up
+    _lcd.begin(SCAN_DIR_DEFAULT, 200, LCDStart::AUTO);
     _touch.begin();
 
     // Apply touch calibration
@@ -26,20 +30,136 @@ uint16_t WaveShare::getHeight() const {
     return _lcd.getHeight();
 }
 
+bool WaveShare::beginScene(bool retained) {
+    waitForScene();
+    if (!_scene.begin(_lcd, LCDBandRenderer::DEFAULT_BAND_ROWS, true)) {
+        return false;
+    }
+    _scene.reset();
+    _recording = true;
+    _retained = retained;
+    return true;
+}
+
+void WaveShare::endScene() {
+    if (!_recording) return;
+    _recording = false;
+
+    if (_display.isReady()) {
+        // Sent by the render task, after what it still has
+        if (_display.run(sendScene, this)) {
+            _sceneSent = _display.fence();
+            return;
+        }
+        // Dropped (Overflow::DROP): send it from here once the queue is done
+        _display.sync();
+    }
+    sendScene(_lcd, this);
+}
+
+void WaveShare::sendScene(WaveshareLCD& lcd, void* context) {
+    WaveShare* self = static_cast<WaveShare*>(context);
+    if (self->_retained) {
+        self->_scene.present();
+    } else {
+        self->_scene.render();
+    }
+    self->_scene.end();
+}
+
+void WaveShare::waitForScene() {
+    if (_display.isReady()) _display.wait(_sceneSent);
+}
+
+void WaveShare::invalidateScene() {
+    waitForScene();
+    _scene.invalidate();
+}
+
+void WaveShare::invalidateScene(int16_t x, int16_t y, int16_t w, int16_t h) {
+    // Drawn over outside a scene: the next retained scene sends it again
+    int16_t x1 = x + w;
+    int16_t y1 = y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 <= x || y1 <= y) return;
+    waitForScene();
+    _scene.invalidate(x, y, x1, y1);
+}
+
+bool WaveShare::beginDisplayTask() {
+    _sceneSent = 0;                 // Fences count from 0 again
+    return _display.begin();
+}
+
+void WaveShare::endDisplayTask() {
+    _display.end();
+}
+
+void WaveShare::sync() {
+    if (_display.isReady()) {
+        _display.sync();
+    } else {
+        _lcd.waitIdle();
+    }
+}
+
 void WaveShare::fillScreen(uint16_t color) {
+    if (_recording) {
+        _scene.clear(color);
+        return;
+    }
+    invalidateScene();
+    if (_display.isReady()) {
+        _display.clear(color);
+        return;
+    }
     _lcd.clear(color);
 }
 
 void WaveShare::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (_recording) {
+        _scene.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::FULL);
+        return;
+    }
+    invalidateScene(x, y, w, h);
+    if (_display.isReady()) {
+        _display.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::FULL);
+        return;
+    }
     _lcd.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::FULL);
 }
 
 void WaveShare::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (_recording) {
+        _scene.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::EMPTY);
+        return;
+    }
+    invalidateScene(x - 1, y - 1, w + 2, h + 2);
+    if (_display.isReady()) {
+        _display.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::EMPTY);
+        return;
+    }
     _lcd.drawRectangle(x, y, x + w - 1, y + h - 1, color, DrawFill::EMPTY);
 }
 
 void WaveShare::drawText(int16_t x, int16_t y, const char* text, sFONT* font,
                           uint16_t bgColor, uint16_t fgColor) {
+    if (_recording) {
+        _scene.drawString(x, y, text, font, bgColor, fgColor);
+        return;
+    }
+    // Text too long for its line wraps around the screen
+    int32_t textWidth = (int32_t)LCDFont::measure(font, text);
+    if (x + textWidth > getWidth()) {
+        invalidateScene();
+    } else {
+        invalidateScene(x - 1, y - 1, textWidth + 1, font->Height + 1);
+    }
+    if (_display.isReady()) {
+        _display.drawString(x, y, text, font, bgColor, fgColor);
+        return;
+    }
     _lcd.drawString(x, y, text, font, bgColor, fgColor);
 }
 
@@ -47,59 +167,47 @@ void WaveShare::drawTextCentered(int16_t x, int16_t y, int16_t w, int16_t h,
                                   const char* text, sFONT* font,
                                   uint16_t bgColor, uint16_t fgColor) {
     // Calculate text dimensions
-    size_t len = strlen(text);
-    int16_t textWidth = len * font->Width;
+    int16_t textWidth = LCDFont::measure(font, text);
     int16_t textHeight = font->Height;
 
     // Center position
     int16_t textX = x + (w - textWidth) / 2;
     int16_t textY = y + (h - textHeight) / 2;
 
-    _lcd.drawString(textX, textY, text, font, bgColor, fgColor);
+    drawText(textX, textY, text, font, bgColor, fgColor);
 }
 
 void WaveShare::drawTextRightAligned(int16_t x, int16_t y, int16_t w,
                                       const char* text, sFONT* font,
                                       uint16_t bgColor, uint16_t fgColor) {
     // Calculate text width
-    size_t len = strlen(text);
-    int16_t textWidth = len * font->Width;
+    int16_t textWidth = LCDFont::measure(font, text);
 
     // Right-align position
     int16_t textX = x + w - textWidth;
 
-    _lcd.drawString(textX, y, text, font, bgColor, fgColor);
+    drawText(textX, y, text, font, bgColor, fgColor);
+}
+
+void WaveShare::drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h,
+                            const char* text, sFONT* font,
+                            uint16_t bgColor, uint16_t fgColor,
+                            LCDTextLayout::Align align) {
+    const LCDTextLayout::Lines& lines = _layout.layout(text, font, w);
+    for (uint8_t i = 0; i < lines.count; i++) {
+        int32_t lineX, lineY;
+        if (!LCDTextLayout::place(lines, i, font, x, y, w, h, align, lineX, lineY)) break;
+
+        char line[LCDTextLayout::MAX_LINE_LENGTH + 1];
+        LCDTextLayout::copyLine(text, lines.line[i], line);
+        drawText(lineX, lineY, line, font, bgColor, fgColor);
+    }
 }
 
 bool WaveShare::readTouch(int16_t& tx, int16_t& ty) {
-    // Direct SPI read from touch controller (more reliable than IRQ-based)
-    uint16_t rawX = 0, rawY = 0;
-
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-
-    digitalWrite(TOUCH_CS_PIN, LOW);
-
-    // Read X (command 0xD0)
-    SPI.transfer(0xD0);
-    delayMicroseconds(200);
-    rawX = SPI.transfer(0x00);
-    rawX <<= 8;
-    rawX |= SPI.transfer(0x00);
-    rawX >>= 3;
-
-    // Read Y (command 0x90)
-    SPI.transfer(0x90);
-    delayMicroseconds(200);
-    rawY = SPI.transfer(0x00);
-    rawY <<= 8;
-    rawY |= SPI.transfer(0x00);
-    rawY >>= 3;
-
-    digitalWrite(TOUCH_CS_PIN, HIGH);
-
-    SPI.endTransaction();
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+    // Direct read from touch controller (more reliable than IRQ-based)
+    POINT rawX = 0, rawY = 0;
+    _touch.readRaw(rawX, rawY);
 
     // Check if touch is valid (values in reasonable range)
     if (rawX > 100 && rawX < 4000 && rawY > 100 && rawY < 4000) {
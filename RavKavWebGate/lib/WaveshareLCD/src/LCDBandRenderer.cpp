@@ -0,0 +1,851 @@
+/*****************************************************************************
+ * | File        : LCDBandRenderer.cpp
+ * | Function    : Full-screen scenes rendered strip by strip
+ *****************************************************************************/
+
+#include "LCDBandRenderer.h"
+#include "LCDFont.h"
+#include "LCDFormat.h"
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr uint16_t FIRST_OP_CAPACITY = 32;
+static constexpr uint32_t FIRST_TEXT_CAPACITY = 256;
+
+// Calls that went away between two of the same are looked for this far
+static constexpr uint16_t MATCH_LOOKAHEAD = 8;
+
+static inline int32_t lower(POINT a, POINT b) { return (a < b) ? a : b; }
+static inline int32_t upper(POINT a, POINT b) { return (a > b) ? a : b; }
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+LCDBandRenderer::LCDBandRenderer()
+    : _target(nullptr), _bandRows(0), _background(LCD_BACKGROUND),
+      _ops(nullptr), _count(0), _capacity(0),
+      _text(nullptr), _textUsed(0), _textCapacity(0), _overflow(false),
+      _opsReplayed(0), _opsDropped(0), _opsMerged(0), _pixelsSent(0),
+      _prevOps(nullptr), _prevCount(0), _prevCapacity(0),
+      _prevText(nullptr), _prevTextCapacity(0),
+      _prevBackground(LCD_BACKGROUND), _prevValid(false),
+      _changes{}, _changeCount(0), _damage{0, 0, 0, 0}
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+      , _dualCore(false), _free(nullptr), _ready(nullptr)
+#endif
+{
+}
+
+LCDBandRenderer::~LCDBandRenderer() {
+    end();
+    free(_ops);
+    free(_text);
+    free(_prevOps);
+    free(_prevText);
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+bool LCDBandRenderer::begin(LCDSurface& target, LENGTH bandRows, bool dualCore) {
+    end();
+
+    LENGTH width = target.getWidth();
+    LENGTH height = target.getHeight();
+    if (bandRows == 0 || bandRows > height) bandRows = height;
+
+    if (!_bands[0].beginBand(width, height, bandRows) ||
+        !_bands[1].beginBand(width, height, bandRows)) {
+        _bands[0].end();
+        return false;
+    }
+    _target = &target;
+    _bandRows = bandRows;
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+    if (dualCore) {
+        _free = xSemaphoreCreateCounting(2, 2);
+        _ready = xQueueCreate(2, sizeof(uint8_t));
+        _dualCore = (_free != nullptr && _ready != nullptr);
+    }
+#else
+    (void)dualCore;
+#endif
+    return true;
+}
+
+void LCDBandRenderer::end() {
+    _bands[0].end();
+    _bands[1].end();
+    _target = nullptr;
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+    if (_free != nullptr) vSemaphoreDelete(_free);
+    if (_ready != nullptr) vQueueDelete(_ready);
+    _free = nullptr;
+    _ready = nullptr;
+    _dualCore = false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Display list
+//------------------------------------------------------------------------------
+
+void LCDBandRenderer::reset() {
+    _count = 0;
+    _textUsed = 0;
+    _overflow = false;
+}
+
+LCDBandRenderer::Op* LCDBandRenderer::record(OpType type, int32_t left, int32_t top,
+                                             int32_t right, int32_t bottom) {
+    if (_target == nullptr) return nullptr;
+
+    if (_count == _capacity) {
+        uint16_t capacity = _capacity ? _capacity * 2 : FIRST_OP_CAPACITY;
+        if (capacity <= _capacity) {
+            _overflow = true;
+            return nullptr;
+        }
+        Op* ops = (Op*)realloc(_ops, (size_t)capacity * sizeof(Op));
+        if (ops == nullptr) {
+            _overflow = true;
+            return nullptr;
+        }
+        _ops = ops;
+        _capacity = capacity;
+    }
+
+    // The area is only used to skip and compare calls, so it may be
+    // generous. It must never be too small.
+    int32_t width = _target->getWidth();
+    int32_t height = _target->getHeight();
+    if (left < 0) left = 0;
+    if (top < 0) top = 0;
+    if (right > width) right = width;
+    if (bottom > height) bottom = height;
+    if (right <= left || bottom <= top) return nullptr;
+
+    // Zeroed as a whole, padding included, so calls compare with memcmp()
+    Op* op = &_ops[_count++];
+    memset(op, 0, sizeof(Op));
+    op->type = type;
+    op->left = left;
+    op->top = top;
+    op->right = right;
+    op->bottom = bottom;
+    return op;
+}
+
+LCDBandRenderer::Op* LCDBandRenderer::recordText(OpType type, POINT x, POINT y,
+                                                 const char* text, sFONT* font) {
+    // Text that fits on one line stays on its rows. Anything longer may
+    // wrap, or start over at (x, y), so assume it can reach any row.
+    uint32_t width = LCDFont::measure(font, text);
+    bool oneLine = (uint32_t)x + width <= _target->getWidth() &&
+                   (uint32_t)y + font->Height <= _target->getHeight();
+    if (oneLine) {
+        return record(type, (int32_t)x - 1, (int32_t)y - 1,
+                      (int32_t)x + width, (int32_t)y + font->Height);
+    }
+    return record(type, 0, 0, _target->getWidth(), _target->getHeight());
+}
+
+void LCDBandRenderer::clear(COLOR color) {
+    if (_target == nullptr) return;
+    Op* op = record(OpType::CLEAR, 0, 0, _target->getWidth(), _target->getHeight());
+    if (op == nullptr) return;
+    op->color = color;
+}
+
+void LCDBandRenderer::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                               COLOR color) {
+    Op* op = record(OpType::FILL, xStart, yStart, xEnd, yEnd);
+    if (op == nullptr) return;
+    op->x0 = xStart;
+    op->y0 = yStart;
+    op->x1 = xEnd;
+    op->y1 = yEnd;
+    op->color = color;
+}
+
+void LCDBandRenderer::drawPoint(POINT x, POINT y, COLOR color,
+                                DotPixel dotSize, DotStyle dotStyle) {
+    int32_t size = static_cast<uint8_t>(dotSize);
+    Op* op = record(OpType::DOT, (int32_t)x - size - 1, (int32_t)y - size - 1,
+                    (int32_t)x + size + 1, (int32_t)y + size + 1);
+    if (op == nullptr) return;
+    op->x0 = x;
+    op->y0 = y;
+    op->color = color;
+    op->style[0] = static_cast<uint8_t>(dotSize);
+    op->style[1] = static_cast<uint8_t>(dotStyle);
+}
+
+void LCDBandRenderer::drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                               COLOR color, LineStyle lineStyle, DotPixel dotSize) {
+    // A thick diagonal reaches up to 2 * size - 1 pixels past its ends
+    int32_t pad = 2 * static_cast<uint8_t>(dotSize) + 1;
+    Op* op = record(OpType::LINE, lower(xStart, xEnd) - pad, lower(yStart, yEnd) - pad,
+                    upper(xStart, xEnd) + pad, upper(yStart, yEnd) + pad);
+    if (op == nullptr) return;
+    op->x0 = xStart;
+    op->y0 = yStart;
+    op->x1 = xEnd;
+    op->y1 = yEnd;
+    op->color = color;
+    op->style[0] = static_cast<uint8_t>(lineStyle);
+    op->style[1] = static_cast<uint8_t>(dotSize);
+}
+
+void LCDBandRenderer::drawLineAA(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                                 COLOR color, COLOR bgColor) {
+    Op* op = record(OpType::LINE_AA, lower(xStart, xEnd) - 2, lower(yStart, yEnd) - 2,
+                    upper(xStart, xEnd) + 2, upper(yStart, yEnd) + 2);
+    if (op == nullptr) return;
+    op->x0 = xStart;
+    op->y0 = yStart;
+    op->x1 = xEnd;
+    op->y1 = yEnd;
+    op->color = color;
+    op->color2 = bgColor;
+}
+
+void LCDBandRenderer::drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                                    COLOR color, DrawFill fill,
+                                    DotPixel dotSize, LineStyle lineStyle) {
+    // A filled one is fillArea() between its corners and paints nothing
+    // around them; present() sends these bounds, so they stay exact
+    int32_t pad = (fill == DrawFill::FULL) ? 0 : 2 * static_cast<uint8_t>(dotSize) + 1;
+    Op* op = record(OpType::RECT, lower(xStart, xEnd) - pad, lower(yStart, yEnd) - pad,
+                    upper(xStart, xEnd) + pad, upper(yStart, yEnd) + pad);
+    if (op == nullptr) return;
+    op->x0 = xStart;
+    op->y0 = yStart;
+    op->x1 = xEnd;
+    op->y1 = yEnd;
+    op->color = color;
+    op->style[0] = static_cast<uint8_t>(fill);
+    op->style[1] = static_cast<uint8_t>(dotSize);
+    op->style[2] = static_cast<uint8_t>(lineStyle);
+}
+
+void LCDBandRenderer::drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                                 COLOR color, DrawFill fill, DotPixel dotSize) {
+    int32_t pad = static_cast<uint8_t>(dotSize) + 1;
+    Op* op = record(OpType::CIRCLE,
+                    (int32_t)xCenter - radius - pad, (int32_t)yCenter - radius - pad,
+                    (int32_t)xCenter + radius + pad, (int32_t)yCenter + radius + pad);
+    if (op == nullptr) return;
+    op->x0 = xCenter;
+    op->y0 = yCenter;
+    op->x1 = radius;
+    op->color = color;
+    op->style[0] = static_cast<uint8_t>(fill);
+    op->style[1] = static_cast<uint8_t>(dotSize);
+}
+
+void LCDBandRenderer::drawEllipse(POINT xCenter, POINT yCenter, LENGTH xRadius, LENGTH yRadius,
+                                  COLOR color, DrawFill fill, DotPixel dotSize) {
+    int32_t pad = static_cast<uint8_t>(dotSize) + 1;
+    Op* op = record(OpType::ELLIPSE,
+                    (int32_t)xCenter - xRadius - pad, (int32_t)yCenter - yRadius - pad,
+                    (int32_t)xCenter + xRadius + pad, (int32_t)yCenter + yRadius + pad);
+    if (op == nullptr) return;
+    op->x0 = xCenter;
+    op->y0 = yCenter;
+    op->x1 = xRadius;
+    op->y1 = yRadius;
+    op->color = color;
+    op->style[0] = static_cast<uint8_t>(fill);
+    op->style[1] = static_cast<uint8_t>(dotSize);
+}
+
+void LCDBandRenderer::drawChar(POINT x, POINT y, char ch,
+                               sFONT* font, COLOR bgColor, COLOR fgColor) {
+    Op* op = record(OpType::CHAR, (int32_t)x - 1, (int32_t)y - 1,
+                    (int32_t)x + LCDFont::advance(font, ch), (int32_t)y + font->Height);
+    if (op == nullptr) return;
+    op->x0 = x;
+    op->y0 = y;
+    op->x1 = (uint8_t)ch;
+    op->font = font;
+    op->color = bgColor;
+    op->color2 = fgColor;
+}
+
+void LCDBandRenderer::drawString(POINT x, POINT y, const char* str,
+                                 sFONT* font, COLOR bgColor, COLOR fgColor) {
+    if (_target == nullptr) return;
+
+    uint32_t length = strlen(str);
+    if (_textUsed + length + 1 > _textCapacity) {
+        uint32_t capacity = _textCapacity ? _textCapacity : FIRST_TEXT_CAPACITY;
+        while (capacity < _textUsed + length + 1) capacity *= 2;
+        char* text = (char*)realloc(_text, capacity);
+        if (text == nullptr) {
+            _overflow = true;
+            return;
+        }
+        _text = text;
+        _textCapacity = capacity;
+    }
+
+    Op* op = recordText(OpType::STRING, x, y, str, font);
+    if (op == nullptr) return;
+    memcpy(_text + _textUsed, str, length + 1);
+    op->text = _textUsed;
+    _textUsed += length + 1;
+    op->x0 = x;
+    op->y0 = y;
+    op->font = font;
+    op->color = bgColor;
+    op->color2 = fgColor;
+}
+
+void LCDBandRenderer::drawNumber(POINT x, POINT y, int32_t number,
+                                 sFONT* font, COLOR bgColor, COLOR fgColor) {
+    char text[LCDFormat::MAX_CHARS];
+    LCDFormat::integer(text, number);
+    Op* op = recordText(OpType::NUMBER, x, y, text, font);
+    if (op == nullptr) return;
+    op->number = number;
+    op->x0 = x;
+    op->y0 = y;
+    op->font = font;
+    op->color = bgColor;
+    op->color2 = fgColor;
+}
+
+void LCDBandRenderer::drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                                 POINT width, POINT height) {
+    Op* op = record(OpType::BITMAP, (int32_t)x - 1, (int32_t)y - 1,
+                    (int32_t)x + width, (int32_t)y + height);
+    if (op == nullptr) return;
+    op->data = bitmap;
+    op->x0 = x;
+    op->y0 = y;
+    op->x1 = width;
+    op->y1 = height;
+}
+
+void LCDBandRenderer::drawGrayMap(POINT x, POINT y, const uint8_t* graymap) {
+    POINT width = (*(graymap + 3) << 8) | (*(graymap + 2));
+    POINT height = (*(graymap + 5) << 8) | (*(graymap + 4));
+    Op* op = record(OpType::GRAYMAP, (int32_t)x - 1, (int32_t)y - 1,
+                    (int32_t)x + width, (int32_t)y + height);
+    if (op == nullptr) return;
+    op->data = graymap;
+    op->x0 = x;
+    op->y0 = y;
+}
+
+//------------------------------------------------------------------------------
+// Rasterizer
+//------------------------------------------------------------------------------
+
+void LCDBandRenderer::replay(LCDCanvas& band, const Op& op) {
+    switch (op.type) {
+    case OpType::CLEAR:
+        band.clear(op.color);
+        break;
+    case OpType::FILL:
+        band.fillArea(op.x0, op.y0, op.x1, op.y1, op.color);
+        break;
+    case OpType::DOT:
+        band.drawPoint(op.x0, op.y0, op.color,
+                       static_cast<DotPixel>(op.style[0]),
+                       static_cast<DotStyle>(op.style[1]));
+        break;
+    case OpType::LINE:
+        band.drawLine(op.x0, op.y0, op.x1, op.y1, op.color,
+                      static_cast<LineStyle>(op.style[0]),
+                      static_cast<DotPixel>(op.style[1]));
+        break;
+    case OpType::LINE_AA:
+        band.drawLineAA(op.x0, op.y0, op.x1, op.y1, op.color, op.color2);
+        break;
+    case OpType::RECT:
+        band.drawRectangle(op.x0, op.y0, op.x1, op.y1, op.color,
+                           static_cast<DrawFill>(op.style[0]),
+                           static_cast<DotPixel>(op.style[1]),
+                           static_cast<LineStyle>(op.style[2]));
+        break;
+    case OpType::CIRCLE:
+        band.drawCircle(op.x0, op.y0, op.x1, op.color,
+                        static_cast<DrawFill>(op.style[0]),
+                        static_cast<DotPixel>(op.style[1]));
+        break;
+    case OpType::ELLIPSE:
+        band.drawEllipse(op.x0, op.y0, op.x1, op.y1, op.color,
+                         static_cast<DrawFill>(op.style[0]),
+                         static_cast<DotPixel>(op.style[1]));
+        break;
+    case OpType::CHAR:
+        band.drawChar(op.x0, op.y0, (char)op.x1, op.font, op.color, op.color2);
+        break;
+    case OpType::STRING:
+        band.drawString(op.x0, op.y0, _text + op.text, op.font, op.color, op.color2);
+        break;
+    case OpType::NUMBER:
+        band.drawNumber(op.x0, op.y0, op.number, op.font, op.color, op.color2);
+        break;
+    case OpType::BITMAP:
+        band.drawBitmap(op.x0, op.y0, op.data, op.x1, op.y1);
+        break;
+    case OpType::GRAYMAP:
+        band.drawGrayMap(op.x0, op.y0, op.data);
+        break;
+    }
+}
+
+void LCDBandRenderer::rasterize(LCDCanvas& band, POINT top, POINT left, POINT right) {
+    rasterize(band, top, left, right, top, top + band.getBandRows());
+}
+
+void LCDBandRenderer::rasterize(LCDCanvas& band, POINT top, POINT left, POINT right,
+                                POINT sendTop, POINT sendBottom) {
+    band.setBandTop(top);
+    POINT bottom = top + band.getBandRows();
+
+    // A scene that starts with clear() paints the background itself
+    if (_count == 0 || _ops[0].type != OpType::CLEAR) band.clear(_background);
+
+    // Only the columns [left, right) are sent
+    for (uint16_t i = 0; i < _count; i++) {
+        const Op& op = _ops[i];
+        if (op.bottom <= top || op.top >= bottom) continue;
+        if (op.right <= left || op.left >= right) continue;
+        replay(band, op);
+        _opsReplayed++;
+    }
+    band.clearDirty();
+    band.markDirty(left, sendTop, right, sendBottom);
+}
+
+//------------------------------------------------------------------------------
+// Optimizer
+//------------------------------------------------------------------------------
+
+bool LCDBandRenderer::coverOf(const Op& op, LCDRect& area) const {
+    // The area every pixel of which the call paints with one color
+    switch (op.type) {
+    case OpType::CLEAR:
+        area = {0, 0, (POINT)_target->getWidth(), (POINT)_target->getHeight()};
+        return true;
+    case OpType::FILL:
+        area = {op.left, op.top, op.right, op.bottom};
+        return true;
+    case OpType::RECT: {
+        // A filled rectangle is fillArea() between its corners, unless a
+        // corner is off the screen and it draws nothing
+        if (static_cast<DrawFill>(op.style[0]) != DrawFill::FULL) return false;
+        if (upper(op.x0, op.x1) > _target->getWidth() ||
+            upper(op.y0, op.y1) > _target->getHeight()) {
+            return false;
+        }
+        area = {(POINT)lower(op.x0, op.x1), (POINT)lower(op.y0, op.y1),
+                (POINT)upper(op.x0, op.x1), (POINT)upper(op.y0, op.y1)};
+        return !area.isEmpty();
+    }
+    default:
+        return false;
+    }
+}
+
+void LCDBandRenderer::optimize() {
+    _opsDropped = 0;
+    _opsMerged = 0;
+
+    // Drop calls a later cover paints over completely. Only the largest
+    // few covers are kept, which is where a redraw puts its backgrounds.
+    static constexpr uint8_t MAX_COVERS = 8;
+    LCDRect covers[MAX_COVERS];
+    uint32_t coverAreas[MAX_COVERS];
+    uint8_t coverCount = 0;
+    for (int32_t i = _count - 1; i >= 0; i--) {
+        Op& op = _ops[i];
+        bool covered = false;
+        for (uint8_t c = 0; c < coverCount && !covered; c++) {
+            covered = op.left >= covers[c].x0 && op.right <= covers[c].x1 &&
+                      op.top >= covers[c].y0 && op.bottom <= covers[c].y1;
+        }
+        if (covered) {
+            op.right = op.left;         // Marks the slot as dropped
+            _opsDropped++;
+            continue;
+        }
+        LCDRect area;
+        if (!coverOf(op, area)) continue;
+        uint32_t size = (uint32_t)(area.x1 - area.x0) * (area.y1 - area.y0);
+        uint8_t slot = coverCount;
+        if (coverCount == MAX_COVERS) {
+            slot = 0;
+            for (uint8_t c = 1; c < MAX_COVERS; c++) {
+                if (coverAreas[c] < coverAreas[slot]) slot = c;
+            }
+            if (coverAreas[slot] >= size) continue;
+        } else {
+            coverCount++;
+        }
+        covers[slot] = area;
+        coverAreas[slot] = size;
+    }
+
+    // Compact, merging each solid fill into the one before it when they
+    // have the same color and together form a rectangle
+    uint16_t out = 0;
+    for (uint16_t i = 0; i < _count; i++) {
+        Op op = _ops[i];
+        if (op.right == op.left) continue;
+
+        if (out > 0 && op.type == OpType::FILL && _ops[out - 1].type == OpType::FILL &&
+            _ops[out - 1].color == op.color) {
+            Op& last = _ops[out - 1];
+            bool sameColumns = op.left == last.left && op.right == last.right;
+            bool sameRows = op.top == last.top && op.bottom == last.bottom;
+            bool inside = op.left >= last.left && op.right <= last.right &&
+                          op.top >= last.top && op.bottom <= last.bottom;
+            bool around = op.left <= last.left && op.right >= last.right &&
+                          op.top <= last.top && op.bottom >= last.bottom;
+            if (inside || around ||
+                (sameColumns && op.top <= last.bottom && op.bottom >= last.top) ||
+                (sameRows && op.left <= last.right && op.right >= last.left)) {
+                last.left = lower(last.left, op.left);
+                last.top = lower(last.top, op.top);
+                last.right = upper(last.right, op.right);
+                last.bottom = upper(last.bottom, op.bottom);
+                last.x0 = last.left;
+                last.y0 = last.top;
+                last.x1 = last.right;
+                last.y1 = last.bottom;
+                _opsMerged++;
+                continue;
+            }
+        }
+        _ops[out++] = op;
+    }
+    _count = out;
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+
+void LCDBandRenderer::render() {
+    if (_target == nullptr) return;
+    optimize();
+    _opsReplayed = 0;
+    _pixelsSent = (uint32_t)_target->getWidth() * _target->getHeight();
+
+    // The panel shows this list now, not the one present() kept
+    invalidate();
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+    if (_dualCore && renderDualCore()) return;
+#endif
+
+    // While one band is on its way out over DMA the other one is drawn
+    LENGTH height = _target->getHeight();
+    uint8_t next = 0;
+    _target->beginWrite();
+    for (POINT top = 0; top < height; top += _bandRows) {
+        LCDCanvas& band = _bands[next];
+        rasterize(band, top, 0, _target->getWidth());
+        band.flush(*_target, 0, 0);
+        next ^= 1;
+    }
+    _target->endWrite();
+}
+
+void LCDBandRenderer::present() {
+    if (_target == nullptr) return;
+    optimize();
+    _opsReplayed = 0;
+    _pixelsSent = 0;
+    findChanges();
+
+    // Each band sends the part of it its changed areas span, as one blit.
+    // Rows of the band outside them may belong to someone else.
+    LENGTH height = _target->getHeight();
+    uint8_t next = 0;
+    _target->beginWrite();
+    for (POINT top = 0; top < height && _changeCount > 0; top += _bandRows) {
+        POINT bottom = top + _bandRows;
+        if (bottom > height) bottom = height;
+
+        LCDRect span = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < _changeCount; i++) {
+            const LCDRect& change = _changes[i];
+            if (change.y1 <= top || change.y0 >= bottom) continue;
+            if (span.isEmpty()) {
+                span = change;
+            } else {
+                span.x0 = lower(span.x0, change.x0);
+                span.y0 = lower(span.y0, change.y0);
+                span.x1 = upper(span.x1, change.x1);
+                span.y1 = upper(span.y1, change.y1);
+            }
+        }
+        if (span.isEmpty()) continue;
+        span.y0 = upper(span.y0, top);
+        span.y1 = lower(span.y1, bottom);
+
+        LCDCanvas& band = _bands[next];
+        rasterize(band, top, span.x0, span.x1, span.y0, span.y1);
+        band.flush(*_target, 0, 0);
+        _pixelsSent += (uint32_t)(span.x1 - span.x0) * (span.y1 - span.y0);
+        next ^= 1;
+    }
+    _target->endWrite();
+
+    // Keep what was sent and start the next frame in the other buffers
+    Op* ops = _prevOps;
+    uint16_t capacity = _prevCapacity;
+    char* text = _prevText;
+    uint32_t textCapacity = _prevTextCapacity;
+    _prevOps = _ops;
+    _prevCount = _count;
+    _prevCapacity = _capacity;
+    _prevText = _text;
+    _prevTextCapacity = _textCapacity;
+    _prevBackground = _background;
+    _prevValid = true;
+    _ops = ops;
+    _capacity = capacity;
+    _text = text;
+    _textCapacity = textCapacity;
+    _changeCount = 0;
+    _damage = {0, 0, 0, 0};
+    reset();
+}
+
+void LCDBandRenderer::invalidate() {
+    _prevValid = false;
+    _damage = {0, 0, 0, 0};
+}
+
+void LCDBandRenderer::invalidate(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
+    if (xEnd <= xStart || yEnd <= yStart) return;
+    if (_damage.isEmpty()) {
+        _damage = {xStart, yStart, xEnd, yEnd};
+        return;
+    }
+    _damage.x0 = lower(_damage.x0, xStart);
+    _damage.y0 = lower(_damage.y0, yStart);
+    _damage.x1 = upper(_damage.x1, xEnd);
+    _damage.y1 = upper(_damage.y1, yEnd);
+}
+
+//------------------------------------------------------------------------------
+// Frame comparison
+//------------------------------------------------------------------------------
+
+bool LCDBandRenderer::sameOp(const Op& a, const char* aText,
+                             const Op& b, const char* bText) const {
+    if (a.type != b.type) return false;
+    if (a.type != OpType::STRING) return memcmp(&a, &b, sizeof(Op)) == 0;
+
+    // Strings sit at different offsets in the two text buffers
+    Op x = a, y = b;
+    x.text = 0;
+    y.text = 0;
+    return memcmp(&x, &y, sizeof(Op)) == 0 &&
+           strcmp(aText + a.text, bText + b.text) == 0;
+}
+
+void LCDBandRenderer::addChange(POINT x0, POINT y0, POINT x1, POINT y1) {
+    if (x1 <= x0 || y1 <= y0) return;
+
+    // Already inside a known area
+    for (uint8_t i = 0; i < _changeCount; i++) {
+        const LCDRect& change = _changes[i];
+        if (x0 >= change.x0 && x1 <= change.x1 && y0 >= change.y0 && y1 <= change.y1) {
+            return;
+        }
+    }
+    if (_changeCount < MAX_CHANGES) {
+        _changes[_changeCount++] = {x0, y0, x1, y1};
+        return;
+    }
+
+    // Full: grow the area that grows the least
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t i = 0; i < _changeCount; i++) {
+        const LCDRect& change = _changes[i];
+        uint32_t before = (uint32_t)(change.x1 - change.x0) * (change.y1 - change.y0);
+        uint32_t after = (uint32_t)(upper(change.x1, x1) - lower(change.x0, x0)) *
+                         (upper(change.y1, y1) - lower(change.y0, y0));
+        if (after - before < bestGrowth) {
+            bestGrowth = after - before;
+            best = i;
+        }
+    }
+    LCDRect& change = _changes[best];
+    change.x0 = lower(change.x0, x0);
+    change.y0 = lower(change.y0, y0);
+    change.x1 = upper(change.x1, x1);
+    change.y1 = upper(change.y1, y1);
+}
+
+bool LCDBandRenderer::addTextChange(const Op& op, const Op& prev) {
+    if (op.type != OpType::STRING || prev.type != OpType::STRING) return false;
+
+    // Both must be the same call on one line, other than the text
+    LENGTH width = _target->getWidth();
+    if (op.right == width || prev.right == width) return false;
+    Op x = op, y = prev;
+    x.text = 0;
+    y.text = 0;
+    x.right = 0;
+    y.right = 0;
+    if (memcmp(&x, &y, sizeof(Op)) != 0) return false;
+
+    // The characters between the first and the last that differ (the
+    // longer string's tail included) changed. A common tail only stays
+    // put if what comes before it is as wide in both strings.
+    const char* a = _text + op.text;
+    const char* b = _prevText + prev.text;
+    sFONT* font = op.font;
+    uint32_t first = 0;
+    while (a[first] != '\0' && a[first] == b[first]) first++;
+    uint32_t lengthA = first + strlen(a + first);
+    uint32_t lengthB = first + strlen(b + first);
+    uint32_t start = LCDFont::measure(font, a, first);
+    uint32_t endA = start + LCDFont::measure(font, a + first, lengthA - first);
+    uint32_t endB = start + LCDFont::measure(font, b + first, lengthB - first);
+    if (lengthA == lengthB && endA == endB) {
+        uint32_t last = lengthA;
+        while (last > first && a[last - 1] == b[last - 1]) last--;
+        endA -= LCDFont::measure(font, a + last, lengthA - last);
+        endB = endA;
+    }
+
+    // Text lands one pixel left of x0; at x0 = 0 that column is off screen
+    uint32_t end = (endA > endB) ? endA : endB;
+    int32_t left = (int32_t)op.x0 - 1 + (int32_t)start;
+    if (left < 0) left = 0;
+    addChange(left, op.top, op.x0 + end, op.bottom);
+    return true;
+}
+
+void LCDBandRenderer::findChanges() {
+    _changeCount = 0;
+
+    // Nothing to compare with (or every pixel may differ): send every call
+    bool all = !_prevValid || _prevBackground != _background;
+    if (all) {
+        for (uint16_t i = 0; i < _count; i++) {
+            addChange(_ops[i].left, _ops[i].top, _ops[i].right, _ops[i].bottom);
+        }
+        if (!_prevValid) return;
+
+        // What the last frame drew now shows the new background
+        for (uint16_t i = 0; i < _prevCount; i++) {
+            const Op& op = _prevOps[i];
+            addChange(op.left, op.top, op.right, op.bottom);
+        }
+        return;
+    }
+
+    // Pair up the calls both frames make, in order. A pixel outside every
+    // call left unpaired is drawn by the same calls as last time.
+    uint16_t i = 0, j = 0;
+    while (i < _count && j < _prevCount) {
+        if (sameOp(_ops[i], _text, _prevOps[j], _prevText)) {
+            i++;
+            j++;
+            continue;
+        }
+
+        // Calls that went away just before this one
+        uint16_t skip = 1;
+        while (skip <= MATCH_LOOKAHEAD && j + skip < _prevCount &&
+               !sameOp(_ops[i], _text, _prevOps[j + skip], _prevText)) {
+            skip++;
+        }
+        if (skip <= MATCH_LOOKAHEAD && j + skip < _prevCount) {
+            for (; skip > 0; skip--, j++) {
+                const Op& op = _prevOps[j];
+                addChange(op.left, op.top, op.right, op.bottom);
+            }
+            continue;
+        }
+
+        // The same one-line string with other text: only the characters
+        // that differ are drawn differently
+        if (addTextChange(_ops[i], _prevOps[j])) {
+            i++;
+            j++;
+            continue;
+        }
+
+        // A new or changed call
+        addChange(_ops[i].left, _ops[i].top, _ops[i].right, _ops[i].bottom);
+        i++;
+    }
+    for (; i < _count; i++) {
+        addChange(_ops[i].left, _ops[i].top, _ops[i].right, _ops[i].bottom);
+    }
+    for (; j < _prevCount; j++) {
+        const Op& op = _prevOps[j];
+        addChange(op.left, op.top, op.right, op.bottom);
+    }
+
+    // Where others drew over the scene, its own calls go out again
+    if (_damage.isEmpty()) return;
+    for (uint16_t i = 0; i < _count; i++) {
+        const Op& op = _ops[i];
+        addChange(upper(op.left, _damage.x0), upper(op.top, _damage.y0),
+                  lower(op.right, _damage.x1), lower(op.bottom, _damage.y1));
+    }
+}
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+
+bool LCDBandRenderer::renderDualCore() {
+    TaskHandle_t task;
+    BaseType_t core = xPortGetCoreID() ? 0 : 1;
+    if (xTaskCreatePinnedToCore(workerMain, "lcdband", 4096, this,
+                                uxTaskPriorityGet(nullptr), &task, core) != pdPASS) {
+        return false;
+    }
+
+    // The worker only touches the bands; this core owns the target, and
+    // hands a band back once the target no longer reads from it
+    LENGTH height = _target->getHeight();
+    _target->beginWrite();
+    for (POINT top = 0; top < height; top += _bandRows) {
+        uint8_t index;
+        xQueueReceive(_ready, &index, portMAX_DELAY);
+        _bands[index].flush(*_target, 0, 0);
+        _bands[index].waitIdle();
+        xSemaphoreGive(_free);
+    }
+    _target->endWrite();
+    return true;
+}
+
+void LCDBandRenderer::workerMain(void* arg) {
+    LCDBandRenderer* self = static_cast<LCDBandRenderer*>(arg);
+    LENGTH height = self->_target->getHeight();
+    LENGTH rows = self->_bandRows;
+
+    uint8_t next = 0;
+    for (POINT top = 0; top < height; top += rows) {
+        xSemaphoreTake(self->_free, portMAX_DELAY);
+        self->rasterize(self->_bands[next], top, 0, self->_target->getWidth());
+
+        // The last send may let render() return: 'self' is not used after it
+        QueueHandle_t ready = self->_ready;
+        xQueueSend(ready, &next, portMAX_DELAY);
+        next ^= 1;
+    }
+    vTaskDelete(nullptr);
+}
+
+#endif // ESP32 && !CONFIG_FREERTOS_UNICORE
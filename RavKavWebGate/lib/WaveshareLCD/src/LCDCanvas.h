@@ -0,0 +1,124 @@
+/*****************************************************************************
+ * | File        : LCDCanvas.h
+ * | Function    : Off-screen RGB565 drawing surface
+ * | Info        : Draw in RAM, then send the changed part to the panel
+ * |
+ * | A canvas supports every LCDSurface primitive. Nothing reaches the panel
+ * | until flush(), which sends the bounding box of everything drawn since
+ * | the last flush as a single blit. A widget can therefore clear and
+ * | redraw its area without the clear ever showing on screen.
+ * |
+ * | Usage:
+ * |   LCDCanvas canvas(200, 40);           // 16 KB from the heap
+ * |   canvas.clear(Colors::BLACK);
+ * |   canvas.drawString(10, 10, "42", &Font24, Colors::BLACK, Colors::WHITE);
+ * |   canvas.flush(lcd, 20, 100);          // to (20, 100) on the panel
+ * |
+ * | Canvas coordinates work exactly like the panel's, one-pixel offset of
+ * | the point primitives included, so a canvas placed at (x, y) shows the
+ * | same pixels as drawing directly with every coordinate moved by (x, y).
+ * |
+ * | The panel may still be reading the buffer after flush() returns. The
+ * | canvas waits for it before it is drawn into again.
+ * |
+ * | A band canvas has the size of a bigger surface but keeps only a strip of
+ * | its rows (see beginBand()). Drawing outside the strip is clipped, so a
+ * | scene can be rasterized one strip at a time with the same result.
+ *****************************************************************************/
+
+#ifndef __LCD_CANVAS_H
+#define __LCD_CANVAS_H
+
+#include <stdint.h>
+#include "LCDSurface.h"
+
+class LCDCanvas : public LCDSurface {
+public:
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+    LCDCanvas();
+    LCDCanvas(LENGTH width, LENGTH height, COLOR* buffer = nullptr);
+    ~LCDCanvas();
+
+    LCDCanvas(const LCDCanvas&) = delete;
+    LCDCanvas& operator=(const LCDCanvas&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Use 'buffer' (width * height pixels, native RGB565) or allocate one
+    // when it is nullptr. Returns false if the allocation failed.
+    bool begin(LENGTH width, LENGTH height, COLOR* buffer = nullptr);
+
+    // A width x height canvas that only stores 'rows' rows ('buffer' holds
+    // width * rows pixels), starting at row 0; move it with setBandTop()
+    bool beginBand(LENGTH width, LENGTH height, LENGTH rows, COLOR* buffer = nullptr);
+    void end();
+
+    bool isReady() const { return _buffer != nullptr; }
+    COLOR* getBuffer() { return _buffer; }
+    const COLOR* getBuffer() const { return _buffer; }
+
+    // Rows held in the buffer: [getBandTop(), getBandTop() + getBandRows())
+    void setBandTop(POINT top);
+    POINT getBandTop() const { return _top; }
+    LENGTH getBandRows() const { return _rows; }
+
+    //--------------------------------------------------------------------------
+    // Pixel sink
+    //--------------------------------------------------------------------------
+    void setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) override;
+    void setPixel(POINT x, POINT y, COLOR color) override;
+    void fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) override;
+    void pushPixels(const COLOR* pixels, uint32_t count, bool swapped = false) override;
+
+    // Wait until the last flush target is done with the buffer
+    void waitIdle() override;
+
+    //--------------------------------------------------------------------------
+    // Blending (LCDBlend), over what the canvas already holds
+    //--------------------------------------------------------------------------
+    // A translucent rectangle, alpha 0..255
+    void fillAreaAlpha(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                       COLOR color, uint8_t alpha);
+
+    // 'color' through a 4-bit coverage mask at (x, y): (width + 1) / 2
+    // bytes a row, the left pixel in the high nibble
+    void drawMask(POINT x, POINT y, const uint8_t* mask, LENGTH width, LENGTH height,
+                  COLOR color);
+
+    //--------------------------------------------------------------------------
+    // Dirty rectangle
+    //--------------------------------------------------------------------------
+    const LCDRect& getDirty() const { return _dirty; }
+    bool isDirty() const { return !_dirty.isEmpty(); }
+    void markDirty();
+    void markDirty(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd);
+    void clearDirty();
+
+    //--------------------------------------------------------------------------
+    // Output
+    //--------------------------------------------------------------------------
+    // Send the dirty rectangle to 'target', with the canvas origin at
+    // (x, y), and clear it
+    void flush(LCDSurface& target, POINT x, POINT y);
+
+private:
+    COLOR* _buffer;
+    bool _ownsBuffer;
+    LCDSurface* _reader;            // Last flush target, may still be sending
+    POINT _top;                     // First row held in the buffer
+    LENGTH _rows;
+
+    LCDRect _dirty;
+
+    // Window opened by setWindow(); may extend past the buffer
+    int32_t _winX0, _winY0, _winX1, _winY1;
+    int32_t _curX, _curY;
+
+    POINT bandEnd() const;
+    COLOR* rowAt(POINT y) { return _buffer + (uint32_t)(y - _top) * _info.width; }
+};
+
+#endif // __LCD_CANVAS_H
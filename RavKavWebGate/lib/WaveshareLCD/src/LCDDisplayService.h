@@ -0,0 +1,237 @@
+/*****************************************************************************
+ * | File        : LCDDisplayService.h
+ * | Function    : Display task fed by a lock-free command queue
+ * | Info        : Draws on the other core while loop() keeps going
+ * |
+ * | The service owns a WaveshareLCD while it runs. Drawing calls made on it
+ * | are recorded into a ring of fixed-size commands and return at once; a
+ * | FreeRTOS task pinned to the core loop() does not run on takes them out
+ * | and draws them. NFC polling, sensor reads and HTTP handling then no
+ * | longer wait for the SPI bus.
+ * |
+ * | Usage:
+ * |   LCDDisplayService display(lcd);
+ * |   lcd.begin();
+ * |   display.begin();                     // start the render task
+ * |   display.fillArea(0, 0, 480, 40, Colors::BLUE);
+ * |   display.drawString(10, 10, "Ready", &Font24, Colors::BLUE, Colors::WHITE);
+ * |   LCDDisplayService::Fence done = display.fence();
+ * |   ...                                  // keep polling, serving, ...
+ * |   display.wait(done);                  // everything before it is on the panel
+ * |
+ * | The queue has one producer (the task that calls the drawing methods)
+ * | and one consumer (the render task), so it needs no lock: each side
+ * | only writes its own index, published with release/acquire ordering.
+ * |
+ * | Strings are copied into a text ring next to the queue (one string may
+ * | take up to half of it). Bitmaps, pixel blocks and fonts are kept by
+ * | pointer: keep them alive (and unchanged) until a fence placed after
+ * | them completes.
+ * |
+ * | When the queue or the text ring is full, a call either waits for the
+ * | render task to catch up (Overflow::BLOCK, the default) or is dropped
+ * | and counted (Overflow::DROP), so a slow panel cannot grow memory or
+ * | stall a caller that would rather skip a frame.
+ * |
+ * | Without FreeRTOS (host builds) there is no task: poll() runs the
+ * | queued commands on the caller, and a full queue is drained inline.
+ * |
+ * | While the service runs, draw only through it. Anything it has no
+ * | command for can be queued as a job that runs on the render task.
+ *****************************************************************************/
+
+#ifndef __LCD_DISPLAY_SERVICE_H
+#define __LCD_DISPLAY_SERVICE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "WaveshareLCD.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+class LCDDisplayService {
+public:
+    static constexpr uint16_t DEFAULT_QUEUE_LENGTH = 64;    // commands
+    static constexpr size_t DEFAULT_TEXT_BYTES = 1024;
+    static constexpr uint16_t BATCH_COMMANDS = 16;          // per bus hold
+
+    // Identifies the point in the command stream where fence() was called
+    typedef uint32_t Fence;
+
+    // Code run on the render task with the panel
+    typedef void (*Job)(WaveshareLCD& lcd, void* context);
+
+    enum class Overflow : uint8_t { BLOCK, DROP };
+
+    explicit LCDDisplayService(WaveshareLCD& lcd);
+    ~LCDDisplayService();
+
+    LCDDisplayService(const LCDDisplayService&) = delete;
+    LCDDisplayService& operator=(const LCDDisplayService&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Allocate the queue (rounded up to a power of two) and the text ring,
+    // and start the render task. The panel must already be running.
+    // Returns false if the memory or the task cannot be had.
+    bool begin(uint16_t queueLength = DEFAULT_QUEUE_LENGTH,
+               size_t textBytes = DEFAULT_TEXT_BYTES, uint8_t priority = 1);
+
+    // Finish what is queued, then stop the task; the panel is the
+    // caller's again
+    void end();
+
+    bool isReady() const { return _ring != nullptr; }
+
+    // A render task is running (false on the host: use poll())
+    bool isThreaded() const;
+
+    WaveshareLCD& getLCD() { return _lcd; }
+
+    //--------------------------------------------------------------------------
+    // Back-pressure
+    //--------------------------------------------------------------------------
+    void setOverflow(Overflow overflow) { _overflow = overflow; }
+    Overflow getOverflow() const { return _overflow; }
+
+    uint16_t getPending() const;
+    uint16_t getHighWater() const { return _highWater; }   // most ever pending
+    uint32_t getStalls() const { return _stalls; }         // calls that waited
+    uint32_t getDropped() const { return _dropped; }       // calls dropped
+
+    //--------------------------------------------------------------------------
+    // Drawing, as on LCDSurface. Each returns false if the call was dropped.
+    //--------------------------------------------------------------------------
+    bool clear(COLOR color = LCD_BACKGROUND);
+    bool fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color);
+
+    bool drawPoint(POINT x, POINT y, COLOR color,
+                   DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                   DotStyle dotStyle = DOT_STYLE_DEFAULT);
+
+    bool drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                  COLOR color,
+                  LineStyle lineStyle = LineStyle::SOLID,
+                  DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    bool drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                       COLOR color,
+                       DrawFill fill = DrawFill::EMPTY,
+                       DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                       LineStyle lineStyle = LineStyle::SOLID);
+
+    bool drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                    COLOR color,
+                    DrawFill fill = DrawFill::EMPTY,
+                    DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    bool drawChar(POINT x, POINT y, char ch,
+                  sFONT* font,
+                  COLOR bgColor, COLOR fgColor);
+
+    bool drawString(POINT x, POINT y, const char* str,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    bool drawNumber(POINT x, POINT y, int32_t number,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    bool drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                    POINT width, POINT height);
+
+    bool blit(POINT x, POINT y, LENGTH width, LENGTH height,
+              const COLOR* pixels, bool swapped = false);
+
+    bool setBacklight(uint16_t value);
+
+    // Copy 'text' and write it to 'out' (an LCDConsole, say) on the render task
+    bool print(Print& out, const char* text);
+
+    // Run 'job' on the render task, in order with the drawing calls
+    bool run(Job job, void* context);
+
+    //--------------------------------------------------------------------------
+    // Fences
+    //--------------------------------------------------------------------------
+    // Mark the current end of the stream. It completes once every call
+    // made before it is drawn and its pixels have left the bus.
+    Fence fence();
+    bool isComplete(Fence fence) const;
+
+    // Wait for 'fence' to complete; false on timeout
+    bool wait(Fence fence, uint32_t timeoutMs = UINT32_MAX);
+
+    // fence() + wait()
+    void sync();
+
+    // Run queued commands on the calling task (only without a render task)
+    void poll();
+
+private:
+    enum class CommandType : uint8_t {
+        CLEAR, FILL, DOT, LINE, RECT, CIRCLE, CHAR, STRING, NUMBER,
+        BITMAP, BLIT, BACKLIGHT, PRINT, JOB, FENCE
+    };
+
+    struct Command {
+        CommandType type;
+        uint8_t style[3];           // DrawFill / DotPixel / LineStyle / DotStyle
+        POINT x0, y0, x1, y1;
+        COLOR color, color2;
+        sFONT* font;
+        union {
+            const void* data;       // BITMAP, BLIT
+            uint32_t text;          // STRING, PRINT: offset into _text
+            int32_t number;         // NUMBER, CHAR
+            Fence fence;            // FENCE
+            Job job;                // JOB
+        };
+        void* context;              // JOB, PRINT (the Print target)
+        uint32_t textEnd;           // Text ring position after this command
+    };
+
+    WaveshareLCD& _lcd;
+    Overflow _overflow;
+
+    // Command ring: _head is written by the producer, _tail by the consumer
+    Command* _ring;
+    uint16_t _mask;
+    std::atomic<uint32_t> _head;
+    std::atomic<uint32_t> _tail;
+
+    // Text ring, with free-running positions like the command ring
+    char* _text;
+    uint32_t _textSize;             // Power of two
+    uint32_t _textHead;             // Producer only
+    std::atomic<uint32_t> _textTail;
+
+    Fence _fenceIssued;             // Producer only
+    std::atomic<uint32_t> _fenceDone;
+
+    uint16_t _highWater;
+    uint32_t _stalls;
+    uint32_t _dropped;
+
+    Command* reserve(CommandType type, bool droppable = true);
+    Command* reserveText(CommandType type, const char* text);
+    bool waitForSpace(uint32_t textBytes, bool droppable);
+    void publish();
+    bool drain();
+    void execute(const Command& command);
+
+#if defined(ESP32)
+    TaskHandle_t _task;
+    volatile bool _stopping;
+    SemaphoreHandle_t _progress;    // Given after every batch
+
+    static void taskMain(void* arg);
+#endif
+};
+
+#endif // __LCD_DISPLAY_SERVICE_H
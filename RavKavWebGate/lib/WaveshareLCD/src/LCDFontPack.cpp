@@ -0,0 +1,412 @@
+/*****************************************************************************
+ * | File        : LCDFontPack.cpp
+ * | Function    : Converts sFONT tables into packed fonts
+ *****************************************************************************/
+
+#include "LCDFontPack.h"
+#include "LCDGlyphReader.h"
+#include <stdlib.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Encoders
+//------------------------------------------------------------------------------
+namespace {
+    constexpr uint32_t MAX_CELL_BYTES = 64 * 64 / 8;
+
+    // Part of a source cell, in its pixels
+    struct Box {
+        uint16_t left, top, width, height;
+    };
+
+    inline bool bitAt(const uint8_t* bits, uint32_t bit) {
+        return bits[bit / 8] & (0x80 >> (bit % 8));
+    }
+
+    // The glyph's Width x Height cell as raw bits, row after row
+    void readCell(const sFONT& font, char ch, uint8_t* cell) {
+        memset(cell, 0, ((uint32_t)font.Width * font.Height + 7) / 8);
+
+        LCDGlyphReader glyph;
+        glyph.begin(&font, ch);
+        uint32_t bit = 0;
+        for (uint16_t row = 0; row < font.Height; row++) {
+            for (uint16_t col = 0; col < font.Width; ) {
+                bool set;
+                uint16_t count = glyph.run(font.Width - col, set);
+                for (col += count; count > 0; count--, bit++) {
+                    if (set) cell[bit / 8] |= 0x80 >> (bit % 8);
+                }
+            }
+        }
+    }
+
+    // Smallest box around the set pixels; 0 x 0 for a blank glyph
+    Box inkBox(const sFONT& font, const uint8_t* cell) {
+        uint16_t left = font.Width, right = 0, top = font.Height, bottom = 0;
+        for (uint16_t row = 0; row < font.Height; row++) {
+            for (uint16_t col = 0; col < font.Width; col++) {
+                if (!bitAt(cell, (uint32_t)row * font.Width + col)) continue;
+                if (col < left) left = col;
+                if (col + 1 > right) right = col + 1;
+                if (row < top) top = row;
+                if (row + 1 > bottom) bottom = row + 1;
+            }
+        }
+        if (right == 0) return Box{ 0, 0, 0, 0 };
+        return Box{ left, top, (uint16_t)(right - left), (uint16_t)(bottom - top) };
+    }
+
+    uint32_t rawBytes(const Box& box) {
+        return ((uint32_t)box.width * box.height + 7) / 8;
+    }
+
+    // Raw bits of the box, row after row; returns the bytes written
+    uint32_t packRaw(const uint8_t* cell, uint16_t stride, const Box& box, uint8_t* out) {
+        uint32_t bytes = rawBytes(box);
+        memset(out, 0, bytes);
+
+        uint32_t bit = 0;
+        for (uint16_t row = 0; row < box.height; row++) {
+            uint32_t from = (uint32_t)(box.top + row) * stride + box.left;
+            for (uint16_t col = 0; col < box.width; col++, bit++) {
+                if (bitAt(cell, from + col)) out[bit / 8] |= 0x80 >> (bit % 8);
+            }
+        }
+        return bytes;
+    }
+
+    // Run lengths in nibbles; returns the bytes written, or 0 if that
+    // would reach 'limit'
+    uint32_t packRuns(const uint8_t* cell, uint16_t stride, const Box& box,
+                      uint8_t* out, uint32_t limit) {
+        uint32_t nibbles = 0;
+        auto put = [&](uint8_t v) -> bool {
+            if (nibbles / 2 >= limit) return false;
+            if (nibbles & 1) {
+                out[nibbles / 2] |= v;
+            } else {
+                out[nibbles / 2] = v << 4;
+            }
+            nibbles++;
+            return true;
+        };
+
+        // Runs cross rows; they alternate clear / set starting with clear
+        bool color = false;
+        uint32_t length = 0;
+        for (uint16_t row = 0; row < box.height; row++) {
+            uint32_t from = (uint32_t)(box.top + row) * stride + box.left;
+            for (uint16_t col = 0; col < box.width; col++) {
+                bool set = bitAt(cell, from + col);
+                if (set != color) {
+                    for (; length >= 15; length -= 15) {
+                        if (!put(15)) return 0;
+                    }
+                    if (!put((uint8_t)length)) return 0;
+                    color = set;
+                    length = 0;
+                }
+                length++;
+            }
+        }
+        for (; length >= 15; length -= 15) {
+            if (!put(15)) return 0;
+        }
+        if (length > 0 && !put((uint8_t)length)) return 0;
+
+        uint32_t bytes = (nibbles + 1) / 2;
+        return bytes < limit ? bytes : 0;
+    }
+
+    bool included(const LCDFontPack::Options& options, uint8_t code) {
+        return options.chars == nullptr || strchr(options.chars, (char)code) != nullptr;
+    }
+
+    bool isDigit(uint8_t code) {
+        return code >= '0' && code <= '9';
+    }
+}
+
+//------------------------------------------------------------------------------
+// Packing
+//------------------------------------------------------------------------------
+bool LCDFontPack::range(const Options& options, uint8_t& first, uint8_t& last) {
+    if (options.chars == nullptr) {
+        first = (uint8_t)options.first;
+        last = (uint8_t)options.last;
+        return first <= last && first >= ' ';
+    }
+    first = 0xFF;
+    last = 0;
+    for (const char* c = options.chars; *c != '\0'; c++) {
+        if ((uint8_t)*c < first) first = (uint8_t)*c;
+        if ((uint8_t)*c > last) last = (uint8_t)*c;
+    }
+    return first <= last && first >= ' ';
+}
+
+bool LCDFontPack::pack(const sFONT& font, sPACKED& packed, uint8_t* data, uint32_t capacity,
+                       uint16_t* offsets, Stats& stats, char first, char last, bool rle) {
+    Options options;
+    options.first = first;
+    options.last = last;
+    options.rle = rle;
+    return pack(font, packed, data, capacity, offsets, nullptr, nullptr, stats, options);
+}
+
+bool LCDFontPack::pack(const sFONT& font, sPACKED& packed, uint8_t* data, uint32_t capacity,
+                       uint16_t* offsets, uint8_t* map, sGLYPH* glyphs,
+                       Stats& stats, const Options& options) {
+    memset(&stats, 0, sizeof(stats));
+    uint8_t first, last;
+    uint32_t cellBytes = ((uint32_t)font.Width * font.Height + 7) / 8;
+    if (font.table == nullptr || !range(options, first, last) || cellBytes > MAX_CELL_BYTES ||
+        (options.chars != nullptr && map == nullptr) ||
+        (options.proportional && glyphs == nullptr)) {
+        return false;
+    }
+
+    uint8_t cell[MAX_CELL_BYTES];
+    uint16_t bytesPerRow = font.Width / 8 + (font.Width % 8 ? 1 : 0);
+    Box full = { 0, 0, font.Width, font.Height };
+
+    // Digits share one advance so numbers do not shift as they change
+    uint16_t digitWidth = 0;
+    if (options.proportional && options.tabularDigits) {
+        for (uint8_t code = '0'; code <= '9'; code++) {
+            if (code < first || code > last || !included(options, code)) continue;
+            readCell(font, (char)code, cell);
+            Box ink = inkBox(font, cell);
+            if (ink.width > digitWidth) digitWidth = ink.width;
+        }
+    }
+
+    stats.width = options.proportional ? 0 : font.Width;
+    uint32_t used = 0;
+    for (uint16_t code = first; code <= last; code++) {
+        if (!included(options, (uint8_t)code)) {
+            map[code - first] = PACKED_NO_GLYPH;
+            continue;
+        }
+        uint16_t index = stats.glyphs++;
+        if (options.chars != nullptr) {
+            if (index >= PACKED_NO_GLYPH) return false;
+            map[code - first] = (uint8_t)index;
+        }
+
+        readCell(font, (char)code, cell);
+        Box box = full;
+        if (options.proportional) {
+            // The ink alone, then the spacing; a blank glyph is a gap
+            box = inkBox(font, cell);
+            uint16_t inkWidth = box.width;
+            uint16_t left = 0;
+            if (box.width == 0) {
+                inkWidth = font.Width / 2;
+            } else if (digitWidth > 0 && isDigit((uint8_t)code)) {
+                left = (digitWidth - box.width) / 2;
+                inkWidth = digitWidth;
+            }
+            uint16_t advance = inkWidth + (box.width > 0 ? options.spacing : 0);
+            if (advance > 0xFF) return false;
+            glyphs[index] = sGLYPH{ (uint8_t)advance, (uint8_t)left, (uint8_t)box.top,
+                                    (uint8_t)box.width, (uint8_t)box.height };
+            if (advance > stats.width) stats.width = advance;
+        }
+
+        uint32_t raw = rawBytes(box);
+        if (used + raw > capacity || used >= PACKED_RLE_FLAG) {
+            return false;
+        }
+        uint32_t bytes = options.rle ? packRuns(cell, font.Width, box, data + used, raw) : 0;
+        if (options.rle || options.proportional) {
+            offsets[index] = used | (bytes > 0 ? PACKED_RLE_FLAG : 0);
+        }
+        if (bytes > 0) {
+            stats.rleGlyphs++;
+        } else {
+            bytes = packRaw(cell, font.Width, box, data + used);
+        }
+        used += bytes;
+        stats.tableBytes += (uint32_t)font.Height * bytesPerRow;
+    }
+
+    // Runs that do not pay for the offsets table: all raw, found by index.
+    // Proportional glyphs differ in size and always need the offsets.
+    uint32_t offsetBytes = (stats.glyphs + 1) * sizeof(uint16_t);
+    if (!options.proportional && stats.rleGlyphs > 0 &&
+        used + offsetBytes >= stats.glyphs * cellBytes) {
+        Options raw = options;
+        raw.rle = false;
+        return pack(font, packed, data, capacity, offsets, map, glyphs, stats, raw);
+    }
+
+    packed.offsets = nullptr;
+    if (stats.rleGlyphs > 0 || options.proportional) {
+        offsets[stats.glyphs] = used;
+        packed.offsets = offsets;
+        stats.offsetBytes = offsetBytes;
+    }
+    packed.data = data;
+    packed.First = first;
+    packed.Last = last;
+    packed.Map = options.chars != nullptr ? map : nullptr;
+    packed.Glyphs = options.proportional ? glyphs : nullptr;
+    if (packed.Map != nullptr) stats.mapBytes = last - first + 1;
+    if (packed.Glyphs != nullptr) stats.glyphBytes = stats.glyphs * sizeof(sGLYPH);
+    stats.dataBytes = used;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// C source
+//------------------------------------------------------------------------------
+bool LCDFontPack::writeSource(Print& out, const sFONT& font, const char* name,
+                              char first, char last, bool rle) {
+    Options options;
+    options.first = first;
+    options.last = last;
+    options.rle = rle;
+    return writeSource(out, font, name, options);
+}
+
+bool LCDFontPack::writeSource(Print& out, const sFONT& font, const char* name,
+                              const Options& options) {
+    uint8_t first, last;
+    if (!range(options, first, last)) return false;
+    uint16_t codes = last - first + 1;
+    uint32_t capacity = maxDataBytes(font, (char)first, (char)last);
+    uint8_t* data = (uint8_t*)malloc(capacity);
+    uint16_t* offsets = (uint16_t*)malloc((codes + 1) * sizeof(uint16_t));
+    uint8_t* map = (uint8_t*)malloc(codes);
+    sGLYPH* glyphs = (sGLYPH*)malloc(codes * sizeof(sGLYPH));
+    sPACKED packed;
+    Stats stats;
+    bool ok = data != nullptr && offsets != nullptr && map != nullptr && glyphs != nullptr &&
+              pack(font, packed, data, capacity, offsets, map, glyphs, stats, options);
+    if (!ok) {
+        free(data);
+        free(offsets);
+        free(map);
+        free(glyphs);
+        return false;
+    }
+
+    // Character of each glyph
+    char chars[256];
+    for (uint16_t code = first; code <= last; code++) {
+        uint16_t index = LCDFont::glyphIndex(&packed, (char)code);
+        if (index != LCDFont::NO_GLYPH) chars[index] = (char)code;
+    }
+
+    if (options.chars != nullptr) {
+        // The characters in code order, without closing the comment
+        out.printf("/* %s: %ux%u, \"", name, stats.width, font.Height);
+        for (uint16_t i = 0; i < stats.glyphs; i++) {
+            bool close = chars[i] == '*' && i + 1 < stats.glyphs && chars[i + 1] == '/';
+            out.printf(close ? "*\\" : "%c", chars[i]);
+        }
+        out.printf("\", packed by LCDFontPack::writeSource().\n");
+    } else {
+        out.printf("/* %s: %ux%u, '%c'..'%c', packed by LCDFontPack::writeSource().\n",
+                   name, stats.width, font.Height, first, last);
+    }
+    if (packed.Glyphs != nullptr) {
+        out.printf("   Proportional, from the %ux%u table font.\n", font.Width, font.Height);
+    }
+    out.printf("   %lu bytes of glyphs and %lu of offsets; the table had %lu.\n",
+               (unsigned long)stats.dataBytes, (unsigned long)stats.offsetBytes,
+               (unsigned long)stats.tableBytes);
+    if (stats.mapBytes + stats.glyphBytes > 0) {
+        out.printf("   %lu bytes of character map and %lu of glyph metrics.\n",
+                   (unsigned long)stats.mapBytes, (unsigned long)stats.glyphBytes);
+    }
+    out.printf("   %u of %u glyphs are run-length coded. */\n\n",
+               stats.rleGlyphs, stats.glyphs);
+    out.printf("#include \"fonts.h\"\n\n");
+
+    out.printf("const uint8_t %s_Data[] =\n{\n", name);
+    for (uint16_t i = 0; i < stats.glyphs; i++) {
+        uint32_t start, end;
+        bool runs = false;
+        if (packed.offsets != nullptr) {
+            start = offsets[i] & ~PACKED_RLE_FLAG;
+            end = offsets[i + 1] & ~PACKED_RLE_FLAG;
+            runs = (offsets[i] & PACKED_RLE_FLAG) != 0;
+        } else {
+            start = i * (stats.dataBytes / stats.glyphs);
+            end = start + stats.dataBytes / stats.glyphs;
+        }
+        out.printf("\t// @%lu '%c'%s\n", (unsigned long)start, chars[i], runs ? " (runs)" : "");
+        for (uint32_t b = start; b < end; b++) {
+            const char* separator = " ";
+            if (b + 1 == end) {
+                separator = "\n";
+            } else if ((b - start) % 12 == 11) {
+                separator = "\n\t";
+            }
+            out.printf("%s0x%02X,%s", b == start ? "\t" : "", data[b], separator);
+        }
+    }
+    out.printf("};\n\n");
+
+    if (packed.offsets != nullptr) {
+        out.printf("const uint16_t %s_Offsets[] =\n{", name);
+        for (uint16_t i = 0; i <= stats.glyphs; i++) {
+            out.printf("%s0x%04X,", i % 8 == 0 ? "\n\t" : " ", offsets[i]);
+        }
+        out.printf("\n};\n\n");
+    }
+
+    if (packed.Map != nullptr) {
+        out.printf("const uint8_t %s_Map[] =\n{", name);
+        for (uint16_t i = 0; i < codes; i++) {
+            out.printf("%s0x%02X,", i % 12 == 0 ? "\n\t" : " ", map[i]);
+        }
+        out.printf("\n};\n\n");
+    }
+
+    if (packed.Glyphs != nullptr) {
+        out.printf("/* Advance, Left, Top, Width, Height */\n");
+        out.printf("const sGLYPH %s_Glyphs[] =\n{\n", name);
+        for (uint16_t i = 0; i < stats.glyphs; i++) {
+            const sGLYPH& g = glyphs[i];
+            out.printf("\t{ %2u, %2u, %2u, %2u, %2u }, // '%c'\n",
+                       g.Advance, g.Left, g.Top, g.Width, g.Height, chars[i]);
+        }
+        out.printf("};\n\n");
+    }
+
+    out.printf("const sPACKED %s_Packed = {\n", name);
+    out.printf("  %s_Data,\n", name);
+    if (packed.offsets != nullptr) {
+        out.printf("  %s_Offsets,\n", name);
+    } else {
+        out.printf("  0, /* Every glyph raw */\n");
+    }
+    out.printf("  %u, /* First */\n  %u, /* Last */\n", packed.First, packed.Last);
+    if (packed.Map != nullptr || packed.Glyphs != nullptr) {
+        if (packed.Map != nullptr) {
+            out.printf("  %s_Map,\n", name);
+        } else {
+            out.printf("  0, /* Every character First..Last */\n");
+        }
+        if (packed.Glyphs != nullptr) {
+            out.printf("  %s_Glyphs,\n", name);
+        } else {
+            out.printf("  0, /* Fixed width */\n");
+        }
+    }
+    out.printf("};\n\n");
+
+    out.printf("sFONT %s = {\n", name);
+    out.printf("  0,\n  %u, /* Width */\n  %u, /* Height */\n  &%s_Packed,\n};\n",
+               stats.width, font.Height, name);
+
+    free(data);
+    free(offsets);
+    free(map);
+    free(glyphs);
+    return true;
+}
@@ -0,0 +1,299 @@
+/*****************************************************************************
+ * | File        : LCDIndexedCanvas.cpp
+ * | Function    : Off-screen drawing surface with 4-bit palette colors
+ *****************************************************************************/
+
+#include "LCDIndexedCanvas.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+    // The twelve different Colors:: values, then room for the app's own
+    const COLOR DEFAULT_PALETTE[LCDIndexedCanvas::PALETTE_SIZE] = {
+        Colors::BLACK, Colors::WHITE, Colors::RED, Colors::GREEN,
+        Colors::BLUE, Colors::GRED, Colors::BRED, Colors::GBLUE,
+        Colors::CYAN, Colors::BROWN, Colors::BRRED, Colors::GRAY,
+        Colors::BLACK, Colors::BLACK, Colors::BLACK, Colors::BLACK,
+    };
+
+    inline uint16_t toWire(COLOR color) {
+        return (uint16_t)((color << 8) | (color >> 8));
+    }
+
+    // Squared distance with red and blue scaled to green's 6 bits
+    inline uint32_t distance(COLOR a, COLOR b) {
+        int32_t dr = ((a >> 11) - (b >> 11)) * 2;
+        int32_t dg = ((a >> 5) & 0x3F) - ((b >> 5) & 0x3F);
+        int32_t db = ((a & 0x1F) - (b & 0x1F)) * 2;
+        return dr * dr + dg * dg + db * db;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+LCDIndexedCanvas::LCDIndexedCanvas()
+    : _buffer(nullptr), _ownsBuffer(false), _reader(nullptr),
+      _lastColor(DEFAULT_PALETTE[0]), _lastIndex(0),
+      _winX0(0), _winY0(0), _winX1(1), _winY1(1), _curX(0), _curY(0) {
+    setPalette(DEFAULT_PALETTE, PALETTE_SIZE);
+    clearDirty();
+}
+
+LCDIndexedCanvas::LCDIndexedCanvas(LENGTH width, LENGTH height, uint8_t* buffer)
+    : LCDIndexedCanvas() {
+    begin(width, height, buffer);
+}
+
+LCDIndexedCanvas::~LCDIndexedCanvas() {
+    end();
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+
+bool LCDIndexedCanvas::begin(LENGTH width, LENGTH height, uint8_t* buffer) {
+    end();
+    if (width == 0 || height == 0 || height > MAX_HEIGHT) return false;
+
+    size_t bytes = (size_t)(((uint32_t)width + 1) / 2) * height;
+    if (buffer == nullptr) {
+        buffer = (uint8_t*)malloc(bytes);
+        if (buffer == nullptr) return false;
+        _ownsBuffer = true;
+    }
+    _buffer = buffer;
+    _info.width = width;
+    _info.height = height;
+    memset(_buffer, 0, bytes);
+    for (LENGTH y = 0; y < height; y++) _rowEntries[y] = 1;
+    setWindow(0, 0, width, height);
+    markDirty();
+    return true;
+}
+
+void LCDIndexedCanvas::end() {
+    waitIdle();
+    if (_ownsBuffer) free(_buffer);
+    _buffer = nullptr;
+    _ownsBuffer = false;
+    _info.width = 0;
+    _info.height = 0;
+    clearDirty();
+}
+
+//------------------------------------------------------------------------------
+// Palette
+//------------------------------------------------------------------------------
+
+void LCDIndexedCanvas::setPalette(const COLOR* colors, uint8_t count) {
+    if (count > PALETTE_SIZE) count = PALETTE_SIZE;
+
+    waitIdle();
+    for (uint8_t i = 0; i < count; i++) _palette[i] = colors[i];
+    for (uint16_t byte = 0; byte < 256; byte++) {
+        uint16_t pair[2] = { toWire(_palette[byte >> 4]), toWire(_palette[byte & 0x0F]) };
+        memcpy(&_pairs[byte], pair, sizeof(pair));
+    }
+    _lastColor = _palette[0];
+    _lastIndex = 0;
+    markDirty();
+}
+
+void LCDIndexedCanvas::setPaletteColor(uint8_t index, COLOR color) {
+    index &= 0x0F;
+    if (_palette[index] == color) return;
+
+    waitIdle();
+    _palette[index] = color;
+    updatePairs(index);
+    _lastColor = _palette[0];
+    _lastIndex = 0;
+
+    // Only the rows drawn with this entry look different
+    uint16_t bit = 1u << index;
+    for (POINT y = 0; y < _info.height; y++) {
+        if (_rowEntries[y] & bit) _dirtyRows[y >> 5] |= 1u << (y & 31);
+    }
+}
+
+void LCDIndexedCanvas::updatePairs(uint8_t index) {
+    uint16_t wire = toWire(_palette[index]);
+    for (uint8_t other = 0; other < PALETTE_SIZE; other++) {
+        uint16_t first[2] = { wire, toWire(_palette[other]) };
+        uint16_t second[2] = { toWire(_palette[other]), wire };
+        memcpy(&_pairs[(index << 4) | other], first, sizeof(first));
+        memcpy(&_pairs[(other << 4) | index], second, sizeof(second));
+    }
+    uint16_t both[2] = { wire, wire };
+    memcpy(&_pairs[(index << 4) | index], both, sizeof(both));
+}
+
+uint8_t LCDIndexedCanvas::findColor(COLOR color) {
+    if (color == _lastColor) return _lastIndex;
+
+    uint8_t best = 0;
+    uint32_t bestDistance = UINT32_MAX;
+    for (uint8_t i = 0; i < PALETTE_SIZE && bestDistance > 0; i++) {
+        uint32_t d = distance(color, _palette[i]);
+        if (d < bestDistance) {
+            best = i;
+            bestDistance = d;
+        }
+    }
+    _lastColor = color;
+    _lastIndex = best;
+    return best;
+}
+
+//------------------------------------------------------------------------------
+// Pixel sink
+//------------------------------------------------------------------------------
+
+void LCDIndexedCanvas::setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) {
+    // Same exclusive end as the panel; an empty window still takes a pixel
+    _winX0 = xStart;
+    _winY0 = yStart;
+    _winX1 = (xEnd > xStart) ? xEnd : xStart + 1;
+    _winY1 = (yEnd > yStart) ? yEnd : yStart + 1;
+    _curX = _winX0;
+    _curY = _winY0;
+}
+
+void LCDIndexedCanvas::writeIndex(POINT x, POINT y, uint8_t index) {
+    uint8_t* p = rowAt(y) + x / 2;
+    *p = (x & 1) ? (uint8_t)((*p & 0xF0) | index) : (uint8_t)((*p & 0x0F) | (index << 4));
+    _rowEntries[y] |= 1u << index;
+    _dirtyRows[y >> 5] |= 1u << (y & 31);
+}
+
+void LCDIndexedCanvas::setPixel(POINT x, POINT y, COLOR color) {
+    if (_buffer == nullptr || x >= _info.width || y >= _info.height) return;
+
+    waitIdle();
+    writeIndex(x, y, findColor(color));
+}
+
+void LCDIndexedCanvas::fillRow(POINT y, POINT xStart, POINT xEnd, uint8_t index) {
+    uint8_t* row = rowAt(y);
+    if (xStart == 0 && xEnd == _info.width) {
+        _rowEntries[y] = 0;
+    }
+    if (xStart & 1) {
+        row[xStart / 2] = (row[xStart / 2] & 0xF0) | index;
+        xStart++;
+    }
+    if (xStart < xEnd) {
+        uint32_t bytes = (xEnd - xStart) / 2;
+        memset(row + xStart / 2, index * 0x11, bytes);
+        if ((xEnd - xStart) & 1) {
+            uint8_t* last = row + xStart / 2 + bytes;
+            *last = (*last & 0x0F) | (index << 4);
+        }
+    }
+    _rowEntries[y] |= 1u << index;
+    _dirtyRows[y >> 5] |= 1u << (y & 31);
+}
+
+void LCDIndexedCanvas::fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) {
+    if (_buffer == nullptr) return;
+    if (xEnd > _info.width) xEnd = _info.width;
+    if (yEnd > _info.height) yEnd = _info.height;
+    if (xEnd <= xStart || yEnd <= yStart) return;
+
+    waitIdle();
+    uint8_t index = findColor(color);
+    for (POINT y = yStart; y < yEnd; y++) fillRow(y, xStart, xEnd, index);
+}
+
+void LCDIndexedCanvas::pushPixels(const COLOR* pixels, uint32_t count, bool swapped) {
+    if (_buffer == nullptr || pixels == nullptr || count == 0) return;
+
+    waitIdle();
+    while (count > 0) {
+        // Rest of the current window row; the part off the buffer is dropped
+        uint32_t run = _winX1 - _curX;
+        if (run > count) run = count;
+
+        if (_curY < _info.height && _curX < _info.width) {
+            uint32_t visible = _info.width - _curX;
+            if (visible > run) visible = run;
+            for (uint32_t i = 0; i < visible; i++) {
+                COLOR color = swapped ? toWire(pixels[i]) : pixels[i];
+                writeIndex(_curX + i, _curY, findColor(color));
+            }
+        }
+
+        pixels += run;
+        count -= run;
+        _curX += run;
+        if (_curX == _winX1) {
+            // Wrap like the panel: next row, then back to the top
+            _curX = _winX0;
+            if (++_curY == _winY1) _curY = _winY0;
+        }
+    }
+}
+
+void LCDIndexedCanvas::waitIdle() {
+    if (_reader != nullptr) {
+        _reader->waitIdle();
+        _reader = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Dirty rows
+//------------------------------------------------------------------------------
+
+bool LCDIndexedCanvas::isDirty() const {
+    for (uint8_t i = 0; i < sizeof(_dirtyRows) / sizeof(_dirtyRows[0]); i++) {
+        if (_dirtyRows[i] != 0) return true;
+    }
+    return false;
+}
+
+void LCDIndexedCanvas::markDirty() {
+    markDirty(0, _info.height);
+}
+
+void LCDIndexedCanvas::markDirty(POINT yStart, POINT yEnd) {
+    if (yEnd > _info.height) yEnd = _info.height;
+    for (POINT y = yStart; y < yEnd; y++) _dirtyRows[y >> 5] |= 1u << (y & 31);
+}
+
+void LCDIndexedCanvas::clearDirty() {
+    memset(_dirtyRows, 0, sizeof(_dirtyRows));
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+
+void LCDIndexedCanvas::flush(LCDSurface& target, POINT x, POINT y) {
+    if (_buffer == nullptr || &target == this) return;
+
+    target.beginWrite();
+    POINT row = 0;
+    while (row < _info.height) {
+        if (!isRowDirty(row)) {
+            row++;
+            continue;
+        }
+        // An odd width starts every row on a new byte: one row at a time
+        POINT end = row + 1;
+        if ((_info.width & 1) == 0) {
+            while (end < _info.height && isRowDirty(end)) end++;
+        }
+        target.setWindow(x, y + row, x + _info.width, y + end);
+        target.pushIndexed(rowAt(row), (uint32_t)_info.width * (end - row), _pairs);
+        row = end;
+    }
+    target.endWrite();
+    clearDirty();
+
+    // Queued rows still point into the buffer and the palette
+    _reader = &target;
+}
@@ -7,9 +7,11 @@
 #include <WebServer.h>
 
 #include "WaveShare.h"
+#include "GateScreen.h"
 #include "secrets.h"
 
 WaveShare screen;
+GateScreen gateScreen(screen);
 
 // #define AP
 
@@ -39,6 +41,16 @@ const char* SHENKAR_LOGO_DATAURI =
 
 MFRC522 mfrc522(SS_PIN, RST_PIN);  // Create MFRC522 instance
 
+// The reader shares the SPI bus with the LCD and touch controller. Its
+// library sets up its own SPI transactions, so it joins without settings.
+SPIBus::Device cardReader = SPIBus::NO_DEVICE;
+
+// Holds the bus for one card session
+struct CardSession {
+  CardSession() { SPIBus::shared().acquire(cardReader); }
+  ~CardSession() { SPIBus::shared().release(cardReader); }
+};
+
 const byte BUDGET_BLOCK = 4;
 MFRC522::MIFARE_Key key;
 
@@ -67,6 +79,7 @@ bool selectAndAuth(byte block) {
 }
 
 bool writeBudget(int budget) {
+  CardSession session;
   if (!selectAndAuth(BUDGET_BLOCK)) return false;
 
   byte buffer[16];
@@ -94,6 +107,7 @@ bool writeBudget(int budget) {
 }
 
 int readBudget(bool &ok) {
+  CardSession session;
   ok = false;
   if (!selectAndAuth(BUDGET_BLOCK)) return 0;
 
@@ -132,6 +146,7 @@ int readBudget(bool &ok) {
 
 // Read current budget, add amountToAdd (capped at 9999), and write back - all in one session
 bool readAddWriteBudget(int amountToAdd, int &newBudget) {
+  CardSession session;
   if (!selectAndAuth(BUDGET_BLOCK)) return false;
 
   // Read current budget
@@ -357,21 +372,6 @@ void handleRavkavLoad() {
   redirectToControl();
 }
 
-void showLeftOnLCD() {
-  screen.fillScreen(Colors::WHITE);
-
-  screen.drawTextCentered(0, 60, screen.getWidth(), 80,
-                          "LEFT", &Font24,
-                          Colors::WHITE, Colors::BLACK);
-
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", lastBudget);
-
-  screen.drawTextCentered(0, 150, screen.getWidth(), 100,
-                          buf, &Font24,
-                          Colors::WHITE, Colors::BLACK);
-}
-
 void handleRavkavRead() {
   if (!loggedIn) { server.send(403, "text/plain", "Forbidden"); return; }
 
@@ -442,27 +442,21 @@ void setup() {
 
   // --- MFRC522 and screen setup ---
   Serial.println("Initializing MFRC522...");
-  SPI.begin();			// Init SPI bus
-  
-  screen.begin();
-  screen.fillScreen(Colors::WHITE);
-  screen.drawTextCentered(0, 20, screen.getWidth(), 30,
-                          "READY", &Font24,
-                          Colors::WHITE, Colors::BLACK);
-  screen.drawTextCentered(0, 60, screen.getWidth(), 30,
-                          "Load budget at:", &Font24,
-                          Colors::WHITE, Colors::BLACK);
-  screen.drawTextCentered(0, 100, screen.getWidth(), 30,
-                          WiFi.localIP().toString().c_str(), &Font24,
-                          Colors::WHITE, Colors::BLACK);
-
-  // Release SPI bus for MFRC522
-  SPI.endTransaction();
-
-	mfrc522.PCD_Init();		// Init MFRC522
-	delay(4);				// Optional delay. Some board do need more time after init to be ready, see Readme
-	mfrc522.PCD_DumpVersionToSerial();	// Show details of PCD - MFRC522 Card Reader details
+  screen.begin();			// Starts the shared SPI bus
+  gateScreen.begin(WiFi.localIP().toString().c_str());
+
+  cardReader = SPIBus::shared().addDevice(SS_PIN);
+  {
+    CardSession session;
+    mfrc522.PCD_Init();		// Init MFRC522
+    delay(4);				// Optional delay. Some board do need more time after init to be ready, see Readme
+    mfrc522.PCD_DumpVersionToSerial();	// Show details of PCD - MFRC522 Card Reader details
+  }
   Serial.println("MFRC522 initialized.");
+
+  // Draw from the other core from now on, so card polling and HTTP
+  // handling do not wait for the LCD
+  screen.beginDisplayTask();
 }
 
 void loop() {
@@ -481,10 +475,10 @@ void loop() {
       Serial.println("Denied: budget=0");
 
       // Show the Denied message on LCD
-      screen.fillScreen(Colors::WHITE);
-      screen.drawTextCentered(0, 0, screen.getWidth(), 80,
-                          "Denied: budget=0", &Font24,
-                          Colors::WHITE, Colors::BLACK);
+      gateScreen.showStatus("Denied: budget=0");
+      char line[48];
+      snprintf(line, sizeof(line), "%6lus  Denied: budget=0\n", millis() / 1000);
+      gateScreen.log(line);
       return;
     }
     while (!writeBudget(lastBudget - 1)) {
@@ -496,9 +490,9 @@ void loop() {
     // Show the new budget on LCD
     char buf[32];
     sprintf(buf, "Balance = %d ILS", lastBudget);
-    screen.fillScreen(Colors::WHITE);
-    screen.drawTextCentered(0, 0, screen.getWidth(), 80,
-                          buf, &Font24,
-                          Colors::WHITE, Colors::BLACK);
+    gateScreen.showStatus(buf);
+    char line[48];
+    snprintf(line, sizeof(line), "%6lus  Entry OK, budget=%d\n", millis() / 1000, lastBudget);
+    gateScreen.log(line);
   }
 }
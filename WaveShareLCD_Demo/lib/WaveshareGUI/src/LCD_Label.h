@@ -0,0 +1,59 @@
+/*****************************************************************************
+* | File      	:	LCD_Label.h
+* | Function    :	Text readout that redraws only the characters that changed
+* | Info        :
+*   A label remembers the text, font and position it last drew. A new value
+*   is compared with it cell by cell and only the cells whose character
+*   changed are drawn (or cleared), instead of clearing the whole area and
+*   drawing the string again:
+*
+*     GUI_LABEL Temp;
+*     GUI_LabelInit(&Temp, 400, 5, 75, 20, &Font16, BLACK, WHITE, LABEL_RIGHT);
+*     GUI_LabelFixed(&Temp, 235, 1, " C");     // "23.5 C", every cell
+*     GUI_LabelFixed(&Temp, 236, 1, " C");     // "23.6 C", one cell
+*
+*   The text is centered vertically in the box and aligned in it
+*   horizontally. Right-aligned text stays on the same cells when its
+*   length changes. Only glyph cells are painted; the box is the caller's.
+*   After the caller redraws it, GUI_LabelInvalidate() sends the next value
+*   whole.
+******************************************************************************/
+#ifndef __LCD_LABEL_H
+#define __LCD_LABEL_H
+
+#include "LCD_GUI.h"
+
+#define LABEL_MAX_LEN 32	//Longer text is cut
+
+typedef enum {
+  LABEL_LEFT = 0,
+  LABEL_CENTER,
+  LABEL_RIGHT,
+} LABEL_ALIGN;
+
+typedef struct {
+  POINT Xstart, Ystart;
+  LENGTH Width, Height;
+  sFONT *Font;
+  COLOR Color_Background, Color_Foreground;
+  LABEL_ALIGN Align;
+
+  //What the screen shows
+  char Shown[LABEL_MAX_LEN + 1];
+  uint8_t Shown_Len;
+  int32_t Shown_X, Shown_Y;
+  sFONT *Shown_Font;
+  COLOR Shown_Background, Shown_Foreground;
+  bool Valid;
+} GUI_LABEL;
+
+void GUI_LabelInit(GUI_LABEL *pLabel, POINT Xstart, POINT Ystart, LENGTH Width, LENGTH Height,
+                   sFONT* Font, COLOR Color_Background, COLOR Color_Foreground, LABEL_ALIGN Align);
+void GUI_LabelInvalidate(GUI_LABEL *pLabel);
+
+//Font and colors set in the struct take effect with the next value
+void GUI_LabelString(GUI_LABEL *pLabel, const char *pString);
+void GUI_LabelNum(GUI_LABEL *pLabel, int32_t Nummber, const char *pSuffix = NULL);
+void GUI_LabelFixed(GUI_LABEL *pLabel, int32_t Nummber, uint8_t Decimals, const char *pSuffix = NULL);
+
+#endif
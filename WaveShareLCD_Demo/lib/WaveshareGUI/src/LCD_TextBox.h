@@ -0,0 +1,38 @@
+/*****************************************************************************
+* | File      	:	LCD_TextBox.h
+* | Function    :	Word wrapped, aligned text clipped to a box
+* | Info        :
+*   GUI_DisString_EN() wraps at any character when a line is full and starts
+*   over at the top left when the screen is. GUI_DisString_Box() breaks the
+*   text at spaces (and at '\n') to fit the box, aligns each line in it and
+*   leaves out the lines below it:
+*
+*     GUI_DisString_Box(0, 0, 480, 80, "Timeout: no card detected",
+*                       &Font24, WHITE, BLACK, LABEL_CENTER);
+*
+*   The lines are centered vertically in the box. A word wider than the box
+*   is broken where it reaches the edge.
+*
+*   The breaks found for a text are kept for the next time the same text is
+*   drawn in the same font and width, so a status line redrawn again and
+*   again is measured once.
+******************************************************************************/
+#ifndef __LCD_TEXTBOX_H
+#define __LCD_TEXTBOX_H
+
+#include "LCD_GUI.h"
+#include "LCD_Label.h"
+
+#define TEXTBOX_MAX_LINES 8	//Further lines are dropped
+#define TEXTBOX_MAX_LEN 80	//Characters per line
+#define TEXTBOX_CACHE 4		//Texts whose breaks are kept
+
+void GUI_DisString_Box(POINT Xstart, POINT Ystart, LENGTH Width, LENGTH Height,
+                       const char *pString, sFONT* Font,
+                       COLOR Color_Background, COLOR Color_Foreground, LABEL_ALIGN Align);
+
+//Breaks kept / found since the last reset
+void GUI_TextBoxStats(uint32_t *pHits, uint32_t *pMisses);
+void GUI_TextBoxReset(void);
+
+#endif
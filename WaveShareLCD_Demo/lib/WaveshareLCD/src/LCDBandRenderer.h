@@ -0,0 +1,260 @@
+/*****************************************************************************
+ * | File        : LCDBandRenderer.h
+ * | Function    : Full-screen scenes rendered strip by strip
+ * | Info        : Display list + two band-sized LCDCanvas buffers
+ * |
+ * | A 480x320 RGB565 frame is 300 KB, more than the ESP32 has to spare.
+ * | The band renderer records the drawing calls of a scene instead, then
+ * | rasterizes the list into one horizontal strip at a time (480x20 by
+ * | default, 19 KB) and sends each strip as a single blit. A full redraw is
+ * | then one top-to-bottom stream of pixels instead of thousands of small
+ * | windows, and nothing half-drawn is ever visible.
+ * |
+ * | Usage:
+ * |   LCDBandRenderer scene;
+ * |   scene.begin(lcd);                    // two 480x20 band buffers
+ * |   scene.clear(Colors::BLACK);
+ * |   scene.drawCircle(240, 160, 80, Colors::RED, DrawFill::FULL);
+ * |   scene.drawString(10, 10, "Hello", &Font24, Colors::BLACK, Colors::WHITE);
+ * |   scene.render();                      // rasterize and send every band
+ * |
+ * | Every call has the same arguments and result as on the panel. Each
+ * | recorded call keeps the range of rows it can touch, so a band only
+ * | replays the calls that reach it. Strings are copied into the list;
+ * | bitmaps and fonts are kept by pointer and must outlive render().
+ * |
+ * | Rows no call draws on show the background color (setBackground()).
+ * |
+ * | The two buffers let one band be rasterized while the previous one is
+ * | still going out over DMA. In dual-core mode a worker task on the other
+ * | core rasterizes bands while the calling core sends them, which also
+ * | overlaps the two with a blocking transport.
+ * |
+ * | Retained frames: present() keeps the list it sent and compares the
+ * | next one with it, pairing up the calls both make in the same order
+ * | (same arguments, same text). Only the areas of calls that changed,
+ * | appeared or went away are rasterized, each band as one blit of its
+ * | changed columns. A screen that is redrawn with one new number then
+ * | costs the pixels of that number:
+ * |
+ * |   scene.fillArea(0, 0, 480, 160, Colors::WHITE);
+ * |   scene.drawString(150, 60, balance, &Font24, Colors::WHITE, Colors::BLACK);
+ * |   scene.present();                     // first time: everything drawn
+ * |   ...                                  // same calls, another balance
+ * |   scene.present();                     // only the old and new text
+ * |
+ * | present() only sends pixels its calls can touch, in this frame or the
+ * | last, so a scene may own just part of the screen. Anything else that
+ * | draws there must say so with invalidate(). Bitmaps are compared by
+ * | pointer: one changed in place needs invalidate() too.
+ * |
+ * | Before a list is sent it is optimized: calls fully covered by a later
+ * | opaque fill are dropped, and back-to-back fills of one color that form
+ * | a rectangle are merged into one.
+ *****************************************************************************/
+
+#ifndef __LCD_BAND_RENDERER_H
+#define __LCD_BAND_RENDERER_H
+
+#include <stdint.h>
+#include "LCDCanvas.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+class LCDBandRenderer {
+public:
+    static constexpr LENGTH DEFAULT_BAND_ROWS = 20;
+
+    LCDBandRenderer();
+    ~LCDBandRenderer();
+
+    LCDBandRenderer(const LCDBandRenderer&) = delete;
+    LCDBandRenderer& operator=(const LCDBandRenderer&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Allocate two target-wide bands of 'bandRows' rows. Returns false if
+    // they do not fit. dualCore is ignored where there is only one core.
+    bool begin(LCDSurface& target, LENGTH bandRows = DEFAULT_BAND_ROWS,
+               bool dualCore = false);
+    void end();
+
+    bool isReady() const { return _target != nullptr; }
+
+    void setBackground(COLOR color) { _background = color; }
+    COLOR getBackground() const { return _background; }
+
+    //--------------------------------------------------------------------------
+    // Display list
+    //--------------------------------------------------------------------------
+    // Forget the recorded calls (the list memory is kept for the next scene)
+    void reset();
+
+    uint16_t getOpCount() const { return _count; }
+
+    // A call was dropped because the list could not grow
+    bool hasOverflowed() const { return _overflow; }
+
+    //--------------------------------------------------------------------------
+    // Recording, as on LCDSurface
+    //--------------------------------------------------------------------------
+    void clear(COLOR color = LCD_BACKGROUND);
+    void fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color);
+
+    void drawPoint(POINT x, POINT y, COLOR color,
+                   DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                   DotStyle dotStyle = DOT_STYLE_DEFAULT);
+
+    void drawLine(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                  COLOR color,
+                  LineStyle lineStyle = LineStyle::SOLID,
+                  DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    void drawLineAA(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                    COLOR color, COLOR bgColor = LCD_BACKGROUND);
+
+    void drawRectangle(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd,
+                       COLOR color,
+                       DrawFill fill = DrawFill::EMPTY,
+                       DotPixel dotSize = DOT_PIXEL_DEFAULT,
+                       LineStyle lineStyle = LineStyle::SOLID);
+
+    void drawCircle(POINT xCenter, POINT yCenter, LENGTH radius,
+                    COLOR color,
+                    DrawFill fill = DrawFill::EMPTY,
+                    DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    void drawEllipse(POINT xCenter, POINT yCenter, LENGTH xRadius, LENGTH yRadius,
+                     COLOR color,
+                     DrawFill fill = DrawFill::EMPTY,
+                     DotPixel dotSize = DOT_PIXEL_DEFAULT);
+
+    void drawChar(POINT x, POINT y, char ch,
+                  sFONT* font,
+                  COLOR bgColor, COLOR fgColor);
+
+    void drawString(POINT x, POINT y, const char* str,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    void drawNumber(POINT x, POINT y, int32_t number,
+                    sFONT* font,
+                    COLOR bgColor, COLOR fgColor);
+
+    void drawBitmap(POINT x, POINT y, const uint8_t* bitmap,
+                    POINT width, POINT height);
+
+    void drawGrayMap(POINT x, POINT y, const uint8_t* graymap);
+
+    //--------------------------------------------------------------------------
+    // Output
+    //--------------------------------------------------------------------------
+    // Rasterize the list band by band and send it to the target. The list
+    // is kept, so the same scene can be rendered again.
+    void render();
+
+    // Send only what changed since the last present(), then start an
+    // empty list for the next frame. The last frame is kept across end(),
+    // so the bands can be freed between frames.
+    void present();
+
+    // The panel no longer shows the last frame: the next present() sends
+    // all of its calls. The second form marks just one area (exclusive
+    // end) as drawn over.
+    void invalidate();
+    void invalidate(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd);
+
+    // Calls drawn into a band during the last render(), summed over bands
+    uint32_t getOpsReplayed() const { return _opsReplayed; }
+
+    // Calls the optimizer dropped or merged, and pixels sent, in the last
+    // render() or present()
+    uint16_t getOpsDropped() const { return _opsDropped; }
+    uint16_t getOpsMerged() const { return _opsMerged; }
+    uint32_t getPixelsSent() const { return _pixelsSent; }
+
+private:
+    enum class OpType : uint8_t {
+        CLEAR, FILL, DOT, LINE, LINE_AA, RECT, CIRCLE, ELLIPSE,
+        CHAR, STRING, NUMBER, BITMAP, GRAYMAP
+    };
+
+    struct Op {
+        OpType type;
+        uint8_t style[3];           // DrawFill / DotPixel / LineStyle / DotStyle
+        POINT x0, y0, x1, y1;
+        COLOR color, color2;
+        POINT top, bottom;          // Rows the call can touch (exclusive end)
+        POINT left, right;          // Columns, likewise
+        sFONT* font;
+        union {
+            const uint8_t* data;    // BITMAP, GRAYMAP
+            uint32_t text;          // STRING: offset into _text
+            int32_t number;         // NUMBER
+        };
+    };
+
+    LCDSurface* _target;
+    LCDCanvas _bands[2];
+    LENGTH _bandRows;
+    COLOR _background;
+
+    Op* _ops;
+    uint16_t _count;
+    uint16_t _capacity;
+    char* _text;
+    uint32_t _textUsed;
+    uint32_t _textCapacity;
+    bool _overflow;
+
+    uint32_t _opsReplayed;
+    uint16_t _opsDropped;
+    uint16_t _opsMerged;
+    uint32_t _pixelsSent;
+
+    // The list sent by the last present(), swapped with the current one
+    Op* _prevOps;
+    uint16_t _prevCount;
+    uint16_t _prevCapacity;
+    char* _prevText;
+    uint32_t _prevTextCapacity;
+    COLOR _prevBackground;
+    bool _prevValid;
+
+    // Areas the next present() has to send
+    static constexpr uint8_t MAX_CHANGES = 8;
+    LCDRect _changes[MAX_CHANGES];
+    uint8_t _changeCount;
+    LCDRect _damage;                // Drawn over since the last present()
+
+    Op* record(OpType type, int32_t left, int32_t top, int32_t right, int32_t bottom);
+    Op* recordText(OpType type, POINT x, POINT y, const char* text, sFONT* font);
+    void rasterize(LCDCanvas& band, POINT top, POINT left, POINT right);
+    void rasterize(LCDCanvas& band, POINT top, POINT left, POINT right,
+                   POINT sendTop, POINT sendBottom);
+    void replay(LCDCanvas& band, const Op& op);
+
+    void optimize();
+    bool coverOf(const Op& op, LCDRect& area) const;
+    bool sameOp(const Op& a, const char* aText, const Op& b, const char* bText) const;
+    void findChanges();
+    void addChange(POINT x0, POINT y0, POINT x1, POINT y1);
+    bool addTextChange(const Op& op, const Op& prev);
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+    bool _dualCore;
+    SemaphoreHandle_t _free;        // Bands the worker may draw into
+    QueueHandle_t _ready;           // Bands ready to send, in order
+
+    bool renderDualCore();
+    static void workerMain(void* arg);
+#endif
+};
+
+#endif // __LCD_BAND_RENDERER_H
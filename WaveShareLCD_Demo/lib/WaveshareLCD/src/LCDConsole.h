@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * | File        : LCDConsole.h
+ * | Function    : Scrolling text console on the panel
+ * | Info        : Print target that scrolls with the ILI9486 scroll registers
+ * |
+ * | A console owns a horizontal strip of the screen and behaves like a
+ * | serial terminal: text goes in through print()/printf(), a full line
+ * | wraps, and a new line at the bottom pushes the oldest one out.
+ * |
+ * | Usage:
+ * |   LCDConsole log(lcd);
+ * |   log.begin(160, 320, &Font16);        // rows 160..479, 20 lines
+ * |   log.printf("Gate %d open\n", gate);
+ * |
+ * | In the portrait scan directions the strip becomes the panel's hardware
+ * | scroll area. Scrolling by a line then costs one 0x37 command plus
+ * | clearing the line that comes in at the bottom; nothing that is already
+ * | on screen is sent again. The rows above and below stay fixed.
+ * |
+ * | In landscape the panel scrolls sideways, so the console keeps the same
+ * | behaviour by redrawing its lines from the text it holds.
+ * |
+ * | While a console is active, leave its rows to it: in hardware mode they
+ * | are shown rotated by the current scroll position.
+ * |
+ * | The console is a grid of font->Width cells: give it a fixed-width font.
+ *****************************************************************************/
+
+#ifndef __LCD_CONSOLE_H
+#define __LCD_CONSOLE_H
+
+#include <Arduino.h>
+#include "WaveshareLCD.h"
+
+class LCDConsole : public Print {
+public:
+    explicit LCDConsole(WaveshareLCD& lcd);
+    ~LCDConsole();
+
+    LCDConsole(const LCDConsole&) = delete;
+    LCDConsole& operator=(const LCDConsole&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Take rows [top, top + height) of the panel, which must already be
+    // running. Returns false if fewer than one line fits or the text
+    // buffer cannot be allocated.
+    bool begin(POINT top, LENGTH height, sFONT* font = &Font16,
+               COLOR fgColor = Colors::WHITE, COLOR bgColor = Colors::BLACK);
+    void end();
+
+    bool isReady() const { return _text != nullptr; }
+
+    // Scrolling through the panel's scroll registers (portrait only)
+    bool isHardwareScroll() const { return _hardware; }
+
+    LENGTH getColumns() const { return _cols; }
+    LENGTH getLines() const { return _lines; }
+
+    //--------------------------------------------------------------------------
+    // Output
+    //--------------------------------------------------------------------------
+    // Blank the console and move the cursor to the top line
+    void clear();
+
+    size_t write(uint8_t ch) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+private:
+    WaveshareLCD& _lcd;
+    sFONT* _font;
+    COLOR _fgColor;
+    COLOR _bgColor;
+    POINT _top;
+    LENGTH _cols;
+    LENGTH _lines;
+    bool _hardware;
+
+    // One line of text per display line, _cols characters each
+    char* _text;
+    uint16_t* _lengths;
+
+    uint16_t _first;                // Text line shown at the top
+    uint16_t _row;                  // Display line of the cursor
+    uint16_t _col;
+
+    void putChar(char ch);
+    void newLine();
+    void scroll();
+    void redrawLine(uint16_t row);
+
+    uint16_t lineAt(uint16_t row) const { return (_first + row) % _lines; }
+    POINT rowTop(uint16_t row) const;
+};
+
+#endif // __LCD_CONSOLE_H
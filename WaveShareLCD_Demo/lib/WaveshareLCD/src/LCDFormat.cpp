@@ -0,0 +1,35 @@
+/*****************************************************************************
+ * | File        : LCDFormat.cpp
+ * | Function    : Number to text without snprintf()
+ *****************************************************************************/
+
+#include "LCDFormat.h"
+
+uint8_t LCDFormat::integer(char* out, int32_t value) {
+    return fixed(out, value, 0);
+}
+
+uint8_t LCDFormat::fixed(char* out, int32_t value, uint8_t decimals) {
+    if (decimals > 9) decimals = 9;
+
+    // Digits come out last first; INT32_MIN has no positive int32_t
+    char digits[10];
+    uint8_t count = 0;
+    uint32_t rest = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+    do {
+        digits[count++] = '0' + rest % 10;
+        rest /= 10;
+    } while (rest != 0);
+
+    // At least one digit before the point
+    while (count <= decimals) digits[count++] = '0';
+
+    uint8_t length = 0;
+    if (value < 0) out[length++] = '-';
+    while (count > 0) {
+        if (count == decimals) out[length++] = '.';
+        out[length++] = digits[--count];
+    }
+    out[length] = '\0';
+    return length;
+}
@@ -0,0 +1,243 @@
+/*****************************************************************************
+ * | File        : LCDLabel.cpp
+ * | Function    : Text readout that redraws only the characters that changed
+ * | Info        : See LCDLabel.h
+ *****************************************************************************/
+
+#include "LCDLabel.h"
+#include "LCDFont.h"
+#include "LCDFormat.h"
+#include <string.h>
+
+LCDLabel::LCDLabel()
+    : _target(nullptr), _x(0), _y(0), _width(0), _height(0),
+      _font(nullptr), _bgColor(0), _fgColor(0), _align(Align::LEFT),
+      _shownLength(0), _shownX(0), _shownY(0), _shownFont(nullptr),
+      _shownBg(0), _shownFg(0), _valid(false), _cellsChanged(0) {
+    _shown[0] = '\0';
+}
+
+//------------------------------------------------------------------------------
+// Initialization
+//------------------------------------------------------------------------------
+void LCDLabel::begin(LCDSurface& target, POINT x, POINT y, LENGTH width, LENGTH height,
+                     sFONT* font, COLOR bgColor, COLOR fgColor, Align align) {
+    _target = &target;
+    _x = x;
+    _y = y;
+    _width = width;
+    _height = height;
+    _font = font;
+    _bgColor = bgColor;
+    _fgColor = fgColor;
+    _align = align;
+    _shownLength = 0;
+    _shown[0] = '\0';
+    _shownFont = nullptr;
+    _valid = false;
+}
+
+void LCDLabel::setColors(COLOR bgColor, COLOR fgColor) {
+    _bgColor = bgColor;
+    _fgColor = fgColor;
+}
+
+//------------------------------------------------------------------------------
+// Values
+//------------------------------------------------------------------------------
+void LCDLabel::setText(const char* text) {
+    size_t length = strlen(text);
+    show(text, length > MAX_LENGTH ? MAX_LENGTH : (uint8_t)length);
+}
+
+void LCDLabel::setNumber(int32_t value, const char* suffix) {
+    char text[MAX_LENGTH + 1];
+    setWithSuffix(text, LCDFormat::integer(text, value), suffix);
+}
+
+void LCDLabel::setFixed(int32_t value, uint8_t decimals, const char* suffix) {
+    char text[MAX_LENGTH + 1];
+    setWithSuffix(text, LCDFormat::fixed(text, value, decimals), suffix);
+}
+
+void LCDLabel::setWithSuffix(char* text, uint8_t length, const char* suffix) {
+    if (suffix != nullptr) {
+        while (*suffix != '\0' && length < MAX_LENGTH) {
+            text[length++] = *suffix++;
+        }
+        text[length] = '\0';
+    }
+    show(text, length);
+}
+
+//------------------------------------------------------------------------------
+// Drawing
+//------------------------------------------------------------------------------
+void LCDLabel::show(const char* text, uint8_t length) {
+    _cellsChanged = 0;
+    if (_target == nullptr || _font == nullptr) return;
+
+    const int32_t w = _font->Width;
+    const int32_t h = _font->Height;
+    const int32_t extent = LCDFont::measure(_font, text, length);
+    const bool proportional = LCDFont::isProportional(_font);
+
+    // Where the text goes; text wider than the box starts at its left edge
+    int32_t x = _x;
+    if (extent < _width) {
+        if (_align == Align::RIGHT) {
+            x += _width - extent;
+        } else if (_align == Align::CENTER) {
+            x += (_width - extent) / 2;
+        }
+    }
+    int32_t y = _y;
+    if (h < _height) {
+        y += (_height - h) / 2;
+    }
+
+    _target->beginWrite();
+    if (!_valid) {
+        // Nothing known on screen: the cells around the text are the caller's
+        drawCells(x, y, text, length);
+    } else if (_shownFont != _font || y != _shownY ||
+               (!proportional && (x - _shownX) % w != 0) ||
+               _shownBg != _bgColor || _shownFg != _fgColor) {
+        // The cells moved or changed color: erase what the new text will
+        // not cover, then draw all of it
+        int32_t oldStart = _shownX;
+        int32_t oldEnd = _shownX + LCDFont::measure(_shownFont, _shown, _shownLength);
+        bool sameRows = FONT_BACKGROUND != _bgColor && y == _shownY &&
+                        h == _shownFont->Height;
+        if (_shownLength > 0) {
+            if (!sameRows || length == 0) {
+                eraseCells(oldStart, _shownY, _shownFont, _shown, _shownLength);
+            } else {
+                // Same rows: only the columns left and right of the new text
+                if (oldStart < x) {
+                    eraseSpan(oldStart, x < oldEnd ? x : oldEnd, y, _shownFont);
+                }
+                if (oldEnd > x + extent) {
+                    eraseSpan(oldStart > x + extent ? oldStart : x + extent, oldEnd, y, _shownFont);
+                }
+                _cellsChanged += _shownLength;
+            }
+        }
+        drawCells(x, y, text, length);
+    } else if (proportional) {
+        showChanges(x, y, text, length);
+    } else {
+        // Same grid: walk the union of both extents cell by cell, and
+        // draw or erase runs of cells that differ
+        int32_t base = x < _shownX ? x : _shownX;
+        int32_t oldFirst = (_shownX - base) / w;
+        int32_t newFirst = (x - base) / w;
+        int32_t oldLast = oldFirst + _shownLength;
+        int32_t newLast = newFirst + length;
+        int32_t cells = oldLast > newLast ? oldLast : newLast;
+
+        int32_t run = -1;           // First cell of the current run
+        bool runDraws = false;
+        for (int32_t i = 0; i <= cells; i++) {
+            bool hasNew = i >= newFirst && i < newLast;
+            bool hasOld = i >= oldFirst && i < oldLast;
+            bool draws = hasNew && (!hasOld || text[i - newFirst] != _shown[i - oldFirst]);
+            bool erases = !hasNew && hasOld;
+            bool changed = i < cells && (draws || erases);
+
+            if (run >= 0 && (!changed || draws != runDraws)) {
+                uint8_t count = i - run;
+                if (runDraws) {
+                    drawCells(base + run * w, y, text + (run - newFirst), count);
+                } else {
+                    eraseCells(base + run * w, y, _font, _shown + (run - oldFirst), count);
+                }
+                run = -1;
+            }
+            if (changed && run < 0) {
+                run = i;
+                runDraws = draws;
+            }
+        }
+    }
+    _target->endWrite();
+
+    memcpy(_shown, text, length);
+    _shown[length] = '\0';
+    _shownLength = length;
+    _shownX = x;
+    _shownY = y;
+    _shownFont = _font;
+    _shownBg = _bgColor;
+    _shownFg = _fgColor;
+    _valid = true;
+}
+
+void LCDLabel::showChanges(int32_t x, int32_t y, const char* text, uint8_t length) {
+    // Characters at the same place at the start of both strings...
+    uint8_t first = 0;
+    int32_t newStart = x;
+    int32_t oldStart = _shownX;
+    while (first < length && first < _shownLength &&
+           text[first] == _shown[first] && newStart == oldStart) {
+        newStart += LCDFont::advance(_font, text[first]);
+        oldStart += LCDFont::advance(_font, _shown[first]);
+        first++;
+    }
+
+    // ...and at the end
+    uint8_t newLast = length;
+    uint8_t oldLast = _shownLength;
+    int32_t newEnd = x + LCDFont::measure(_font, text, length);
+    int32_t oldEnd = _shownX + LCDFont::measure(_font, _shown, _shownLength);
+    while (newLast > first && oldLast > first &&
+           text[newLast - 1] == _shown[oldLast - 1] && newEnd == oldEnd) {
+        newEnd -= LCDFont::advance(_font, text[newLast - 1]);
+        oldEnd -= LCDFont::advance(_font, _shown[oldLast - 1]);
+        newLast--;
+        oldLast--;
+    }
+
+    // What the new span does not cover of the old one
+    if (oldStart < newStart) {
+        eraseSpan(oldStart, oldEnd < newStart ? oldEnd : newStart, y, _font);
+    }
+    if (oldEnd > newEnd) {
+        eraseSpan(oldStart > newEnd ? oldStart : newEnd, oldEnd, y, _font);
+    }
+    if (oldLast - first > newLast - first) {
+        _cellsChanged += (oldLast - first) - (newLast - first);
+    }
+    drawCells(newStart, y, text + first, newLast - first);
+}
+
+void LCDLabel::drawCells(int32_t x, int32_t y, const char* text, uint8_t count) {
+    if (count == 0) return;
+
+    // Transparent text only adds pixels: clear the cells first
+    if (FONT_BACKGROUND == _bgColor) {
+        eraseCells(x, y, _font, text, count);
+        _cellsChanged -= count;
+    }
+
+    char run[MAX_LENGTH + 1];
+    memcpy(run, text, count);
+    run[count] = '\0';
+    _target->drawString(x, y, run, _font, _bgColor, _fgColor);
+    _cellsChanged += count;
+}
+
+void LCDLabel::eraseCells(int32_t x, int32_t y, sFONT* font, const char* text, uint8_t count) {
+    if (count == 0) return;
+    eraseSpan(x, x + LCDFont::measure(font, text, count), y, font);
+    _cellsChanged += count;
+}
+
+void LCDLabel::eraseSpan(int32_t from, int32_t to, int32_t y, sFONT* font) {
+    // A glyph at (x, y) covers [x-1, x-1+Width) x [y-1, y-1+Height)
+    int32_t left = from - 1;
+    int32_t top = y - 1;
+    if (to <= from) return;
+    _target->fillArea(left < 0 ? 0 : left, top < 0 ? 0 : top,
+                      to - 1, top + font->Height, _bgColor);
+}
@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * | File        : LCDTextLayout.h
+ * | Function    : Word wrap, alignment and clipping of text in a box
+ * | Info        : Line breaks cached per (text hash, font, width)
+ * |
+ * | drawString() wraps at any character when a line is full and starts
+ * | over at the top when the screen is. A layout breaks text at spaces
+ * | (and at '\n') to fit a box, aligns each line in it, and leaves out the
+ * | lines below the box:
+ * |
+ * |   LCDTextLayout layout;
+ * |   layout.draw(lcd, 0, 0, 480, 80, "Timeout: no card detected",
+ * |               &Font24, Colors::WHITE, Colors::BLACK,
+ * |               LCDTextLayout::Align::CENTER);
+ * |
+ * | The lines are centered vertically in the box. A word wider than the
+ * | box is broken where it reaches the edge.
+ * |
+ * | Measuring every character again for each redraw of the same status
+ * | text is wasted work, so the breaks found for a text are kept: layout()
+ * | of a (text, font, width) seen before is a hash of the text and a few
+ * | compares. The least recently used entry makes room for a new one.
+ * |
+ * | draw() works with any target that has drawString(): LCDSurface,
+ * | LCDBandRenderer, LCDDisplayService. Use place() and copyLine() to
+ * | draw the lines some other way.
+ *****************************************************************************/
+
+#ifndef __LCD_TEXT_LAYOUT_H
+#define __LCD_TEXT_LAYOUT_H
+
+#include <stdint.h>
+#include "LCDTypes.h"
+#include "LCDFont.h"
+#include "fonts/fonts.h"
+
+class LCDTextLayout {
+public:
+    static constexpr uint8_t MAX_LINES = 8;             // Further lines are dropped
+    static constexpr uint8_t MAX_LINE_LENGTH = 80;      // Characters
+    static constexpr uint8_t DEFAULT_ENTRIES = 8;
+
+    enum class Align : uint8_t { LEFT, CENTER, RIGHT };
+
+    struct Line {
+        uint16_t start;             // Offset in the text
+        uint16_t length;            // Trailing spaces left out
+        uint16_t width;             // Pixels
+    };
+
+    struct Lines {
+        uint8_t count;
+        bool clipped;               // The text had more than MAX_LINES
+        Line line[MAX_LINES];
+    };
+
+    explicit LCDTextLayout(uint8_t entries = DEFAULT_ENTRIES);
+    ~LCDTextLayout();
+
+    LCDTextLayout(const LCDTextLayout&) = delete;
+    LCDTextLayout& operator=(const LCDTextLayout&) = delete;
+
+    // Lines of 'text' broken to fit 'width', from the cache when the same
+    // text was laid out before in this font and width. The result stays
+    // valid until the next call.
+    const Lines& layout(const char* text, const sFONT* font, LENGTH width);
+
+    // The same without the cache
+    static void breakLines(const char* text, const sFONT* font, LENGTH width, Lines& lines);
+
+    // Where line 'index' goes in the box; false for lines below it
+    static bool place(const Lines& lines, uint8_t index, const sFONT* font,
+                      int32_t x, int32_t y, LENGTH width, LENGTH height, Align align,
+                      int32_t& lineX, int32_t& lineY);
+
+    // A line as a string; 'out' takes MAX_LINE_LENGTH + 1 characters
+    static void copyLine(const char* text, const Line& line, char* out);
+
+    template <class Target>
+    void draw(Target& target, POINT x, POINT y, LENGTH width, LENGTH height,
+              const char* text, sFONT* font, COLOR bgColor, COLOR fgColor,
+              Align align = Align::LEFT) {
+        const Lines& lines = layout(text, font, width);
+        for (uint8_t i = 0; i < lines.count; i++) {
+            int32_t lineX, lineY;
+            if (!place(lines, i, font, x, y, width, height, align, lineX, lineY)) break;
+            char line[MAX_LINE_LENGTH + 1];
+            copyLine(text, lines.line[i], line);
+            target.drawString(lineX, lineY, line, font, bgColor, fgColor);
+        }
+    }
+
+    void clear();
+
+    uint32_t getHits() const { return _hits; }
+    uint32_t getMisses() const { return _misses; }
+    void resetStats();
+
+private:
+    struct Entry {
+        uint32_t hash;
+        uint16_t length;
+        LENGTH width;
+        const sFONT* font;          // nullptr: free
+        uint32_t used;              // Clock of the last lookup
+        Lines lines;
+    };
+
+    Entry* _entries;
+    uint8_t _maxEntries;
+    uint32_t _clock;
+    uint32_t _hits;
+    uint32_t _misses;
+    Lines _uncached;                // When the entries cannot be allocated
+};
+
+#endif // __LCD_TEXT_LAYOUT_H
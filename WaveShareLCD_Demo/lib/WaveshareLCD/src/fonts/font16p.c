@@ -0,0 +1,305 @@
+/* Font16P: 11x16, ' '..'~', packed by LCDFontPack::writeSource().
+   1469 bytes of glyphs and 192 of offsets; the table had 3040.
+   89 of 95 glyphs are run-length coded. */
+
+#include "fonts.h"
+
+const uint8_t Font16P_Data[] =
+{
+	// @0 ' ' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+	// @6 '!' (runs)
+	0xF0, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2F, 0x52, 0xFF, 0xFF,
+	// @18 '"' (runs)
+	0xFA, 0x31, 0x34, 0x31, 0x35, 0x13, 0x16, 0x13, 0x16, 0x13, 0x1F, 0xFF,
+	0xFF, 0xFB,
+	// @32 '#'
+	0x00, 0x01, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x7F, 0x86, 0xC1, 0xFE, 0x1B,
+	0x03, 0x60, 0x6C, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @54 '$' (runs)
+	0x51, 0x86, 0x42, 0x32, 0x42, 0x32, 0x43, 0x94, 0x84, 0x93, 0x42, 0x32,
+	0x42, 0x32, 0x46, 0x81, 0xA1, 0xFF, 0x80,
+	// @73 '%' (runs)
+	0xE2, 0x81, 0x21, 0x71, 0x21, 0x82, 0x32, 0x64, 0x54, 0x62, 0x32, 0x81,
+	0x21, 0x71, 0x21, 0x82, 0xFF, 0xFC,
+	// @91 '&' (runs)
+	0xFB, 0x46, 0x29, 0x29, 0x2A, 0x28, 0x31, 0x24, 0x21, 0x35, 0x22, 0x26,
+	0x31, 0x2F, 0xFF, 0xC0,
+	// @107 ''' (runs)
+	0xFC, 0x38, 0x39, 0x1A, 0x1A, 0x1F, 0xFF, 0xFF, 0xFD,
+	// @116 '(' (runs)
+	0xF2, 0x29, 0x28, 0x28, 0x38, 0x29, 0x29, 0x29, 0x29, 0x39, 0x2A, 0x29,
+	0x2F, 0xF6,
+	// @130 ')' (runs)
+	0xE2, 0x92, 0xA2, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x83, 0x82,
+	0xFF, 0x90,
+	// @144 '*' (runs)
+	0xF1, 0x29, 0x26, 0x83, 0x85, 0x46, 0x65, 0x22, 0x2F, 0xFF, 0xFF, 0xF0,
+	// @156 '+' (runs)
+	0xFF, 0x81, 0xA1, 0xA1, 0x77, 0x71, 0xA1, 0xA1, 0xFF, 0xFF, 0xB0,
+	// @167 ',' (runs)
+	0xFF, 0xFF, 0xFF, 0xE2, 0x91, 0x92, 0x91, 0xA1, 0xFD,
+	// @176 '-' (runs)
+	0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xB0,
+	// @183 '.' (runs)
+	0xFF, 0xFF, 0xFF, 0xD2, 0x92, 0xFF, 0xFF,
+	// @190 '/' (runs)
+	0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82,
+	0x92, 0xFF, 0xA0,
+	// @205 '0' (runs)
+	0xF0, 0x37, 0x21, 0x25, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24,
+	0x23, 0x24, 0x23, 0x25, 0x21, 0x27, 0x3F, 0xFF, 0xE0,
+	// @226 '1' (runs)
+	0xF1, 0x26, 0x59, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x26, 0x8F, 0xFF,
+	0xB0,
+	// @239 '2' (runs)
+	0xF0, 0x46, 0x22, 0x24, 0x23, 0x24, 0x23, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x29, 0x7F, 0xFF, 0xC0,
+	// @255 '3' (runs)
+	0xD6, 0x42, 0x42, 0x92, 0x82, 0x65, 0x93, 0x92, 0x92, 0x32, 0x42, 0x46,
+	0xFF, 0xFD,
+	// @269 '4' (runs)
+	0xF1, 0x38, 0x37, 0x47, 0x11, 0x26, 0x21, 0x26, 0x12, 0x25, 0x22, 0x25,
+	0x78, 0x27, 0x5F, 0xFF, 0xC0,
+	// @286 '5' (runs)
+	0xE6, 0x52, 0x92, 0x92, 0x95, 0x61, 0x32, 0x92, 0x92, 0x41, 0x42, 0x55,
+	0xFF, 0xFD,
+	// @300 '6' (runs)
+	0xF1, 0x45, 0x38, 0x28, 0x29, 0x21, 0x35, 0x32, 0x24, 0x23, 0x24, 0x23,
+	0x25, 0x22, 0x26, 0x4F, 0xFF, 0xD0,
+	// @318 '7' (runs)
+	0xC7, 0x41, 0x42, 0x92, 0x82, 0x92, 0x92, 0x92, 0x82, 0x92, 0x92, 0xFF,
+	0xFF,
+	// @331 '8' (runs)
+	0xE5, 0x52, 0x32, 0x42, 0x32, 0x42, 0x32, 0x55, 0x52, 0x32, 0x42, 0x32,
+	0x42, 0x32, 0x42, 0x32, 0x55, 0xFF, 0xFD,
+	// @350 '9' (runs)
+	0xE4, 0x62, 0x22, 0x52, 0x32, 0x42, 0x32, 0x42, 0x23, 0x53, 0x12, 0x92,
+	0x82, 0x83, 0x54, 0xFF, 0xFF,
+	// @367 ':' (runs)
+	0xFF, 0xF3, 0x29, 0x2F, 0xFC, 0x29, 0x2F, 0xFF, 0xF0,
+	// @376 ';' (runs)
+	0xFF, 0xF5, 0x29, 0x2F, 0xFB, 0x29, 0x19, 0x1A, 0x1F, 0xF9,
+	// @386 '<' (runs)
+	0xFF, 0x02, 0x72, 0x81, 0x82, 0x72, 0xB2, 0xB1, 0xB2, 0xB2, 0xFF, 0xFB,
+	// @398 '=' (runs)
+	0xFF, 0xFB, 0x9D, 0x9F, 0xFF, 0xFF, 0xE0,
+	// @405 '>' (runs)
+	0xF8, 0x2B, 0x2B, 0x1B, 0x2B, 0x27, 0x28, 0x18, 0x27, 0x2F, 0xFF, 0xF3,
+	// @417 '?' (runs)
+	0xFA, 0x55, 0x23, 0x24, 0x23, 0x29, 0x27, 0x37, 0x29, 0x2F, 0x52, 0xFF,
+	0xFF,
+	// @430 '@'
+	0x00, 0x01, 0xC0, 0x44, 0x10, 0x82, 0x10, 0x4E, 0x0A, 0x41, 0x48, 0x27,
+	0x04, 0x00, 0x44, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @452 'A' (runs)
+	0xF9, 0x67, 0x47, 0x12, 0x16, 0x22, 0x25, 0x22, 0x25, 0x64, 0x24, 0x23,
+	0x24, 0x22, 0x42, 0x4F, 0xFF, 0xA0,
+	// @470 'B' (runs)
+	0xF8, 0x75, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x65, 0x23, 0x24, 0x23,
+	0x24, 0x23, 0x23, 0x7F, 0xFF, 0xD0,
+	// @488 'C' (runs)
+	0xFA, 0x51, 0x13, 0x24, 0x22, 0x26, 0x12, 0x29, 0x29, 0x29, 0x26, 0x13,
+	0x24, 0x15, 0x5F, 0xFF, 0xD0,
+	// @505 'D' (runs)
+	0xF8, 0x75, 0x23, 0x24, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23,
+	0x24, 0x23, 0x23, 0x23, 0x7F, 0xFF, 0xD0,
+	// @524 'E' (runs)
+	0xF8, 0x84, 0x24, 0x14, 0x24, 0x14, 0x22, 0x16, 0x56, 0x22, 0x16, 0x24,
+	0x14, 0x24, 0x13, 0x8F, 0xFF, 0xC0,
+	// @542 'F' (runs)
+	0xF8, 0x93, 0x25, 0x13, 0x25, 0x13, 0x22, 0x16, 0x56, 0x22, 0x16, 0x29,
+	0x28, 0x5F, 0xFF, 0xF0,
+	// @558 'G' (runs)
+	0xFA, 0x41, 0x14, 0x23, 0x23, 0x25, 0x13, 0x29, 0x29, 0x22, 0x52, 0x24,
+	0x24, 0x23, 0x25, 0x5F, 0xFF, 0xD0,
+	// @576 'H' (runs)
+	0xF8, 0x41, 0x43, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x74, 0x23, 0x24,
+	0x23, 0x24, 0x23, 0x23, 0x41, 0x4F, 0xFF, 0xB0,
+	// @596 'I' (runs)
+	0xF9, 0x86, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x26, 0x8F, 0xFF, 0xB0,
+	// @608 'J' (runs)
+	0xFA, 0x77, 0x29, 0x29, 0x29, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x25,
+	0x5F, 0xFF, 0xE0,
+	// @623 'K' (runs)
+	0xF8, 0x41, 0x43, 0x23, 0x24, 0x22, 0x25, 0x21, 0x26, 0x47, 0x56, 0x22,
+	0x25, 0x23, 0x23, 0x42, 0x3F, 0xFF, 0xB0,
+	// @642 'L' (runs)
+	0xF8, 0x67, 0x29, 0x29, 0x29, 0x29, 0x24, 0x14, 0x24, 0x14, 0x24, 0x12,
+	0x9F, 0xFF, 0xB0,
+	// @657 'M'
+	0x00, 0x00, 0x03, 0x83, 0xB0, 0x67, 0x1C, 0xF7, 0x9A, 0xB3, 0x76, 0x64,
+	0xCC, 0x1B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @679 'N'
+	0x00, 0x00, 0x01, 0xCF, 0x18, 0xC3, 0x98, 0x7B, 0x0D, 0x61, 0xBC, 0x33,
+	0x86, 0x31, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @701 'O' (runs)
+	0xFA, 0x55, 0x23, 0x23, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22,
+	0x25, 0x23, 0x23, 0x25, 0x5F, 0xFF, 0xD0,
+	// @720 'P' (runs)
+	0xF8, 0x75, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x65, 0x29,
+	0x28, 0x6F, 0xFF, 0xE0,
+	// @736 'Q' (runs)
+	0xFA, 0x55, 0x23, 0x23, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22,
+	0x25, 0x23, 0x23, 0x25, 0x57, 0x22, 0x24, 0x6F, 0xF5,
+	// @757 'R' (runs)
+	0xF8, 0x75, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x56, 0x22, 0x25, 0x23,
+	0x24, 0x23, 0x23, 0x52, 0x3F, 0xFF, 0xA0,
+	// @776 'S' (runs)
+	0xFA, 0x64, 0x23, 0x24, 0x23, 0x24, 0x39, 0x59, 0x34, 0x23, 0x24, 0x23,
+	0x24, 0x6F, 0xFF, 0xD0,
+	// @792 'T' (runs)
+	0xF8, 0x83, 0x12, 0x22, 0x13, 0x12, 0x22, 0x13, 0x12, 0x22, 0x16, 0x29,
+	0x29, 0x29, 0x27, 0x6F, 0xFF, 0xD0,
+	// @810 'U' (runs)
+	0xF8, 0x41, 0x43, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23,
+	0x24, 0x23, 0x24, 0x23, 0x25, 0x5F, 0xFF, 0xD0,
+	// @830 'V' (runs)
+	0xF8, 0x41, 0x43, 0x23, 0x24, 0x23, 0x25, 0x21, 0x26, 0x21, 0x26, 0x21,
+	0x27, 0x11, 0x18, 0x38, 0x3F, 0xFF, 0xE0,
+	// @849 'W'
+	0x00, 0x00, 0x03, 0xEF, 0xB0, 0x66, 0x4C, 0xDD, 0x9B, 0xB1, 0x54, 0x3B,
+	0x87, 0x70, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @871 'X' (runs)
+	0xF8, 0x41, 0x43, 0x23, 0x25, 0x21, 0x27, 0x38, 0x38, 0x37, 0x21, 0x25,
+	0x23, 0x23, 0x41, 0x4F, 0xFF, 0xB0,
+	// @889 'Y' (runs)
+	0xF8, 0x42, 0x42, 0x24, 0x24, 0x22, 0x26, 0x48, 0x29, 0x29, 0x29, 0x27,
+	0x6F, 0xFF, 0xC0,
+	// @904 'Z' (runs)
+	0xF9, 0x74, 0x14, 0x24, 0x13, 0x28, 0x29, 0x19, 0x28, 0x23, 0x14, 0x24,
+	0x14, 0x7F, 0xFF, 0xC0,
+	// @920 '[' (runs)
+	0xF1, 0x47, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x4F, 0xF5,
+	// @934 '\' (runs)
+	0x22, 0x92, 0xA2, 0x92, 0xA2, 0x92, 0xA2, 0xA2, 0x92, 0xA2, 0x92, 0xA2,
+	0x92, 0xFF, 0x40,
+	// @949 ']' (runs)
+	0xE4, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x74,
+	0xFF, 0x70,
+	// @963 '^' (runs)
+	0x51, 0x91, 0x11, 0x81, 0x11, 0x71, 0x31, 0x51, 0x51, 0x41, 0x51, 0xFF,
+	0xFF, 0xFF, 0xF7,
+	// @978 '_' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xB0,
+	// @985 '`' (runs)
+	0x41, 0xB1, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+	// @993 'a' (runs)
+	0xFF, 0xF2, 0x5A, 0x29, 0x25, 0x64, 0x23, 0x24, 0x22, 0x35, 0x31, 0x3F,
+	0xFF, 0xB0,
+	// @1007 'b' (runs)
+	0xC3, 0x92, 0x92, 0x92, 0x13, 0x53, 0x22, 0x42, 0x42, 0x32, 0x42, 0x32,
+	0x42, 0x33, 0x22, 0x33, 0x13, 0xFF, 0xFD,
+	// @1026 'c' (runs)
+	0xFF, 0xF2, 0x41, 0x14, 0x23, 0x23, 0x25, 0x13, 0x29, 0x25, 0x14, 0x23,
+	0x25, 0x5F, 0xFF, 0xD0,
+	// @1042 'd' (runs)
+	0xF2, 0x39, 0x29, 0x25, 0x31, 0x24, 0x22, 0x33, 0x24, 0x23, 0x24, 0x23,
+	0x24, 0x24, 0x22, 0x35, 0x31, 0x3F, 0xFF, 0xB0,
+	// @1062 'e' (runs)
+	0xFF, 0xF2, 0x55, 0x23, 0x23, 0x25, 0x22, 0x92, 0x2A, 0x24, 0x24, 0x6F,
+	0xFF, 0xC0,
+	// @1076 'f' (runs)
+	0xF1, 0x64, 0x29, 0x27, 0x76, 0x29, 0x29, 0x29, 0x29, 0x27, 0x7F, 0xFF,
+	0xC0,
+	// @1089 'g' (runs)
+	0xFF, 0xF2, 0x31, 0x33, 0x22, 0x33, 0x24, 0x23, 0x24, 0x23, 0x24, 0x24,
+	0x22, 0x35, 0x31, 0x29, 0x29, 0x25, 0x5F, 0xA0,
+	// @1109 'h' (runs)
+	0xC3, 0x92, 0x92, 0x92, 0x13, 0x53, 0x22, 0x42, 0x32, 0x42, 0x32, 0x42,
+	0x32, 0x42, 0x32, 0x34, 0x14, 0xFF, 0xFB,
+	// @1128 'i' (runs)
+	0xF1, 0x29, 0x2F, 0x34, 0x92, 0x92, 0x92, 0x92, 0x92, 0x68, 0xFF, 0xFB,
+	// @1140 'j' (runs)
+	0xF1, 0x29, 0x2F, 0x26, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+	0x55, 0xFB,
+	// @1154 'k' (runs)
+	0xC3, 0x92, 0x92, 0x92, 0x14, 0x42, 0x12, 0x64, 0x74, 0x72, 0x12, 0x62,
+	0x22, 0x43, 0x15, 0xFF, 0xFB,
+	// @1171 'l' (runs)
+	0xE4, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x68, 0xFF, 0xFB,
+	// @1183 'm'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x6D, 0x8D, 0xB1, 0xB6, 0x36,
+	0xC6, 0xD9, 0xDB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1205 'n' (runs)
+	0xFF, 0xF0, 0x31, 0x35, 0x32, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24,
+	0x23, 0x23, 0x41, 0x4F, 0xFF, 0xB0,
+	// @1223 'o' (runs)
+	0xFF, 0xF2, 0x55, 0x23, 0x23, 0x25, 0x22, 0x25, 0x22, 0x25, 0x23, 0x23,
+	0x25, 0x5F, 0xFF, 0xD0,
+	// @1239 'p' (runs)
+	0xFF, 0xF0, 0x31, 0x35, 0x32, 0x24, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23,
+	0x32, 0x24, 0x21, 0x35, 0x29, 0x28, 0x5F, 0xC0,
+	// @1259 'q' (runs)
+	0xFF, 0xF2, 0x31, 0x33, 0x22, 0x33, 0x24, 0x23, 0x24, 0x23, 0x24, 0x24,
+	0x22, 0x35, 0x31, 0x29, 0x29, 0x27, 0x5F, 0x80,
+	// @1279 'r' (runs)
+	0xFF, 0xF0, 0x41, 0x35, 0x32, 0x24, 0x29, 0x29, 0x29, 0x27, 0x7F, 0xFF,
+	0xD0,
+	// @1292 's' (runs)
+	0xFF, 0xF2, 0x64, 0x23, 0x24, 0x48, 0x59, 0x34, 0x23, 0x24, 0x6F, 0xFF,
+	0xD0,
+	// @1305 't' (runs)
+	0xE2, 0x92, 0x92, 0x77, 0x62, 0x92, 0x92, 0x92, 0x92, 0x31, 0x64, 0xFF,
+	0xFD,
+	// @1318 'u' (runs)
+	0xFF, 0xF0, 0x32, 0x34, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24,
+	0x22, 0x35, 0x31, 0x3F, 0xFF, 0xB0,
+	// @1336 'v' (runs)
+	0xFF, 0xF0, 0x41, 0x43, 0x23, 0x24, 0x23, 0x25, 0x21, 0x26, 0x21, 0x27,
+	0x38, 0x3F, 0xFF, 0xE0,
+	// @1352 'w' (runs)
+	0xFF, 0xE4, 0x34, 0x12, 0x52, 0x22, 0x21, 0x22, 0x22, 0x13, 0x12, 0x33,
+	0x13, 0x43, 0x13, 0x42, 0x32, 0xFF, 0xFC,
+	// @1371 'x' (runs)
+	0xFF, 0xF0, 0x41, 0x44, 0x21, 0x27, 0x38, 0x38, 0x37, 0x21, 0x24, 0x41,
+	0x4F, 0xFF, 0xB0,
+	// @1386 'y' (runs)
+	0xFF, 0xF0, 0x42, 0x42, 0x24, 0x24, 0x22, 0x25, 0x22, 0x26, 0x11, 0x27,
+	0x48, 0x29, 0x28, 0x27, 0x5F, 0xB0,
+	// @1404 'z' (runs)
+	0xFF, 0xF1, 0x74, 0x14, 0x28, 0x27, 0x37, 0x28, 0x24, 0x14, 0x7F, 0xFF,
+	0xC0,
+	// @1417 '{' (runs)
+	0xF1, 0x28, 0x29, 0x29, 0x29, 0x29, 0x28, 0x2A, 0x29, 0x29, 0x29, 0x2A,
+	0x2F, 0xF7,
+	// @1431 '|' (runs)
+	0xF1, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x2F, 0xF7,
+	// @1445 '}' (runs)
+	0xF0, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x2A, 0x28, 0x29, 0x29, 0x29, 0x28,
+	0x2F, 0xF8,
+	// @1459 '~' (runs)
+	0xFF, 0xFD, 0x28, 0x12, 0x12, 0x18, 0x2F, 0xFF, 0xFF, 0xF1,
+};
+
+const uint16_t Font16P_Offsets[] =
+{
+	0x8000, 0x8006, 0x8012, 0x0020, 0x8036, 0x8049, 0x805B, 0x806B,
+	0x8074, 0x8082, 0x8090, 0x809C, 0x80A7, 0x80B0, 0x80B7, 0x80BE,
+	0x80CD, 0x80E2, 0x80EF, 0x80FF, 0x810D, 0x811E, 0x812C, 0x813E,
+	0x814B, 0x815E, 0x816F, 0x8178, 0x8182, 0x818E, 0x8195, 0x81A1,
+	0x01AE, 0x81C4, 0x81D6, 0x81E8, 0x81F9, 0x820C, 0x821E, 0x822E,
+	0x8240, 0x8254, 0x8260, 0x826F, 0x8282, 0x0291, 0x02A7, 0x82BD,
+	0x82D0, 0x82E0, 0x82F5, 0x8308, 0x8318, 0x832A, 0x833E, 0x0351,
+	0x8367, 0x8379, 0x8388, 0x8398, 0x83A6, 0x83B5, 0x83C3, 0x83D2,
+	0x83D9, 0x83E1, 0x83EF, 0x8402, 0x8412, 0x8426, 0x8434, 0x8441,
+	0x8455, 0x8468, 0x8474, 0x8482, 0x8493, 0x049F, 0x84B5, 0x84C7,
+	0x84D7, 0x84EB, 0x84FF, 0x850C, 0x8519, 0x8526, 0x8538, 0x8548,
+	0x855B, 0x856A, 0x857C, 0x8589, 0x8597, 0x85A5, 0x85B3, 0x05BD,
+};
+
+const sPACKED Font16P_Packed = {
+  Font16P_Data,
+  Font16P_Offsets,
+  32, /* First */
+  126, /* Last */
+};
+
+sFONT Font16P = {
+  0,
+  11, /* Width */
+  16, /* Height */
+  &Font16P_Packed,
+};
@@ -0,0 +1,334 @@
+/* Font20P: 14x20, ' '..'~', packed by LCDFontPack::writeSource().
+   1931 bytes of glyphs and 192 of offsets; the table had 3800.
+   94 of 95 glyphs are run-length coded. */
+
+#include "fonts.h"
+
+const uint8_t Font20P_Data[] =
+{
+	// @0 ' ' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+	// @10 '!' (runs)
+	0xF4, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x1D, 0x1F, 0xFA, 0x3B,
+	0x3F, 0xFF, 0xFF, 0xF0,
+	// @26 '"' (runs)
+	0xFF, 0x13, 0x23, 0x63, 0x23, 0x63, 0x23, 0x71, 0x41, 0x81, 0x41, 0x81,
+	0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+	// @45 '#' (runs)
+	0x42, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x6A, 0x4A,
+	0x62, 0x22, 0x82, 0x22, 0x6A, 0x4A, 0x62, 0x22, 0x82, 0x22, 0x82, 0x22,
+	0x82, 0x22, 0x82, 0x22, 0xFF, 0xFF,
+	// @75 '$' (runs)
+	0x62, 0xC2, 0xB6, 0x77, 0x62, 0x42, 0x62, 0xC5, 0xA6, 0xC3, 0x62, 0x42,
+	0x62, 0x42, 0x67, 0x76, 0xB2, 0xC2, 0xC2, 0xFF, 0xFF, 0x20,
+	// @97 '%' (runs)
+	0xF2, 0x3A, 0x13, 0x19, 0x13, 0x19, 0x13, 0x1A, 0x33, 0x2A, 0x47, 0x57,
+	0x4A, 0x23, 0x3A, 0x13, 0x19, 0x13, 0x19, 0x13, 0x1A, 0x3F, 0xFF, 0xFF,
+	0xD0,
+	// @122 '&' (runs)
+	0xFF, 0xF3, 0x57, 0x77, 0x2C, 0x2D, 0x2B, 0x42, 0x25, 0x95, 0x22, 0x46,
+	0x23, 0x27, 0x97, 0x41, 0x2F, 0xFF, 0xFF, 0xB0,
+	// @142 ''' (runs)
+	0xFF, 0x43, 0xB3, 0xB3, 0xC1, 0xD1, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF9,
+	// @155 '(' (runs)
+	0xF7, 0x2C, 0x2B, 0x2C, 0x2C, 0x2B, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2D,
+	0x2C, 0x2C, 0x2D, 0x2C, 0x2F, 0xFF, 0x10,
+	// @174 ')' (runs)
+	0xF3, 0x2C, 0x2D, 0x2C, 0x2C, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B,
+	0x2C, 0x2C, 0x2B, 0x2C, 0x2F, 0xFF, 0x50,
+	// @193 '*' (runs)
+	0xF5, 0x2C, 0x2C, 0x29, 0x21, 0x21, 0x26, 0x88, 0x4A, 0x49, 0x68, 0x22,
+	0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+	// @211 '+' (runs)
+	0xFF, 0xF3, 0x2C, 0x2C, 0x2C, 0x28, 0xA4, 0xA8, 0x2C, 0x2C, 0x2C, 0x2F,
+	0xFF, 0xFF, 0xFE,
+	// @226 ',' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0xB2, 0xC2, 0xB2, 0xC2, 0xC1, 0xFF,
+	0xF5,
+	// @239 '-' (runs)
+	0xFF, 0xFF, 0xFF, 0xA9, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+	// @250 '.' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0xB3, 0xB3, 0xFF, 0xFF, 0xFE,
+	// @261 '/' (runs)
+	0x92, 0xC2, 0xB2, 0xC2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC2, 0xB2,
+	0xC2, 0xC2, 0xB2, 0xC2, 0xFF, 0xFF, 0x50,
+	// @280 '0' (runs)
+	0xF3, 0x58, 0x77, 0x23, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+	0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x23, 0x27, 0x78, 0x5F, 0xFF,
+	0xFF, 0xE0,
+	// @306 '1' (runs)
+	0xF5, 0x29, 0x59, 0x5C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x29,
+	0x86, 0x8F, 0xFF, 0xFF, 0xC0,
+	// @323 '2' (runs)
+	0xF3, 0x58, 0x76, 0x33, 0x35, 0x25, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x2B, 0x95, 0x9F, 0xFF, 0xFF, 0xC0,
+	// @342 '3' (runs)
+	0xF3, 0x57, 0x86, 0x24, 0x3C, 0x2B, 0x38, 0x59, 0x5C, 0x3C, 0x2C, 0x24,
+	0x25, 0x34, 0x96, 0x7F, 0xFF, 0xFF, 0xE0,
+	// @361 '4' (runs)
+	0xF6, 0x3A, 0x4A, 0x49, 0x21, 0x28, 0x22, 0x28, 0x22, 0x27, 0x23, 0x26,
+	0x24, 0x26, 0x95, 0x9B, 0x2A, 0x59, 0x5F, 0xFF, 0xFF, 0xC0,
+	// @383 '5' (runs)
+	0xF2, 0x77, 0x77, 0x2C, 0x2C, 0x68, 0x77, 0x23, 0x3C, 0x2C, 0x2C, 0x25,
+	0x24, 0x35, 0x87, 0x6F, 0xFF, 0xFF, 0xE0,
+	// @402 '6' (runs)
+	0xF5, 0x57, 0x76, 0x4A, 0x2B, 0x3B, 0x21, 0x47, 0x86, 0x33, 0x35, 0x25,
+	0x25, 0x25, 0x26, 0x23, 0x36, 0x79, 0x4F, 0xFF, 0xFF, 0xE0,
+	// @424 '7' (runs)
+	0xF1, 0x95, 0x95, 0x25, 0x2C, 0x2B, 0x2C, 0x2C, 0x2B, 0x2C, 0x2C, 0x2B,
+	0x2C, 0x2C, 0x2F, 0xFF, 0xFF, 0xF0,
+	// @442 '8' (runs)
+	0xF3, 0x58, 0x76, 0x33, 0x35, 0x25, 0x25, 0x33, 0x36, 0x77, 0x76, 0x33,
+	0x35, 0x25, 0x25, 0x25, 0x25, 0x33, 0x36, 0x78, 0x5F, 0xFF, 0xFF, 0xE0,
+	// @466 '9' (runs)
+	0xF3, 0x49, 0x76, 0x33, 0x26, 0x25, 0x25, 0x25, 0x25, 0x33, 0x36, 0x87,
+	0x41, 0x2B, 0x3B, 0x2A, 0x46, 0x77, 0x5F, 0xFF, 0xFF, 0xF1,
+	// @488 ':' (runs)
+	0xFF, 0xFF, 0xF1, 0x3B, 0x3B, 0x3F, 0xFF, 0x83, 0xB3, 0xB3, 0xFF, 0xFF,
+	0xFE,
+	// @501 ';' (runs)
+	0xFF, 0xFF, 0xF2, 0x3B, 0x3B, 0x3F, 0xFF, 0x73, 0xB2, 0xB2, 0xC2, 0xC1,
+	0xFF, 0xFF, 0x40,
+	// @516 '<' (runs)
+	0xFF, 0xF7, 0x2A, 0x48, 0x49, 0x39, 0x39, 0x4C, 0x3D, 0x3C, 0x4C, 0x4C,
+	0x2F, 0xFF, 0xFF, 0xB0,
+	// @532 '=' (runs)
+	0xFF, 0xFF, 0xBB, 0x3B, 0xFF, 0x1B, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	// @544 '>' (runs)
+	0xFF, 0xE2, 0xC4, 0xC4, 0xC3, 0xD3, 0xC4, 0x93, 0x93, 0x94, 0x84, 0xA2,
+	0xFF, 0xFF, 0xFF, 0x40,
+	// @560 '?' (runs)
+	0xFF, 0x25, 0x87, 0x72, 0x42, 0x62, 0x42, 0xC2, 0xA3, 0xA3, 0xB2, 0xFF,
+	0x93, 0xB3, 0xFF, 0xFF, 0xFF,
+	// @577 '@' (runs)
+	0xF5, 0x39, 0x22, 0x19, 0x14, 0x17, 0x15, 0x17, 0x15, 0x17, 0x13, 0x37,
+	0x12, 0x12, 0x17, 0x12, 0x12, 0x17, 0x12, 0x12, 0x17, 0x13, 0x37, 0x1E,
+	0x1D, 0x14, 0x19, 0x4F, 0xFF, 0xFF,
+	// @607 'A' (runs)
+	0xFF, 0x16, 0x86, 0xB3, 0xA2, 0x12, 0x92, 0x12, 0x82, 0x22, 0x82, 0x32,
+	0x68, 0x68, 0x52, 0x62, 0x34, 0x44, 0x24, 0x44, 0xFF, 0xFF, 0xFA,
+	// @630 'B' (runs)
+	0xFF, 0x07, 0x78, 0x72, 0x42, 0x62, 0x42, 0x62, 0x33, 0x67, 0x78, 0x62,
+	0x43, 0x52, 0x52, 0x52, 0x52, 0x4A, 0x49, 0xFF, 0xFF, 0xFC,
+	// @652 'C' (runs)
+	0xFF, 0x34, 0x12, 0x68, 0x53, 0x33, 0x43, 0x52, 0x42, 0xC2, 0xC2, 0xC2,
+	0xC3, 0x52, 0x53, 0x33, 0x67, 0x85, 0xFF, 0xFF, 0xFD,
+	// @673 'D' (runs)
+	0xFE, 0x86, 0x96, 0x24, 0x35, 0x25, 0x34, 0x26, 0x24, 0x26, 0x24, 0x26,
+	0x24, 0x26, 0x24, 0x25, 0x34, 0x24, 0x34, 0x95, 0x8F, 0xFF, 0xFF, 0xE0,
+	// @697 'E' (runs)
+	0xFF, 0x0A, 0x4A, 0x52, 0x52, 0x52, 0x52, 0x52, 0x22, 0x86, 0x86, 0x82,
+	0x22, 0x82, 0x52, 0x52, 0x52, 0x4A, 0x4A, 0xFF, 0xFF, 0xFB,
+	// @719 'F' (runs)
+	0xFF, 0x0A, 0x4A, 0x52, 0x52, 0x52, 0x52, 0x52, 0x22, 0x86, 0x86, 0x82,
+	0x22, 0x82, 0xC2, 0xB6, 0x86, 0xFF, 0xFF, 0xFF,
+	// @739 'G' (runs)
+	0xFF, 0x34, 0x12, 0x59, 0x52, 0x43, 0x42, 0x62, 0x42, 0xC2, 0xC2, 0x36,
+	0x32, 0x36, 0x32, 0x62, 0x52, 0x52, 0x59, 0x75, 0xFF, 0xFF, 0xFD,
+	// @762 'H' (runs)
+	0xFF, 0x04, 0x24, 0x44, 0x24, 0x52, 0x42, 0x62, 0x42, 0x62, 0x42, 0x68,
+	0x68, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x54, 0x24, 0x44, 0x24, 0xFF,
+	0xFF, 0xFB,
+	// @788 'I' (runs)
+	0xFF, 0x18, 0x68, 0x92, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x98,
+	0x68, 0xFF, 0xFF, 0xFC,
+	// @804 'J' (runs)
+	0xFF, 0x47, 0x77, 0xA2, 0xC2, 0xC2, 0xC2, 0x52, 0x52, 0x52, 0x52, 0x52,
+	0x52, 0x52, 0x43, 0x58, 0x85, 0xFF, 0xFF, 0xFE,
+	// @824 'K' (runs)
+	0xFF, 0x05, 0x15, 0x35, 0x15, 0x42, 0x33, 0x62, 0x22, 0x82, 0x12, 0x95,
+	0x93, 0x12, 0x82, 0x32, 0x72, 0x32, 0x72, 0x42, 0x55, 0x24, 0x35, 0x33,
+	0xFF, 0xFF, 0xFA,
+	// @851 'L' (runs)
+	0xFF, 0x06, 0x86, 0xA2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x4A, 0x4A, 0xFF, 0xFF, 0xFB,
+	// @870 'M' (runs)
+	0xFE, 0x44, 0x42, 0x44, 0x43, 0x34, 0x34, 0x42, 0x44, 0x21, 0x12, 0x11,
+	0x24, 0x21, 0x41, 0x24, 0x21, 0x41, 0x24, 0x22, 0x22, 0x24, 0x22, 0x22,
+	0x24, 0x26, 0x23, 0x52, 0x52, 0x52, 0x5F, 0xFF, 0xFF, 0xA0,
+	// @904 'N' (runs)
+	0xFF, 0x03, 0x25, 0x44, 0x15, 0x53, 0x32, 0x64, 0x22, 0x64, 0x22, 0x62,
+	0x12, 0x12, 0x62, 0x12, 0x12, 0x62, 0x24, 0x62, 0x24, 0x62, 0x33, 0x55,
+	0x13, 0x55, 0x22, 0xFF, 0xFF, 0xFC,
+	// @934 'O' (runs)
+	0xFF, 0x34, 0x96, 0x73, 0x23, 0x53, 0x43, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x43, 0x43, 0x53, 0x23, 0x76, 0x94, 0xFF, 0xFF, 0xFE,
+	// @958 'P' (runs)
+	0xFF, 0x08, 0x69, 0x62, 0x43, 0x52, 0x52, 0x52, 0x52, 0x52, 0x43, 0x58,
+	0x67, 0x72, 0xC2, 0xB6, 0x86, 0xFF, 0xFF, 0xFF,
+	// @978 'Q' (runs)
+	0xFF, 0x34, 0x96, 0x73, 0x23, 0x53, 0x43, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x43, 0x43, 0x53, 0x23, 0x76, 0x94, 0xA4, 0x12, 0x68,
+	0x62, 0x23, 0xFF, 0xF0,
+	// @1006 'R' (runs)
+	0xFF, 0x08, 0x69, 0x62, 0x43, 0x52, 0x52, 0x52, 0x43, 0x58, 0x67, 0x72,
+	0x33, 0x62, 0x42, 0x62, 0x43, 0x45, 0x33, 0x35, 0x42, 0xFF, 0xFF, 0xFA,
+	// @1030 'S' (runs)
+	0xFF, 0x25, 0x12, 0x59, 0x43, 0x43, 0x42, 0x62, 0x43, 0xC6, 0xA6, 0xC3,
+	0x42, 0x62, 0x43, 0x43, 0x49, 0x52, 0x15, 0xFF, 0xFF, 0xFD,
+	// @1052 'T' (runs)
+	0xFF, 0x0A, 0x4A, 0x42, 0x22, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22, 0x22,
+	0x82, 0xC2, 0xC2, 0xC2, 0xC2, 0xA6, 0x86, 0xFF, 0xFF, 0xFD,
+	// @1074 'U' (runs)
+	0xFF, 0x04, 0x24, 0x44, 0x24, 0x52, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+	0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x63, 0x23, 0x76, 0x94, 0xFF,
+	0xFF, 0xFE,
+	// @1100 'V' (runs)
+	0xFE, 0x43, 0x43, 0x43, 0x44, 0x25, 0x25, 0x25, 0x26, 0x23, 0x27, 0x23,
+	0x28, 0x21, 0x29, 0x21, 0x29, 0x21, 0x2A, 0x3B, 0x3B, 0x3F, 0xFF, 0xFF,
+	0xF0,
+	// @1125 'W'
+	0x00, 0x00, 0x00, 0x07, 0xC7, 0xDF, 0x1F, 0x30, 0x18, 0xCE, 0x63, 0x39,
+	0x8C, 0xE6, 0x36, 0xD8, 0x5B, 0x41, 0xC7, 0x07, 0x1C, 0x1C, 0x70, 0x60,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1160 'X' (runs)
+	0xFE, 0x43, 0x43, 0x43, 0x44, 0x25, 0x26, 0x23, 0x28, 0x21, 0x2A, 0x3B,
+	0x3A, 0x21, 0x28, 0x23, 0x26, 0x25, 0x24, 0x43, 0x43, 0x43, 0x4F, 0xFF,
+	0xFF, 0xB0,
+	// @1186 'Y' (runs)
+	0xFF, 0x04, 0x24, 0x44, 0x24, 0x52, 0x42, 0x72, 0x22, 0x94, 0xA4, 0xB2,
+	0xC2, 0xC2, 0xC2, 0xA6, 0x86, 0xFF, 0xFF, 0xFD,
+	// @1206 'Z' (runs)
+	0xFF, 0x18, 0x68, 0x62, 0x42, 0x62, 0x32, 0xB2, 0xB2, 0xC2, 0xB2, 0xB2,
+	0x32, 0x62, 0x42, 0x68, 0x68, 0xFF, 0xFF, 0xFC,
+	// @1226 '[' (runs)
+	0xF5, 0x4A, 0x4A, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+	0x2C, 0x2C, 0x2C, 0x4A, 0x4F, 0xFF, 0x10,
+	// @1245 '\' (runs)
+	0x32, 0xC2, 0xD2, 0xC2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2,
+	0xC2, 0xC2, 0xD2, 0xC2, 0xFF, 0xFE,
+	// @1263 ']' (runs)
+	0xF3, 0x4A, 0x4C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+	0x2C, 0x2C, 0x2A, 0x4A, 0x4F, 0xFF, 0x30,
+	// @1282 '^' (runs)
+	0xF5, 0x1C, 0x3A, 0x21, 0x28, 0x23, 0x26, 0x25, 0x25, 0x17, 0x1F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+	// @1299 '_' (runs)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xD0,
+	// @1309 '`' (runs)
+	0xF4, 0x1E, 0x2E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+	// @1321 'a' (runs)
+	0xFF, 0xFF, 0xE6, 0x78, 0xC2, 0x77, 0x68, 0x53, 0x42, 0x52, 0x43, 0x5A,
+	0x55, 0x13, 0xFF, 0xFF, 0xFB,
+	// @1338 'b' (runs)
+	0xF0, 0x3B, 0x3C, 0x2C, 0x2C, 0x21, 0x47, 0x95, 0x34, 0x25, 0x26, 0x24,
+	0x26, 0x24, 0x26, 0x24, 0x34, 0x24, 0xA4, 0x31, 0x4F, 0xFF, 0xFF, 0xE0,
+	// @1362 'c' (runs)
+	0xFF, 0xFF, 0xF0, 0x41, 0x25, 0x95, 0x25, 0x24, 0x26, 0x24, 0x2C, 0x2C,
+	0x35, 0x25, 0x96, 0x6F, 0xFF, 0xFF, 0xD0,
+	// @1381 'd' (runs)
+	0xF8, 0x3B, 0x3C, 0x2C, 0x27, 0x41, 0x25, 0x95, 0x24, 0x34, 0x26, 0x24,
+	0x26, 0x24, 0x26, 0x24, 0x34, 0x35, 0xA6, 0x41, 0x3F, 0xFF, 0xFF, 0xA0,
+	// @1405 'e' (runs)
+	0xFF, 0xFF, 0xF0, 0x48, 0x86, 0x24, 0x25, 0xA4, 0xA4, 0x2D, 0x25, 0x25,
+	0x97, 0x5F, 0xFF, 0xFF, 0xD0,
+	// @1422 'f' (runs)
+	0xF5, 0x67, 0x77, 0x2C, 0x2A, 0x86, 0x88, 0x2C, 0x2C, 0x2C, 0x2C, 0x2A,
+	0x86, 0x8F, 0xFF, 0xFF, 0xC0,
+	// @1439 'g' (runs)
+	0xFF, 0xFF, 0xF0, 0x41, 0x34, 0xA4, 0x24, 0x34, 0x26, 0x24, 0x26, 0x24,
+	0x26, 0x25, 0x24, 0x35, 0x97, 0x41, 0x2C, 0x2B, 0x36, 0x77, 0x6F, 0xF2,
+	// @1463 'h' (runs)
+	0xF1, 0x3B, 0x3C, 0x2C, 0x2C, 0x21, 0x47, 0x86, 0x33, 0x26, 0x24, 0x26,
+	0x24, 0x26, 0x24, 0x26, 0x24, 0x25, 0x42, 0x44, 0x42, 0x4F, 0xFF, 0xFF,
+	0xB0,
+	// @1488 'i' (runs)
+	0xF5, 0x2C, 0x2F, 0xF7, 0x59, 0x5C, 0x2C, 0x2C, 0x2C, 0x2C, 0x29, 0x86,
+	0x8F, 0xFF, 0xFF, 0xC0,
+	// @1504 'j' (runs)
+	0xF5, 0x2C, 0x2F, 0xF7, 0x77, 0x7C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+	0x2C, 0x2B, 0x36, 0x77, 0x6F, 0xF4,
+	// @1522 'k' (runs)
+	0xF1, 0x3B, 0x3C, 0x2C, 0x2C, 0x21, 0x56, 0x21, 0x56, 0x21, 0x29, 0x4A,
+	0x4A, 0x21, 0x29, 0x22, 0x27, 0x32, 0x54, 0x32, 0x5F, 0xFF, 0xFF, 0xB0,
+	// @1546 'l' (runs)
+	0xF2, 0x59, 0x5C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x29,
+	0x86, 0x8F, 0xFF, 0xFF, 0xC0,
+	// @1563 'm' (runs)
+	0xFF, 0xFF, 0xB6, 0x13, 0x4B, 0x42, 0x22, 0x22, 0x42, 0x22, 0x22, 0x42,
+	0x22, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22, 0x22, 0x34, 0x13, 0x13, 0x24,
+	0x13, 0x13, 0xFF, 0xFF, 0xFA,
+	// @1592 'n' (runs)
+	0xFF, 0xFF, 0xC3, 0x14, 0x69, 0x63, 0x32, 0x62, 0x42, 0x62, 0x42, 0x62,
+	0x42, 0x62, 0x42, 0x54, 0x24, 0x44, 0x24, 0xFF, 0xFF, 0xFB,
+	// @1614 'o' (runs)
+	0xFF, 0xFF, 0xF0, 0x48, 0x86, 0x24, 0x25, 0x26, 0x24, 0x26, 0x24, 0x26,
+	0x25, 0x24, 0x26, 0x88, 0x4F, 0xFF, 0xFF, 0xE0,
+	// @1634 'p' (runs)
+	0xFF, 0xFF, 0xB3, 0x14, 0x6A, 0x53, 0x42, 0x52, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x43, 0x42, 0x59, 0x52, 0x14, 0x72, 0xC2, 0xB5, 0x95, 0xFF, 0x60,
+	// @1658 'q' (runs)
+	0xFF, 0xFF, 0xF0, 0x41, 0x34, 0xA4, 0x24, 0x34, 0x26, 0x24, 0x26, 0x24,
+	0x26, 0x25, 0x24, 0x35, 0x97, 0x41, 0x2C, 0x2C, 0x2A, 0x59, 0x5F, 0xE0,
+	// @1682 'r' (runs)
+	0xFF, 0xFF, 0xC4, 0x23, 0x54, 0x15, 0x64, 0x22, 0x63, 0xB2, 0xC2, 0xC2,
+	0xA8, 0x68, 0xFF, 0xFF, 0xFD,
+	// @1699 's' (runs)
+	0xFF, 0xFF, 0xF0, 0x66, 0x86, 0x24, 0x26, 0x4B, 0x6B, 0x46, 0x24, 0x26,
+	0x86, 0x6F, 0xFF, 0xFF, 0xE0,
+	// @1716 't' (runs)
+	0xFF, 0x22, 0xC2, 0xC2, 0xA9, 0x59, 0x72, 0xC2, 0xC2, 0xC2, 0xC2, 0x42,
+	0x68, 0x75, 0xFF, 0xFF, 0xFD,
+	// @1733 'u' (runs)
+	0xFF, 0xFF, 0xC3, 0x33, 0x53, 0x33, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x33, 0x69, 0x64, 0x13, 0xFF, 0xFF, 0xFB,
+	// @1755 'v' (runs)
+	0xFF, 0xFF, 0xB4, 0x34, 0x34, 0x34, 0x42, 0x52, 0x62, 0x32, 0x72, 0x32,
+	0x82, 0x12, 0x92, 0x12, 0xA3, 0xB3, 0xFF, 0xFF, 0xFF,
+	// @1776 'w' (runs)
+	0xFF, 0xFF, 0xB4, 0x34, 0x34, 0x34, 0x42, 0x21, 0x22, 0x52, 0x21, 0x22,
+	0x52, 0x16, 0x63, 0x13, 0x73, 0x13, 0x72, 0x32, 0x72, 0x32, 0xFF, 0xFF,
+	0xFD,
+	// @1801 'x' (runs)
+	0xFF, 0xFF, 0xC4, 0x24, 0x44, 0x24, 0x62, 0x22, 0x94, 0xB2, 0xB4, 0x92,
+	0x22, 0x64, 0x24, 0x44, 0x24, 0xFF, 0xFF, 0xFB,
+	// @1821 'y' (runs)
+	0xFF, 0xFF, 0xB4, 0x34, 0x34, 0x34, 0x42, 0x52, 0x62, 0x32, 0x72, 0x32,
+	0x82, 0x12, 0x95, 0xA3, 0xB2, 0xC2, 0xB2, 0x97, 0x77, 0xFF, 0x40,
+	// @1844 'z' (runs)
+	0xFF, 0xFF, 0xD8, 0x68, 0x62, 0x32, 0xB2, 0xB2, 0xB2, 0xB2, 0x32, 0x68,
+	0x68, 0xFF, 0xFF, 0xFC,
+	// @1860 '{' (runs)
+	0xF6, 0x3A, 0x4A, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x3A, 0x3C, 0x3C, 0x2C,
+	0x2C, 0x2C, 0x2C, 0x4B, 0x3F, 0xFF, 0x10,
+	// @1879 '|' (runs)
+	0xF5, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+	0x2C, 0x2C, 0x2C, 0x2C, 0x2F, 0xFF, 0x30,
+	// @1898 '}' (runs)
+	0xF2, 0x3B, 0x4C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x3C, 0x3A, 0x3B, 0x2C,
+	0x2C, 0x2C, 0x2A, 0x4A, 0x3F, 0xFF, 0x50,
+	// @1917 '~' (runs)
+	0xFF, 0xFF, 0xFD, 0x39, 0x62, 0x24, 0x22, 0x69, 0x4F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x80,
+};
+
+const uint16_t Font20P_Offsets[] =
+{
+	0x8000, 0x800A, 0x801A, 0x802D, 0x804B, 0x8061, 0x807A, 0x808E,
+	0x809B, 0x80AE, 0x80C1, 0x80D3, 0x80E2, 0x80EF, 0x80FA, 0x8105,
+	0x8118, 0x8132, 0x8143, 0x8156, 0x8169, 0x817F, 0x8192, 0x81A8,
+	0x81BA, 0x81D2, 0x81E8, 0x81F5, 0x8204, 0x8214, 0x8220, 0x8230,
+	0x8241, 0x825F, 0x8276, 0x828C, 0x82A1, 0x82B9, 0x82CF, 0x82E3,
+	0x82FA, 0x8314, 0x8324, 0x8338, 0x8353, 0x8366, 0x8388, 0x83A6,
+	0x83BE, 0x83D2, 0x83EE, 0x8406, 0x841C, 0x8432, 0x844C, 0x0465,
+	0x8488, 0x84A2, 0x84B6, 0x84CA, 0x84DD, 0x84EF, 0x8502, 0x8513,
+	0x851D, 0x8529, 0x853A, 0x8552, 0x8565, 0x857D, 0x858E, 0x859F,
+	0x85B7, 0x85D0, 0x85E0, 0x85F2, 0x860A, 0x861B, 0x8638, 0x864E,
+	0x8662, 0x867A, 0x8692, 0x86A3, 0x86B4, 0x86C5, 0x86DB, 0x86F0,
+	0x8709, 0x871D, 0x8734, 0x8744, 0x8757, 0x876A, 0x877D, 0x078B,
+};
+
+const sPACKED Font20P_Packed = {
+  Font20P_Data,
+  Font20P_Offsets,
+  32, /* First */
+  126, /* Last */
+};
+
+sFONT Font20P = {
+  0,
+  14, /* Width */
+  20, /* Height */
+  &Font20P_Packed,
+};
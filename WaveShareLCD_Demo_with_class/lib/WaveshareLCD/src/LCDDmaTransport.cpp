@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * | File        : LCDDmaTransport.cpp
+ * | Function    : ESP32 spi_master DMA backend for LCDTransport
+ *****************************************************************************/
+
+#include "LCDDmaTransport.h"
+
+#if defined(ESP32)
+
+#include <string.h>
+#include <esp_heap_caps.h>
+#include <soc/spi_struct.h>
+
+#ifndef SPI_DMA_CH_AUTO
+#define SPI_DMA_CH_AUTO 1
+#endif
+
+LCDDmaTransport::LCDDmaTransport(spi_host_device_t host, int8_t sclk, int8_t mosi,
+                                 int8_t miso, uint32_t clockHz)
+    : _host(host)
+    , _sclk(sclk)
+    , _mosi(mosi)
+    , _miso(miso)
+    , _clockHz(clockHz)
+    , _maxTransfer(0)
+    , _device(nullptr)
+    , _next(0)
+    , _pending(0)
+    , _queue(nullptr)
+    , _task(nullptr)
+    , _idle(nullptr)
+{
+    memset(_trans, 0, sizeof(_trans));
+    portMUX_INITIALIZE(&_lock);
+}
+
+bool LCDDmaTransport::begin(LCDTransferQueue& queue)
+{
+    spi_bus_config_t bus;
+    memset(&bus, 0, sizeof(bus));
+    bus.mosi_io_num = _mosi;
+    bus.miso_io_num = _miso;
+    bus.sclk_io_num = _sclk;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = (int)_maxTransfer;
+
+    if (spi_bus_initialize(_host, &bus, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+
+    spi_device_interface_config_t dev;
+    memset(&dev, 0, sizeof(dev));
+    dev.mode = 0;
+    dev.clock_speed_hz = (int)_clockHz;
+    dev.spics_io_num = -1;              // CS is driven by WaveshareLCD
+    dev.queue_size = QUEUE_DEPTH;
+    dev.flags = SPI_DEVICE_NO_DUMMY;
+
+    if (spi_bus_add_device(_host, &dev, &_device) != ESP_OK) {
+        spi_bus_free(_host);
+        return false;
+    }
+
+    _queue = &queue;
+    _idle = xSemaphoreCreateBinary();
+    if (_idle == nullptr ||
+        xTaskCreate(workerMain, "lcd-dma", 2048, this, 2, &_task) != pdPASS) {
+        _task = nullptr;
+        end();
+        return false;
+    }
+    return true;
+}
+
+void LCDDmaTransport::end()
+{
+    if (_task != nullptr) {
+        vTaskDelete(_task);
+        _task = nullptr;
+    }
+    if (_idle != nullptr) {
+        vSemaphoreDelete(_idle);
+        _idle = nullptr;
+    }
+    if (_device != nullptr) {
+        spi_bus_remove_device(_device);
+        spi_bus_free(_host);
+        _device = nullptr;
+        restoreArduinoBus();
+    }
+    _queue = nullptr;
+}
+
+uint8_t* LCDDmaTransport::allocBuffer(size_t bytes)
+{
+    if (bytes > _maxTransfer) _maxTransfer = bytes;
+    return (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+}
+
+void LCDDmaTransport::freeBuffer(uint8_t* buffer)
+{
+    heap_caps_free(buffer);
+}
+
+//------------------------------------------------------------------------------
+// Transfers
+//------------------------------------------------------------------------------
+bool LCDDmaTransport::submit(const uint8_t* data, size_t len)
+{
+    if (_pending == QUEUE_DEPTH) return false;
+
+    spi_transaction_t* t = &_trans[_next];
+    memset(t, 0, sizeof(*t));
+    t->length = len * 8;
+    t->tx_buffer = data;
+
+    if (spi_device_queue_trans(_device, t, 0) != ESP_OK) return false;
+    _next = (_next + 1) % QUEUE_DEPTH;
+    _pending++;
+    return true;
+}
+
+uint8_t LCDDmaTransport::reap(bool wait)
+{
+    uint8_t done = 0;
+    spi_transaction_t* t;
+    TickType_t timeout = wait ? portMAX_DELAY : 0;
+
+    while (_pending > 0 &&
+           spi_device_get_trans_result(_device, &t, timeout) == ESP_OK) {
+        _pending--;
+        done++;
+        timeout = 0;
+    }
+    // The IDF driver leaves the host set up for TX-only DMA; put back what
+    // the Arduino SPI calls (touch, card reader) expect before they run
+    if (done > 0 && _pending == 0) restoreArduinoBus();
+    return done;
+}
+
+void LCDDmaTransport::restoreArduinoBus()
+{
+    spi_dev_t* hw = (_host == HSPI_HOST) ? &SPI2 : &SPI3;
+    hw->user.usr_mosi = 1;
+    hw->user.usr_miso = 1;
+    hw->user.doutdin = 1;
+}
+
+//------------------------------------------------------------------------------
+// Worker
+//------------------------------------------------------------------------------
+void LCDDmaTransport::kick()
+{
+    xTaskNotifyGive(_task);
+}
+
+void LCDDmaTransport::notifyIdle()
+{
+    xSemaphoreGive(_idle);
+}
+
+void LCDDmaTransport::waitIdle()
+{
+    // Timed so a give that raced ahead of the caller cannot stall it
+    xSemaphoreTake(_idle, pdMS_TO_TICKS(10));
+}
+
+void LCDDmaTransport::lock()
+{
+    taskENTER_CRITICAL(&_lock);
+}
+
+void LCDDmaTransport::unlock()
+{
+    taskEXIT_CRITICAL(&_lock);
+}
+
+void LCDDmaTransport::workerMain(void* arg)
+{
+    LCDDmaTransport* self = static_cast<LCDDmaTransport*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (self->_queue->pump(true)) {
+        }
+    }
+}
+
+#endif // ESP32
@@ -0,0 +1,71 @@
+/*****************************************************************************
+ * | File        : LCDDmaTransport.h
+ * | Function    : ESP32 spi_master DMA backend for LCDTransport
+ * | Info        : Shares the Arduino SPI host; CS/DC stay with the driver
+ * |
+ * | The device is added to the same host Arduino's SPI object uses (VSPI by
+ * | default) with spics_io_num = -1, so WaveshareLCD keeps driving CS and DC
+ * | itself. A small worker task waits on transfer results and refills the
+ * | line buffers, which keeps long fills moving while loop() runs.
+ *****************************************************************************/
+
+#ifndef __LCD_DMA_TRANSPORT_H
+#define __LCD_DMA_TRANSPORT_H
+
+#include "LCDTypes.h"
+#include "LCDTransport.h"
+
+#if defined(ESP32)
+
+#include <driver/spi_master.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+class LCDDmaTransport : public LCDTransport {
+public:
+    static constexpr uint8_t QUEUE_DEPTH = LCDTransferQueue::BUFFER_COUNT;
+
+    LCDDmaTransport(spi_host_device_t host = VSPI_HOST,
+                    int8_t sclk = 18, int8_t mosi = 23, int8_t miso = 19,
+                    uint32_t clockHz = LCD_SPI_CLOCK);
+
+    bool begin(LCDTransferQueue& queue) override;
+    void end() override;
+
+    uint8_t* allocBuffer(size_t bytes) override;
+    void freeBuffer(uint8_t* buffer) override;
+
+    bool submit(const uint8_t* data, size_t len) override;
+    uint8_t reap(bool wait) override;
+
+    bool hasWorker() const override { return _task != nullptr; }
+    void kick() override;
+    void notifyIdle() override;
+    void waitIdle() override;
+    void lock() override;
+    void unlock() override;
+
+private:
+    spi_host_device_t _host;
+    int8_t _sclk, _mosi, _miso;
+    uint32_t _clockHz;
+    size_t _maxTransfer;
+
+    spi_device_handle_t _device;
+    spi_transaction_t _trans[QUEUE_DEPTH];
+    uint8_t _next;
+    uint8_t _pending;
+
+    LCDTransferQueue* _queue;
+    TaskHandle_t _task;
+    SemaphoreHandle_t _idle;
+    portMUX_TYPE _lock;
+
+    static void workerMain(void* arg);
+    void restoreArduinoBus();
+};
+
+#endif // ESP32
+
+#endif // __LCD_DMA_TRANSPORT_H
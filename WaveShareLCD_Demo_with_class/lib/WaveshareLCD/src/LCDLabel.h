@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * | File        : LCDLabel.h
+ * | Function    : Text readout that redraws only the characters that changed
+ * | Info        : Remembers what it last drew: text, font and position
+ * |
+ * | A readout that clears its area and draws the whole string again sends
+ * | every pixel of it for each new value, and the clear can show. A label
+ * | compares the new text with the one on screen instead, cell by cell,
+ * | and redraws only the cells whose character changed:
+ * |
+ * |   LCDLabel reading;
+ * |   reading.begin(lcd, 300, 10, 150, 30, &Font24,
+ * |                 Colors::BLACK, Colors::WHITE, LCDLabel::Align::RIGHT);
+ * |   reading.setFixed(1234, 2, "g");      // "12.34g", all six cells
+ * |   reading.setFixed(1239, 2, "g");      // "12.39g", one cell
+ * |
+ * | Text sits in the box (x, y, width, height): centered vertically,
+ * | aligned horizontally. Right-aligned text keeps its cells on the same
+ * | grid when its length changes, so "99" -> "100" redraws two cells and
+ * | draws one more on the left. When the grid moves (centered text of odd
+ * | and even length, another font) the old cells are erased and the new
+ * | text drawn whole.
+ * |
+ * | Proportional fonts have no grid: the label redraws from the first
+ * | character that changed or moved to the last one, and erases whatever
+ * | of the old text lay outside that span.
+ * |
+ * | Only glyph cells are ever painted; the box around them is the
+ * | caller's. After the caller redraws the area, invalidate() makes the
+ * | next value go out whole.
+ * |
+ * | Numbers are formatted with LCDFormat, not snprintf().
+ *****************************************************************************/
+
+#ifndef __LCD_LABEL_H
+#define __LCD_LABEL_H
+
+#include <stdint.h>
+#include "LCDSurface.h"
+
+class LCDLabel {
+public:
+    static constexpr uint8_t MAX_LENGTH = 32;   // Longer text is cut
+
+    enum class Align : uint8_t { LEFT, CENTER, RIGHT };
+
+    LCDLabel();
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // Place the label; nothing is drawn until the first value
+    void begin(LCDSurface& target, POINT x, POINT y, LENGTH width, LENGTH height,
+               sFONT* font, COLOR bgColor, COLOR fgColor,
+               Align align = Align::LEFT);
+
+    bool isReady() const { return _target != nullptr; }
+
+    // Both take effect with the next value; new colors redraw every cell
+    void setFont(sFONT* font) { _font = font; }
+    sFONT* getFont() const { return _font; }
+    void setColors(COLOR bgColor, COLOR fgColor);
+
+    // The screen no longer shows the last value
+    void invalidate() { _valid = false; }
+
+    //--------------------------------------------------------------------------
+    // Values
+    //--------------------------------------------------------------------------
+    void setText(const char* text);
+    void setNumber(int32_t value, const char* suffix = nullptr);
+
+    // 'value' / 10^decimals, e.g. setFixed(-105, 2, "g") shows "-1.05g"
+    void setFixed(int32_t value, uint8_t decimals, const char* suffix = nullptr);
+
+    const char* getText() const { return _shown; }
+
+    // Cells drawn or erased by the last value
+    uint8_t getCellsChanged() const { return _cellsChanged; }
+
+private:
+    LCDSurface* _target;
+    POINT _x, _y;
+    LENGTH _width, _height;
+    sFONT* _font;
+    COLOR _bgColor, _fgColor;
+    Align _align;
+
+    // What the screen shows
+    char _shown[MAX_LENGTH + 1];
+    uint8_t _shownLength;
+    int32_t _shownX, _shownY;       // Text origin, as passed to drawString()
+    sFONT* _shownFont;
+    COLOR _shownBg, _shownFg;
+    bool _valid;
+
+    uint8_t _cellsChanged;
+
+    void show(const char* text, uint8_t length);
+    void setWithSuffix(char* text, uint8_t length, const char* suffix);
+    void showChanges(int32_t x, int32_t y, const char* text, uint8_t length);
+    void drawCells(int32_t x, int32_t y, const char* text, uint8_t count);
+    void eraseCells(int32_t x, int32_t y, sFONT* font, const char* text, uint8_t count);
+    void eraseSpan(int32_t from, int32_t to, int32_t y, sFONT* font);
+};
+
+#endif // __LCD_LABEL_H
@@ -14,6 +14,13 @@
  * |       POINT x = touch.getX();
  * |       POINT y = touch.getY();
  * |   }
+ * |
+ * | The controller is registered on the panel's SPIBus at TOUCH_SPI_CLOCK,
+ * | so a read takes the bus from the panel (after any DMA stream drains)
+ * | without touching the panel's clock.
+ * |
+ * | LCDTouchT<CS, IRQ, BUSY> is the same driver with its pins checked at
+ * | compile time, to go with WaveshareLCDT.
  *****************************************************************************/
 
 #ifndef __LCD_TOUCH_H
@@ -71,6 +78,9 @@ public:
     POINT getInitialRawX() const { return _rawX0; }
     POINT getInitialRawY() const { return _rawY0; }
 
+    // One unfiltered X/Y sample straight from the controller
+    void readRaw(POINT& x, POINT& y);
+
     //--------------------------------------------------------------------------
     // Coordinates (screen coordinates after calibration)
     //--------------------------------------------------------------------------
@@ -95,7 +105,7 @@ public:
     //--------------------------------------------------------------------------
     // IRQ pin check
     //--------------------------------------------------------------------------
-    bool isTouching() const { return digitalRead(_pins.irq) == LOW; }
+    bool isTouching() const { return !_irq.read(); }
 
 private:
     //--------------------------------------------------------------------------
@@ -103,6 +113,8 @@ private:
     //--------------------------------------------------------------------------
     WaveshareLCD& _lcd;
     TouchPins _pins;
+    LCDGpioPin _irq;
+    SPIBus::Device _busDevice;
 
     //--------------------------------------------------------------------------
     // State
@@ -124,16 +136,25 @@ private:
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
-    void readADC(POINT& x, POINT& y);
     void readADCAverage(POINT& x, POINT& y);
     bool readTwiceADC(POINT& x, POINT& y);
     void loadDefaultCalibration();
+    POINT readChannel(uint8_t command);
+};
 
-    //--------------------------------------------------------------------------
-    // GPIO control
-    //--------------------------------------------------------------------------
-    inline void csLow() { digitalWrite(_pins.cs, LOW); }
-    inline void csHigh() { digitalWrite(_pins.cs, HIGH); }
+//------------------------------------------------------------------------------
+// Pins fixed at compile time
+//------------------------------------------------------------------------------
+// LCDTouchT<4, 16> touch(lcd);             // CS, IRQ (, BUSY)
+template <uint8_t CS, uint8_t IRQ, uint8_t BUSY = 12>
+class LCDTouchT : public LCDTouch {
+    static_assert(LCD_GPIO_IS_OUTPUT(CS), "CS needs an output GPIO (0-33)");
+    static_assert(LCD_GPIO_IS_PIN(IRQ) && LCD_GPIO_IS_PIN(BUSY),
+                  "the ESP32 has no such GPIO");
+    static_assert(CS != IRQ, "CS and IRQ need a pin each");
+
+public:
+    explicit LCDTouchT(WaveshareLCD& lcd) : LCDTouch(lcd, TouchPins(CS, IRQ, BUSY)) {}
 };
 
 #endif // __LCD_TOUCH_H
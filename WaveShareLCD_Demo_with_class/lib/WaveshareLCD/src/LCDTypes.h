@@ -43,6 +43,15 @@ enum class ScanDir : uint8_t {
 
 #define SCAN_DIR_DEFAULT ScanDir::D2U_L2R
 
+//------------------------------------------------------------------------------
+// Panel start-up
+//------------------------------------------------------------------------------
+enum class LCDStart : uint8_t {
+    COLD,           // Hardware reset, then the full init sequence
+    WARM,           // Panel kept power and settings: no reset and its waits
+    AUTO            // WARM after a software or watchdog reset of the ESP32
+};
+
 //------------------------------------------------------------------------------
 // Drawing enumerations
 //------------------------------------------------------------------------------
@@ -124,6 +133,34 @@ struct LCDInfo {
     POINT   yAdjust;
 };
 
+//------------------------------------------------------------------------------
+// Rectangle with an exclusive end, as taken by fillArea()/setWindow()
+//------------------------------------------------------------------------------
+struct LCDRect {
+    POINT x0, y0;
+    POINT x1, y1;
+
+    bool isEmpty() const { return x1 <= x0 || y1 <= y0; }
+};
+
+//------------------------------------------------------------------------------
+// Bus traffic counters (see WaveshareLCD::getStats)
+//------------------------------------------------------------------------------
+struct LCDStats {
+    uint32_t bytes;         // Bytes clocked out to the panel
+    uint32_t commands;      // Command words sent
+    uint32_t csAsserts;     // Times CS was pulled low
+    uint32_t addrSent;      // 0x2A/0x2B address updates sent
+    uint32_t addrCached;    // 0x2A/0x2B updates skipped by the window cache
+    uint32_t continues;     // Pixel writes that continued an open RAM write
+};
+
+//------------------------------------------------------------------------------
+// SPI clocks (see SPIBus)
+//------------------------------------------------------------------------------
+#define LCD_SPI_CLOCK       8000000     // Panel shift register
+#define TOUCH_SPI_CLOCK     2000000     // XPT2046, 2.5 MHz max
+
 //------------------------------------------------------------------------------
 // Default pin configuration for ESP32
 //------------------------------------------------------------------------------
@@ -84,24 +84,22 @@ extern DEV_TIME sDev_time;
 function:
 			Defines commonly used colors for the display
 ********************************************************************************/
-#define LCD_BACKGROUND		WHITE   //Default background color
-#define FONT_BACKGROUND		WHITE   //Default font background color
-#define FONT_FOREGROUND	    GRED    //Default font foreground color
-
-#define WHITE          0xFFFF
-#define BLACK          0x0000
-#define BLUE           0x001F
-#define BRED           0XF81F
-#define GRED 		   0XFFE0
-#define GBLUE		   0X07FF
-#define RED            0xF800
-#define MAGENTA        0xF81F
-#define GREEN          0x07E0
-#define CYAN           0x7FFF
-#define YELLOW         0xFFE0
-#define BROWN 		   0XBC40
-#define BRRED 		   0XFC07
-#define GRAY  		   0X8430
+//The colors of LCDTypes.h, by their plain names. LCD_BACKGROUND,
+//FONT_BACKGROUND (WHITE) and FONT_FOREGROUND (GRED) are defined there too.
+using Colors::WHITE;
+using Colors::BLACK;
+using Colors::BLUE;
+using Colors::BRED;
+using Colors::GRED;
+using Colors::GBLUE;
+using Colors::RED;
+using Colors::MAGENTA;
+using Colors::GREEN;
+using Colors::CYAN;
+using Colors::YELLOW;
+using Colors::BROWN;
+using Colors::BRRED;
+using Colors::GRAY;
 
 /********************************************************************************
 function:
@@ -113,8 +111,10 @@ void GUI_Clear(COLOR Color);
 //Drawing
 void GUI_DrawPoint(POINT Xpoint, POINT Ypoint, COLOR Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
 void GUI_DrawLine(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend, COLOR Color, LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel);
+void GUI_DrawLineAA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend, COLOR Color, COLOR Color_Background = LCD_BACKGROUND);
 void GUI_DrawRectangle(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend, COLOR Color, DRAW_FILL Filled , DOT_PIXEL Dot_Pixel, LINE_STYLE Line_Style=LINE_SOLID);
 void GUI_DrawCircle(POINT X_Center, POINT Y_Center, LENGTH Radius, COLOR Color, DRAW_FILL Draw_Fill , DOT_PIXEL Dot_Pixel );
+void GUI_DrawEllipse(POINT X_Center, POINT Y_Center, LENGTH X_Radius, LENGTH Y_Radius, COLOR Color, DRAW_FILL Draw_Fill , DOT_PIXEL Dot_Pixel );
 
 //pic
 void GUI_Disbitmap(POINT Xpoint, POINT Ypoint, const unsigned char *pMap, POINT Width, POINT Height);
@@ -125,6 +125,11 @@ void GUI_DisChar(POINT Xstart, POINT Ystart, const char Acsii_Char, sFONT* Font,
 void GUI_DisString_EN(POINT Xstart, POINT Ystart, const char * pString, sFONT* Font, COLOR Color_Background, COLOR Color_Foreground );
 void GUI_DisNum(POINT Xpoint, POINT Ypoint, int32_t Nummber, sFONT* Font, COLOR Color_Background, COLOR Color_Foreground );
 
+//Number to string, no snprintf: sign, 10 digits, point, terminator
+#define GUI_NUM_LEN 13
+uint8_t GUI_FormatNum(char *pOut, int32_t Nummber);
+uint8_t GUI_FormatFixed(char *pOut, int32_t Nummber, uint8_t Decimals);
+
 sFONT *GUI_GetFontSize(POINT Dx, POINT Dy);
 #endif
 
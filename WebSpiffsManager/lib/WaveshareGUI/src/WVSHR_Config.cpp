@@ -9,6 +9,7 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include "WVSHR_Config.h"
+#include "SPIBus.h"
 
 /********************************************************************************
   function:    System Init and exit
@@ -18,6 +19,7 @@
 ********************************************************************************/
 uint8_t Wvshr_Init(void)
 {
+  digitalWrite(LCD_RST, HIGH);      //Before it drives, or a warm panel resets
   pinMode(LCD_CS, OUTPUT);
   pinMode(LCD_RST, OUTPUT);
   pinMode(LCD_DC, OUTPUT);
@@ -35,8 +37,9 @@ uint8_t Wvshr_Init(void)
     ledcAttachPin(LCD_BL, 0);
   }
 
-  SPI.begin();                      //Default to VSPI: SCK:18, MISO:19, MOSI:23
-  SPI.beginTransaction(SPISettings(8 * 1000 * 1000, MSBFIRST, SPI_MODE0));
+  //Default to VSPI: SCK:18, MISO:19, MOSI:23. The panel and the touch pad
+  //take the bus in turn through SPIBus, each with its own clock
+  SPIBus::shared().begin();
 
   return 0;
 }
@@ -30,32 +30,48 @@
 //SD
 #define SD_CS 5
 
+//GPIO register access: the pins are constants, so each line change is a
+//single store to the set/clear register instead of a digitalWrite() call
+#if defined(ESP32)
+#include <soc/gpio_struct.h>
+#define WVSHR_PIN_SET(pin)   ((pin) < 32 ? (void)(GPIO.out_w1ts = 1UL << ((pin) & 31)) \
+                                         : (void)(GPIO.out1_w1ts.val = 1UL << ((pin) & 31)))
+#define WVSHR_PIN_CLR(pin)   ((pin) < 32 ? (void)(GPIO.out_w1tc = 1UL << ((pin) & 31)) \
+                                         : (void)(GPIO.out1_w1tc.val = 1UL << ((pin) & 31)))
+#define WVSHR_PIN_GET(pin)   ((((pin) < 32 ? GPIO.in : GPIO.in1.val) >> ((pin) & 31)) & 1)
+#else
+#define WVSHR_PIN_SET(pin)   digitalWrite(pin, HIGH)
+#define WVSHR_PIN_CLR(pin)   digitalWrite(pin, LOW)
+#define WVSHR_PIN_GET(pin)   digitalRead(pin)
+#endif
+
 //LCD I/O Manipulation
-#define LCD_CS_0        digitalWrite(LCD_CS, LOW)
-#define LCD_CS_1        digitalWrite(LCD_CS, HIGH)
+#define LCD_CS_0        WVSHR_PIN_CLR(LCD_CS)
+#define LCD_CS_1        WVSHR_PIN_SET(LCD_CS)
 
-#define LCD_RST_0       digitalWrite(LCD_RST, LOW)
-#define LCD_RST_1       digitalWrite(LCD_RST, HIGH)
+#define LCD_RST_0       WVSHR_PIN_CLR(LCD_RST)
+#define LCD_RST_1       WVSHR_PIN_SET(LCD_RST)
 
-#define LCD_DC_CMD        digitalWrite(LCD_DC, LOW)
-#define LCD_DC_DATA        digitalWrite(LCD_DC, HIGH)
+#define LCD_DC_CMD        WVSHR_PIN_CLR(LCD_DC)
+#define LCD_DC_DATA        WVSHR_PIN_SET(LCD_DC)
 
 //Touch I/O Manipulation
-#define TP_CS_0         digitalWrite(TP_CS, LOW)
-#define TP_CS_1         digitalWrite(TP_CS, HIGH)
+#define TP_CS_0         WVSHR_PIN_CLR(TP_CS)
+#define TP_CS_1         WVSHR_PIN_SET(TP_CS)
 
 //SD I/O Manipulation
-#define SD_CS_0   digitalWrite(LCD_CS, LOW)
-#define SD_CS_1    digitalWrite(LCD_CS, HIGH)
+#define SD_CS_0   WVSHR_PIN_CLR(LCD_CS)
+#define SD_CS_1    WVSHR_PIN_SET(LCD_CS)
 
-#define GET_TP_IRQ      digitalRead(TP_IRQ)
+#define GET_TP_IRQ      WVSHR_PIN_GET(TP_IRQ)
 
-#define GET_TP_BUSY    digitalRead(TP_BUSY)
+#define GET_TP_BUSY    WVSHR_PIN_GET(TP_BUSY)
 
 #define SPI4W_Write_Byte(__DATA) SPI.transfer(__DATA)
 #define SPI4W_Read_Byte(__DATA) SPI.transfer(__DATA)
 
 #define SPI4W_Write_Word(__DATA) SPI.write16(__DATA)
+#define SPI4W_Write_Pixels(__DATA, __LEN) SPI.writePixels(__DATA, (__LEN) * 2)
 
 /*------------------------------------------------------------------------------------------------------*/
 uint8_t Wvshr_Init(void);
@@ -0,0 +1,264 @@
+/*****************************************************************************
+ * | File        : WaveshareLCD.h
+ * | Author      : Refactored to OOP (based on Waveshare team code)
+ * | Function    : ILI9486 LCD Driver and GUI class
+ * | Info        : Object-oriented interface for Waveshare 3.5" LCD
+ * |
+ * | Usage:
+ * |   WaveshareLCD lcd;                    // Use default pins
+ * |   WaveshareLCD lcd(LCDPins(15,26,17,0)); // Custom pins
+ * |   lcd.begin();                         // Initialize
+ * |   lcd.clear(Colors::WHITE);            // Clear screen
+ * |   lcd.drawLine(0, 0, 100, 100, Colors::RED);
+ * |   lcd.drawString(10, 10, "Hello", &Font24, Colors::WHITE, Colors::BLUE);
+ * |
+ * | Large fills go out through an LCDTransport (spi_master DMA on the ESP32)
+ * | and return before the pixels are on the wire. Any later command waits
+ * | for them; use flush()/isBusy()/waitIdle() to sync explicitly.
+ * |
+ * | Commands are sent as 16-bit words with CS held for the whole sequence.
+ * | The last column/page address is cached, so a window that shares a
+ * | range with the previous one skips that half, and the next pixel of an
+ * | open row is written with Memory Write Continue (0x3C) or no command.
+ * |
+ * | The panel shares its SPI bus with the touch controller (and whatever
+ * | else the app adds) through an SPIBus; beginWrite() takes the bus and
+ * | the outermost endWrite() gives it back.
+ * |
+ * | With an LCDGlyphCache attached, opaque glyphs that are fully on screen
+ * | are drawn from the cache as one blit each.
+ * |
+ * | CS, D/C and RST are driven through the GPIO set/clear registers (see
+ * | LCDGpio.h). WaveshareLCDT<CS, DC, RST, BL> is the same driver with its
+ * | pins given, and checked, at compile time.
+ *****************************************************************************/
+
+#ifndef __WAVESHARE_LCD_H
+#define __WAVESHARE_LCD_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "LCDTypes.h"
+#include "LCDTransport.h"
+#include "LCDGpio.h"
+#include "LCDSurface.h"
+#include "SPIBus.h"
+#include "fonts/fonts.h"
+
+class WaveshareLCD : public LCDSurface {
+public:
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+    WaveshareLCD();
+    explicit WaveshareLCD(const LCDPins& pins);
+
+    //--------------------------------------------------------------------------
+    // Initialization
+    //--------------------------------------------------------------------------
+    // The init sequence goes out as one batch with the datasheet minimum
+    // waits. A warm start also skips the hardware reset; use it only when
+    // the panel stayed powered and was set up by an earlier begin().
+    void begin(ScanDir scanDir = SCAN_DIR_DEFAULT, uint16_t backlight = 200,
+               LCDStart start = LCDStart::COLD);
+    void end();
+
+    // Time spent in the last begin(), and whether it was a warm start
+    uint32_t getBeginMicros() const { return _beginMicros; }
+    bool wasWarmStart() const { return _warmStart; }
+
+    // Use a different bus backend; call before begin(). nullptr = blocking SPI.
+    void setTransport(LCDTransport* transport) { _transport = transport; }
+
+    // Share a different bus; call before begin(). nullptr = SPIBus::shared().
+    void setBus(SPIBus* bus) { _bus = bus; }
+    SPIBus& getBus() { return _bus != nullptr ? *_bus : SPIBus::shared(); }
+
+    //--------------------------------------------------------------------------
+    // Asynchronous transfers
+    //--------------------------------------------------------------------------
+    void flush(LCDFlushCallback callback = nullptr, void* context = nullptr);
+    void poll();
+    bool isBusy() const { return _queue.isBusy(); }
+    void waitIdle() override;
+
+    //--------------------------------------------------------------------------
+    // Command batching
+    //--------------------------------------------------------------------------
+    // Hold CS across several drawing calls. Calls nest; the outermost
+    // endWrite() releases CS (or the transfer queue does once it drains).
+    void beginWrite() override;
+    void endWrite() override;
+
+    const LCDStats& getStats() const { return _stats; }
+    void resetStats();
+
+    //--------------------------------------------------------------------------
+    // Display properties
+    //--------------------------------------------------------------------------
+    ScanDir getScanDir() const { return _info.scanDir; }
+    const LCDInfo& getInfo() const { return _info; }
+
+    //--------------------------------------------------------------------------
+    // Backlight control
+    //--------------------------------------------------------------------------
+    void setBacklight(uint16_t value);
+
+    //--------------------------------------------------------------------------
+    // Screen control
+    //--------------------------------------------------------------------------
+    void setScanDirection(ScanDir dir);
+
+    //--------------------------------------------------------------------------
+    // Hardware scrolling
+    //--------------------------------------------------------------------------
+    // The panel scrolls along its 480-line frame memory axis, which is
+    // screen y in the portrait scan directions (L2R_*, R2L_*) and screen x
+    // in the landscape ones. Lines are frame memory lines, i.e. the y (or x)
+    // the drawing calls use.
+    static constexpr LENGTH SCROLL_LINES = LCD_X_MAXPIXEL;
+    bool isScrollVertical() const;
+
+    // Fix 'topFixed' lines above and 'bottomFixed' lines below the area
+    // that scrolls; the rest wraps around inside it
+    void setScrollArea(LENGTH topFixed, LENGTH bottomFixed);
+
+    // Show memory line 'line' (inside the area) at the top of the area
+    void scrollTo(POINT line);
+    POINT getScrollStart() const { return _scrollStart; }
+
+    // Back to the plain, unscrolled display
+    void endScroll();
+
+    //--------------------------------------------------------------------------
+    // Low-level drawing
+    //--------------------------------------------------------------------------
+    void setWindow(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd) override;
+    void setCursor(POINT x, POINT y);
+    void setPixel(POINT x, POINT y, COLOR color) override;
+    void fillArea(POINT xStart, POINT yStart, POINT xEnd, POINT yEnd, COLOR color) override;
+
+    //--------------------------------------------------------------------------
+    // Bulk pixel transfer
+    //--------------------------------------------------------------------------
+    // Stream pixels into the window opened by setWindow(). Large writes are
+    // queued: keep the buffer alive until isBusy() returns false. The
+    // drawing primitives, blit() and blitSubRect() come from LCDSurface.
+    void pushPixels(const COLOR* pixels, uint32_t count, bool swapped = false) override;
+
+    // Stream 'count' pixels of one color into the open window
+    void pushColor(COLOR color, uint32_t count);
+
+    // Large writes are expanded from the palette straight into the DMA line
+    // buffers; keep both arrays alive until isBusy() returns false
+    void pushIndexed(const uint8_t* indices, uint32_t count, const uint32_t* pairs) override;
+
+    //--------------------------------------------------------------------------
+    // Low-level register access (for advanced use)
+    //--------------------------------------------------------------------------
+    void writeReg(uint8_t reg);
+    void writeData(uint8_t data);
+
+private:
+    //--------------------------------------------------------------------------
+    // Pin configuration
+    //--------------------------------------------------------------------------
+    LCDPins _pins;
+    LCDGpioPin _cs;
+    LCDGpioPin _dc;
+    LCDGpioPin _rst;
+    bool _initialized;
+    bool _warmStart;
+    uint32_t _beginMicros;
+
+    //--------------------------------------------------------------------------
+    // Transfer queue
+    //--------------------------------------------------------------------------
+    static constexpr uint32_t ASYNC_MIN_PIXELS = 64;   // smaller writes stay blocking
+    LCDTransport* _transport;
+    LCDTransferQueue _queue;
+
+    static LCDTransport* defaultTransport();
+    static void onTransferIdle(void* context);
+
+    //--------------------------------------------------------------------------
+    // Shared bus
+    //--------------------------------------------------------------------------
+    SPIBus* _bus;
+    SPIBus::Device _busDevice;
+
+    static void onBusHandover(void* context);
+
+    //--------------------------------------------------------------------------
+    // Address window cache and RAM write pointer
+    //--------------------------------------------------------------------------
+    struct Window {
+        POINT x0, x1, y0, y1;   // Inclusive, as sent to 0x2A/0x2B
+        bool valid;
+    };
+    Window _window;
+    POINT _ramX, _ramY;          // Where the next pixel will land
+    bool _ramValid;              // _ramX/_ramY are known
+    bool _ramOpen;               // RAM write in progress with CS held since
+    volatile uint8_t _writeDepth;
+    LCDStats _stats;
+
+    void sendCommand(uint8_t cmd);
+    void sendAddress(uint8_t cmd, POINT start, POINT end);
+    void openWindow(POINT x0, POINT y0, POINT x1, POINT y1);
+    void advanceRam(uint32_t count);
+    void invalidateWindow();
+    void sendParams(uint8_t cmd, const uint16_t* values, uint8_t count);
+
+    //--------------------------------------------------------------------------
+    // Scroll area (memory lines)
+    //--------------------------------------------------------------------------
+    LENGTH _scrollTop;
+    LENGTH _scrollLines;
+    POINT _scrollStart;
+
+    //--------------------------------------------------------------------------
+    // Hardware control
+    //--------------------------------------------------------------------------
+    static constexpr uint32_t RESET_PULSE_US = 20;       // >= 10 us low
+    static constexpr uint32_t RESET_READY_MS = 5;        // until commands
+    static constexpr uint32_t RESET_SLEEP_OUT_MS = 120;  // until Sleep Out
+
+    static bool isWarmReset();
+    void reset();
+    void sendSequence(const uint8_t* sequence);
+    void writeAllData(uint16_t data, uint32_t len);
+    void setWindowColor(COLOR color, POINT width, POINT height);
+
+    //--------------------------------------------------------------------------
+    // Control lines, one register store each
+    //--------------------------------------------------------------------------
+    inline void csLow() { _cs.low(); _stats.csAsserts++; }
+    inline void csHigh() { _cs.high(); }
+    inline void rstLow() { _rst.low(); }
+    inline void rstHigh() { _rst.high(); }
+    inline void dcCmd() { _dc.low(); }
+    inline void dcData() { _dc.high(); }
+};
+
+//------------------------------------------------------------------------------
+// Pins fixed at compile time
+//------------------------------------------------------------------------------
+// WaveshareLCDT<15, 17, 26> lcd;           // CS, DC, RST (, BL)
+// A pin that cannot drive, or one used twice, fails to compile instead of
+// leaving the panel dark.
+template <uint8_t CS, uint8_t DC, uint8_t RST, uint8_t BL = 0>
+class WaveshareLCDT : public WaveshareLCD {
+    static_assert(LCD_GPIO_IS_OUTPUT(CS) && LCD_GPIO_IS_OUTPUT(DC) &&
+                  LCD_GPIO_IS_OUTPUT(RST),
+                  "CS, DC and RST need output GPIOs (0-33)");
+    static_assert(BL == 0 || LCD_GPIO_IS_OUTPUT(BL),
+                  "BL needs an output GPIO (0-33), or 0 for none");
+    static_assert(CS != DC && CS != RST && DC != RST,
+                  "CS, DC and RST need a pin each");
+
+public:
+    WaveshareLCDT() : WaveshareLCD(LCDPins(CS, RST, DC, BL)) {}
+};
+
+#endif // __WAVESHARE_LCD_H
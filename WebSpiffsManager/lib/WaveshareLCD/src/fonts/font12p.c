@@ -0,0 +1,213 @@
+/* Font12P: 7x12, ' '..'~', packed by LCDFontPack::writeSource().
+   1045 bytes of glyphs and 0 of offsets; the table had 1140.
+   0 of 95 glyphs are run-length coded. */
+
+#include "fonts.h"
+
+const uint8_t Font12P_Data[] =
+{
+	// @0 ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @11 '!'
+	0x00, 0x20, 0x40, 0x81, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	// @22 '"'
+	0x00, 0xD9, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @33 '#'
+	0x00, 0x28, 0x51, 0x47, 0xC5, 0x1F, 0x14, 0x50, 0xA0, 0x00, 0x00,
+	// @44 '$'
+	0x00, 0x20, 0xE2, 0x04, 0x07, 0x12, 0x38, 0x10, 0x20, 0x00, 0x00,
+	// @55 '%'
+	0x00, 0x41, 0x41, 0x00, 0xCE, 0x02, 0x0A, 0x08, 0x00, 0x00, 0x00,
+	// @66 '&'
+	0x00, 0x00, 0x00, 0xC2, 0x04, 0x15, 0x24, 0x34, 0x00, 0x00, 0x00,
+	// @77 '''
+	0x00, 0x20, 0x40, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @88 '('
+	0x00, 0x10, 0x20, 0x81, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x00,
+	// @99 ')'
+	0x00, 0x40, 0x80, 0x81, 0x02, 0x04, 0x08, 0x10, 0x40, 0x80, 0x00,
+	// @110 '*'
+	0x00, 0x21, 0xF0, 0x82, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @121 '+'
+	0x00, 0x00, 0x40, 0x81, 0x1F, 0xC4, 0x08, 0x10, 0x00, 0x00, 0x00,
+	// @132 ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x60, 0x80, 0x00,
+	// @143 '-'
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @154 '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00,
+	// @165 '/'
+	0x00, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x80, 0x00, 0x00,
+	// @176 '0'
+	0x00, 0x71, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @187 '1'
+	0x00, 0x60, 0x40, 0x81, 0x02, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x00,
+	// @198 '2'
+	0x00, 0x71, 0x10, 0x20, 0x82, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00,
+	// @209 '3'
+	0x00, 0x71, 0x10, 0x21, 0x80, 0x81, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @220 '4'
+	0x00, 0x18, 0x50, 0xA2, 0x48, 0x9F, 0x82, 0x0E, 0x00, 0x00, 0x00,
+	// @231 '5'
+	0x00, 0x78, 0x81, 0x03, 0x80, 0x81, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @242 '6'
+	0x00, 0x38, 0x82, 0x07, 0x88, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @253 '7'
+	0x00, 0xF9, 0x10, 0x20, 0x81, 0x02, 0x08, 0x10, 0x00, 0x00, 0x00,
+	// @264 '8'
+	0x00, 0x71, 0x12, 0x23, 0x88, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @275 '9'
+	0x00, 0x71, 0x12, 0x24, 0x47, 0x81, 0x04, 0x70, 0x00, 0x00, 0x00,
+	// @286 ':'
+	0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00,
+	// @297 ';'
+	0x00, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x0C, 0x30, 0x40, 0x00, 0x00,
+	// @308 '<'
+	0x00, 0x00, 0x30, 0x86, 0x10, 0x18, 0x08, 0x0C, 0x00, 0x00, 0x00,
+	// @319 '='
+	0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @330 '>'
+	0x00, 0x03, 0x01, 0x01, 0x80, 0x86, 0x10, 0xC0, 0x00, 0x00, 0x00,
+	// @341 '?'
+	0x00, 0x00, 0x61, 0x20, 0x41, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00,
+	// @352 '@'
+	0x38, 0x89, 0x12, 0x65, 0x4A, 0x93, 0x20, 0x44, 0x70, 0x00, 0x00,
+	// @363 'A'
+	0x00, 0x60, 0x41, 0x42, 0x85, 0x1F, 0x22, 0xEE, 0x00, 0x00, 0x00,
+	// @374 'B'
+	0x01, 0xF1, 0x12, 0x27, 0x88, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	// @385 'C'
+	0x00, 0x79, 0x12, 0x04, 0x08, 0x10, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @396 'D'
+	0x01, 0xE1, 0x22, 0x24, 0x48, 0x91, 0x24, 0xF0, 0x00, 0x00, 0x00,
+	// @407 'E'
+	0x01, 0xF9, 0x12, 0x87, 0x0A, 0x10, 0x22, 0xFC, 0x00, 0x00, 0x00,
+	// @418 'F'
+	0x00, 0xFC, 0x89, 0x43, 0x85, 0x08, 0x10, 0x70, 0x00, 0x00, 0x00,
+	// @429 'G'
+	0x00, 0x79, 0x12, 0x04, 0x09, 0xD1, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @440 'H'
+	0x01, 0xDD, 0x12, 0x27, 0xC8, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+	// @451 'I'
+	0x00, 0xF8, 0x40, 0x81, 0x02, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x00,
+	// @462 'J'
+	0x00, 0x78, 0x20, 0x40, 0x89, 0x12, 0x24, 0x30, 0x00, 0x00, 0x00,
+	// @473 'K'
+	0x01, 0xDD, 0x12, 0x45, 0x0E, 0x12, 0x22, 0xE6, 0x00, 0x00, 0x00,
+	// @484 'L'
+	0x00, 0xE0, 0x81, 0x02, 0x04, 0x09, 0x12, 0x7C, 0x00, 0x00, 0x00,
+	// @495 'M'
+	0x01, 0xDD, 0xB3, 0x65, 0x4A, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+	// @506 'N'
+	0x01, 0xDD, 0x93, 0x25, 0x4A, 0x95, 0x26, 0xEC, 0x00, 0x00, 0x00,
+	// @517 'O'
+	0x00, 0x71, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @528 'P'
+	0x00, 0xF0, 0x91, 0x22, 0x47, 0x08, 0x10, 0x70, 0x00, 0x00, 0x00,
+	// @539 'Q'
+	0x00, 0x71, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0x38, 0x00, 0x00,
+	// @550 'R'
+	0x01, 0xF1, 0x12, 0x24, 0x4F, 0x12, 0x22, 0xE2, 0x00, 0x00, 0x00,
+	// @561 'S'
+	0x00, 0x69, 0x32, 0x03, 0x80, 0x81, 0x32, 0x58, 0x00, 0x00, 0x00,
+	// @572 'T'
+	0x01, 0xFE, 0x48, 0x81, 0x02, 0x04, 0x08, 0x38, 0x00, 0x00, 0x00,
+	// @583 'U'
+	0x01, 0xDD, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @594 'V'
+	0x01, 0xDD, 0x12, 0x22, 0x85, 0x0A, 0x08, 0x10, 0x00, 0x00, 0x00,
+	// @605 'W'
+	0x01, 0xDD, 0x12, 0x25, 0x4A, 0x95, 0x2A, 0x28, 0x00, 0x00, 0x00,
+	// @616 'X'
+	0x01, 0x8D, 0x11, 0x41, 0x02, 0x0A, 0x22, 0xC6, 0x00, 0x00, 0x00,
+	// @627 'Y'
+	0x01, 0xDD, 0x11, 0x42, 0x82, 0x04, 0x08, 0x38, 0x00, 0x00, 0x00,
+	// @638 'Z'
+	0x00, 0xF9, 0x10, 0x41, 0x02, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00,
+	// @649 '['
+	0x00, 0x70, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0xE0, 0x00,
+	// @660 '\'
+	0x00, 0x80, 0x81, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x00, 0x00,
+	// @671 ']'
+	0x00, 0x70, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0xE0, 0x00,
+	// @682 '^'
+	0x00, 0x20, 0x41, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @693 '_'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
+	// @704 '`'
+	0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @715 'a'
+	0x00, 0x00, 0x01, 0xC4, 0x47, 0x91, 0x22, 0x3E, 0x00, 0x00, 0x00,
+	// @726 'b'
+	0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	// @737 'c'
+	0x00, 0x00, 0x01, 0xE4, 0x48, 0x10, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @748 'd'
+	0x00, 0x18, 0x11, 0xA4, 0xC8, 0x91, 0x22, 0x3E, 0x00, 0x00, 0x00,
+	// @759 'e'
+	0x00, 0x00, 0x01, 0xC4, 0x4F, 0x90, 0x20, 0x3C, 0x00, 0x00, 0x00,
+	// @770 'f'
+	0x00, 0x38, 0x83, 0xE2, 0x04, 0x08, 0x10, 0x7C, 0x00, 0x00, 0x00,
+	// @781 'g'
+	0x00, 0x00, 0x01, 0xB4, 0xC8, 0x91, 0x22, 0x3C, 0x08, 0xE0, 0x00,
+	// @792 'h'
+	0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+	// @803 'i'
+	0x00, 0x20, 0x03, 0x81, 0x02, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x00,
+	// @814 'j'
+	0x00, 0x20, 0x03, 0xC0, 0x81, 0x02, 0x04, 0x08, 0x11, 0xC0, 0x00,
+	// @825 'k'
+	0x01, 0x81, 0x02, 0xE4, 0x8E, 0x14, 0x24, 0xDC, 0x00, 0x00, 0x00,
+	// @836 'l'
+	0x00, 0x60, 0x40, 0x81, 0x02, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x00,
+	// @847 'm'
+	0x00, 0x00, 0x07, 0x45, 0x4A, 0x95, 0x2A, 0xFE, 0x00, 0x00, 0x00,
+	// @858 'n'
+	0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+	// @869 'o'
+	0x00, 0x00, 0x01, 0xC4, 0x48, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @880 'p'
+	0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0x78, 0x83, 0x80, 0x00,
+	// @891 'q'
+	0x00, 0x00, 0x01, 0xB4, 0xC8, 0x91, 0x22, 0x3C, 0x08, 0x38, 0x00,
+	// @902 'r'
+	0x00, 0x00, 0x03, 0x63, 0x04, 0x08, 0x10, 0x7C, 0x00, 0x00, 0x00,
+	// @913 's'
+	0x00, 0x00, 0x01, 0xE4, 0x47, 0x01, 0x22, 0x78, 0x00, 0x00, 0x00,
+	// @924 't'
+	0x00, 0x00, 0x83, 0xE2, 0x04, 0x08, 0x11, 0x1C, 0x00, 0x00, 0x00,
+	// @935 'u'
+	0x00, 0x00, 0x06, 0x64, 0x48, 0x91, 0x26, 0x36, 0x00, 0x00, 0x00,
+	// @946 'v'
+	0x00, 0x00, 0x07, 0x74, 0x48, 0x8A, 0x14, 0x10, 0x00, 0x00, 0x00,
+	// @957 'w'
+	0x00, 0x00, 0x07, 0x74, 0x4A, 0x95, 0x2A, 0x28, 0x00, 0x00, 0x00,
+	// @968 'x'
+	0x00, 0x00, 0x06, 0x64, 0x86, 0x0C, 0x24, 0xCC, 0x00, 0x00, 0x00,
+	// @979 'y'
+	0x00, 0x00, 0x07, 0x74, 0x44, 0x8A, 0x0C, 0x10, 0x21, 0xE0, 0x00,
+	// @990 'z'
+	0x00, 0x00, 0x03, 0xE4, 0x82, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00,
+	// @1001 '{'
+	0x00, 0x10, 0x40, 0x81, 0x02, 0x08, 0x08, 0x10, 0x20, 0x20, 0x00,
+	// @1012 '|'
+	0x00, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
+	// @1023 '}'
+	0x00, 0x40, 0x40, 0x81, 0x02, 0x02, 0x08, 0x10, 0x20, 0x80, 0x00,
+	// @1034 '~'
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const sPACKED Font12P_Packed = {
+  Font12P_Data,
+  0, /* Every glyph raw */
+  32, /* First */
+  126, /* Last */
+};
+
+sFONT Font12P = {
+  0,
+  7, /* Width */
+  12, /* Height */
+  &Font12P_Packed,
+};
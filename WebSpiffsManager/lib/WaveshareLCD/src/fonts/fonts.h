@@ -51,11 +51,48 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+/* Packed glyphs (see LCDGlyphReader.h): Width x Height bits per glyph with
+   no row padding, First..Last only, each glyph either raw or run-length
+   coded. 'offsets' holds a byte offset into 'data' per glyph plus the end,
+   bit 15 set on run-length glyphs; NULL when every glyph is raw and they
+   follow each other at a fixed stride.
+
+   A subset leaves characters out: 'Map' gives the glyph number of each
+   character from First to Last, PACKED_NO_GLYPH for those not in the font.
+   Without it glyph n is character First + n.
+
+   A proportional font has a cell per glyph ('Glyphs'): the pen moves by
+   Advance, and only the Width x Height box at (Left, Top) of the
+   Advance x font Height cell is stored. sFONT::Width is then the widest
+   Advance. Characters a proportional subset leaves out take no space. */
+typedef struct _tGlyph
+{
+  uint8_t Advance;
+  uint8_t Left;
+  uint8_t Top;
+  uint8_t Width;
+  uint8_t Height;
+} sGLYPH;
+
+typedef struct _tPackedFont
+{
+  const uint8_t *data;
+  const uint16_t *offsets;
+  uint8_t First;
+  uint8_t Last;
+  const uint8_t *Map;     /* Subsets only */
+  const sGLYPH *Glyphs;   /* Proportional fonts only */
+} sPACKED;
+
+#define PACKED_NO_GLYPH         0xFF
+#define PACKED_RLE_FLAG         0x8000
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const sPACKED *Packed;  /* Used instead of 'table' when set */
   
 } sFONT;
 
@@ -65,6 +102,13 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+/* The same fonts packed (LCDFontPack): about half the flash, drawn the same */
+extern sFONT Font24P;
+extern sFONT Font20P;
+extern sFONT Font16P;
+extern sFONT Font12P;
+extern sFONT Font8P;
+
 #ifdef __cplusplus
 }
 #endif